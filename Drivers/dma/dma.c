@@ -0,0 +1,233 @@
+/***************************************************************************************
+ * @file        dma.c
+ * @version     1.0
+ * @date        10/15/2026
+ * @brief       File with implementations of the DMA and DMAMUX Modules for Kinetis KL05 Family.
+ * @remarks     None.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "dma.h"
+
+/*!
+ * @addtogroup dma driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief The software state of a DMA channel.
+ */
+typedef struct
+{
+	dmaCallback_t callback;  /*!< The channel callback, or NULL. */
+	void *arg;               /*!< The callback argument. */
+	uint8_t *buffer;         /*!< The buffer of a double-buffered transfer. */
+	uint32_t halfLength;     /*!< The length of each half in bytes. */
+	dmaDirection_t direction;/*!< The direction of the current transfer. */
+	bool doubleBuffer;       /*!< If the current transfer is circular double-buffered. */
+	uint8_t nextHalf;        /*!< The half being transferred now (0 or 1). */
+}dmaChannelState_t;
+
+#define DMA_DSR_ERROR_MASK ( DMA_DSR_BCR_CE_MASK | DMA_DSR_BCR_BES_MASK | DMA_DSR_BCR_BED_MASK )
+
+/* Volatile: the state is updated by the channel interrupts */
+static volatile dmaChannelState_t g_dmaChannels[DMA_CHANNEL_COUNT];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Program the address registers and the byte count, and enable the requests.
+ *
+ * The channel must be idle. D_REQ clears ERQ when BCR reaches 0: a request of
+ * the peripheral with BCR at 0 would be a configuration error (DSR_BCR[CE]), and
+ * the peripherals keep requesting after the last element (UART0 TDRE).
+ */
+static void DMA_Arm( uint8_t channel, dmaDirection_t direction, volatile void *peripheral,
+		void *buffer, uint32_t length, dmaTransferSize_t size )
+{
+	uint32_t dcr = DMA_DCR_EINT_MASK | DMA_DCR_ERQ_MASK | DMA_DCR_CS_MASK | DMA_DCR_D_REQ_MASK |
+			DMA_DCR_SSIZE( size ) | DMA_DCR_DSIZE( size );
+
+	DMA0->DMA[channel].DCR = 0U;
+	DMA0->DMA[channel].DSR_BCR = DMA_DSR_BCR_DONE_MASK; /* Clear previous status */
+
+	if ( direction == DMA_PERIPHERAL_TO_MEMORY )
+	{
+		DMA0->DMA[channel].SAR = (uint32_t)(uintptr_t)peripheral;
+		DMA0->DMA[channel].DAR = (uint32_t)(uintptr_t)buffer;
+		dcr |= DMA_DCR_DINC_MASK;
+	}
+	else
+	{
+		DMA0->DMA[channel].SAR = (uint32_t)(uintptr_t)buffer;
+		DMA0->DMA[channel].DAR = (uint32_t)(uintptr_t)peripheral;
+		dcr |= DMA_DCR_SINC_MASK;
+	}
+
+	DMA0->DMA[channel].DSR_BCR = DMA_DSR_BCR_BCR( length );
+	DMA0->DMA[channel].DCR = dcr;
+}
+
+/**
+ * @brief Common handling of the channel interrupts.
+ */
+static void DMA_ChannelIRQHandler( uint8_t channel )
+{
+	volatile dmaChannelState_t *state = &g_dmaChannels[channel];
+	uint32_t status = DMA0->DMA[channel].DSR_BCR;
+	dmaEvent_t event = DMA_EVENT_FULL_COMPLETE;
+
+	DMA0->DMA[channel].DSR_BCR = DMA_DSR_BCR_DONE_MASK; /* Clear DONE and the error flags */
+
+	if ( status & DMA_DSR_ERROR_MASK )
+	{
+		DMA0->DMA[channel].DCR &= ~DMA_DCR_ERQ_MASK;
+		state->doubleBuffer = false;
+		event = DMA_EVENT_ERROR;
+	}
+	else if ( state->doubleBuffer )
+	{
+		/* Re-arm the channel for the other half before calling the application */
+		uint8_t *half;
+
+		event = ( state->nextHalf == 0U ) ? DMA_EVENT_HALF_COMPLETE : DMA_EVENT_FULL_COMPLETE;
+		state->nextHalf ^= 1U;
+		half = state->buffer + ( state->nextHalf * state->halfLength );
+
+		if ( state->direction == DMA_PERIPHERAL_TO_MEMORY )
+		{
+			DMA0->DMA[channel].DAR = (uint32_t)(uintptr_t)half;
+		}
+		else
+		{
+			DMA0->DMA[channel].SAR = (uint32_t)(uintptr_t)half;
+		}
+		DMA0->DMA[channel].DSR_BCR = DMA_DSR_BCR_BCR( state->halfLength );
+		/* ERQ was cleared by D_REQ at the end of the half */
+		DMA0->DMA[channel].DCR |= DMA_DCR_ERQ_MASK;
+	}
+
+	if ( state->callback != NULL )
+	{
+		state->callback( channel, event, state->arg );
+	}
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void DMA_Init( void )
+{
+	SIM->SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
+	SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
+}
+
+/**********************************************************************************/
+void DMA_InitChannel( uint8_t channel, dmaRequestSource_t source, dmaCallback_t callback, void *arg )
+{
+	SYSTEM_ASSERT( channel < DMA_CHANNEL_COUNT );
+
+	DMA_StopChannel( channel );
+
+	g_dmaChannels[channel].callback = callback;
+	g_dmaChannels[channel].arg = arg;
+
+	DMAMUX0->CHCFG[channel] = 0U; /* The source must be changed with the channel disabled */
+	DMAMUX0->CHCFG[channel] = DMAMUX_CHCFG_SOURCE( source ) | DMAMUX_CHCFG_ENBL_MASK;
+
+	NVIC_EnableIRQ( (IRQn_Type)( DMA0_IRQn + channel ) );
+}
+
+/**********************************************************************************/
+uint8_t DMA_StartTransfer( uint8_t channel, dmaDirection_t direction, volatile void *peripheral,
+		void *buffer, size_t length, dmaTransferSize_t size )
+{
+	SYSTEM_ASSERT( channel < DMA_CHANNEL_COUNT );
+	SYSTEM_ASSERT( length <= DMA_MAX_TRANSFER_LENGTH );
+
+	if ( DMA_IsChannelBusy( channel ) )
+	{
+		return SYSTEM_STATUS_BUSY;
+	}
+
+	g_dmaChannels[channel].doubleBuffer = false;
+	g_dmaChannels[channel].direction = direction;
+
+	DMA_Arm( channel, direction, peripheral, buffer, length, size );
+
+	return SYSTEM_STATUS_SUCCESS;
+}
+
+/**********************************************************************************/
+uint8_t DMA_StartDoubleBuffer( uint8_t channel, dmaDirection_t direction, volatile void *peripheral,
+		void *buffer, size_t length, dmaTransferSize_t size )
+{
+	volatile dmaChannelState_t *state;
+
+	SYSTEM_ASSERT( channel < DMA_CHANNEL_COUNT );
+	SYSTEM_ASSERT( length / 2U <= DMA_MAX_TRANSFER_LENGTH );
+
+	state = &g_dmaChannels[channel];
+	if ( DMA_IsChannelBusy( channel ) )
+	{
+		return SYSTEM_STATUS_BUSY;
+	}
+
+	state->buffer = (uint8_t*)buffer;
+	state->halfLength = length / 2U;
+	state->direction = direction;
+	state->nextHalf = 0U;
+	state->doubleBuffer = true;
+
+	DMA_Arm( channel, direction, peripheral, buffer, state->halfLength, size );
+
+	return SYSTEM_STATUS_SUCCESS;
+}
+
+/**********************************************************************************/
+void DMA_StopChannel( uint8_t channel )
+{
+	SYSTEM_ASSERT( channel < DMA_CHANNEL_COUNT );
+
+	g_dmaChannels[channel].doubleBuffer = false;
+	DMA0->DMA[channel].DCR &= ~( DMA_DCR_ERQ_MASK | DMA_DCR_EINT_MASK );
+	DMA0->DMA[channel].DSR_BCR = DMA_DSR_BCR_DONE_MASK; /* Clear BCR and the status flags */
+}
+
+#ifdef DMA_IRQ_HANDLERS
+
+/**********************************************************************************/
+void DMA0_IRQHandler( void )
+{
+	DMA_ChannelIRQHandler( 0U );
+}
+
+/**********************************************************************************/
+void DMA1_IRQHandler( void )
+{
+	DMA_ChannelIRQHandler( 1U );
+}
+
+/**********************************************************************************/
+void DMA2_IRQHandler( void )
+{
+	DMA_ChannelIRQHandler( 2U );
+}
+
+/**********************************************************************************/
+void DMA3_IRQHandler( void )
+{
+	DMA_ChannelIRQHandler( 3U );
+}
+
+#endif /* DMA_IRQ_HANDLERS */
+
+/*! @}*/
@@ -0,0 +1,213 @@
+/***************************************************************************************
+ * @file        dma.h
+ * @version     1.0
+ * @date        10/15/2026
+ * @brief       File with implementations of the DMA and DMAMUX Modules for Kinetis KL05 Family.
+ * @remarks     The KL05 DMA has no descriptors and no half-complete interrupt. The
+ *              double-buffered mode is emulated by splitting the buffer in two halves
+ *              and re-arming the channel for the other half in the channel interrupt.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef DMA_DRV_H_
+#define DMA_DRV_H_
+
+#include <common.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @addtogroup dma driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Defines if DMA0_IRQHandler..DMA3_IRQHandler are implemented by the driver.
+ *   Comment if you want to implement your own handlers. */
+#define DMA_IRQ_HANDLERS
+
+/*!< The number of DMA channels. */
+#define DMA_CHANNEL_COUNT 4U
+
+/*!< The largest byte count of a transfer: BCR has 20 valid bits. */
+#define DMA_MAX_TRANSFER_LENGTH 0xFFFFFU
+
+/* @brief DMAMUX request sources */
+typedef enum {
+    DMA_SOURCE_DISABLED = 0U,       /**< Channel disabled */
+    DMA_SOURCE_UART0_RX = 2U,       /**< UART0 receive */
+    DMA_SOURCE_UART0_TX = 3U,       /**< UART0 transmit */
+    DMA_SOURCE_SPI0_RX = 16U,       /**< SPI0 receive */
+    DMA_SOURCE_SPI0_TX = 17U,       /**< SPI0 transmit */
+    DMA_SOURCE_I2C0 = 22U,          /**< I2C0 */
+    DMA_SOURCE_ADC0 = 40U,          /**< ADC0 conversion complete */
+    DMA_SOURCE_ALWAYS_ENABLED = 60U /**< Always enabled (memory to memory) */
+} dmaRequestSource_t;
+
+/* @brief Size of each bus access */
+typedef enum {
+    DMA_TRANSFER_SIZE_32BIT = 0U, /**< 32-bit access */
+    DMA_TRANSFER_SIZE_8BIT = 1U,  /**< 8-bit access */
+    DMA_TRANSFER_SIZE_16BIT = 2U  /**< 16-bit access */
+} dmaTransferSize_t;
+
+/* @brief Transfer direction. The peripheral address is never incremented. */
+typedef enum {
+    DMA_PERIPHERAL_TO_MEMORY, /**< From the peripheral register to the buffer */
+    DMA_MEMORY_TO_PERIPHERAL  /**< From the buffer to the peripheral register */
+} dmaDirection_t;
+
+/* @brief Events reported to the channel callback */
+typedef enum {
+    DMA_EVENT_HALF_COMPLETE, /**< First half of a double buffer is done */
+    DMA_EVENT_FULL_COMPLETE, /**< Single transfer, or second half of a double buffer, is done */
+    DMA_EVENT_ERROR          /**< Configuration or bus error. The channel is stopped */
+} dmaEvent_t;
+
+/**
+ * @brief Channel callback, called from the channel interrupt.
+ *
+ * @param channel - the DMA channel.
+ * @param event - the event that caused the interrupt.
+ * @param arg - the argument passed to DMA_InitChannel.
+ */
+typedef void (*dmaCallback_t)( uint8_t channel, dmaEvent_t event, void *arg );
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Get the number of bytes left in the current transfer (or half).
+ *
+ * @param channel - the DMA channel.
+ *
+ * @return The BCR field of the channel.
+ */
+static inline uint32_t DMA_GetRemainingBytes( uint8_t channel );
+
+/**
+ * @brief Get the current destination address of the channel.
+ *
+ * In peripheral to memory transfers it points to the next byte to be
+ * written in the buffer.
+ *
+ * @param channel - the DMA channel.
+ *
+ * @return The DAR register of the channel.
+ */
+static inline uint32_t DMA_GetDestinationAddress( uint8_t channel );
+
+/**
+ * @brief Verify if the channel has a transfer in progress.
+ *
+ * @param channel - the DMA channel.
+ *
+ * @return true if the BCR field is not zero.
+ */
+static inline bool DMA_IsChannelBusy( uint8_t channel );
+
+/**
+ * @brief Enable the clock of the DMA and DMAMUX modules.
+ */
+void DMA_Init( void );
+
+/**
+ * @brief Configure a DMA channel.
+ *
+ * This function routes the request source to the channel, registers the
+ * callback and enables the channel interrupt in NVIC.
+ *
+ * @param channel - the DMA channel (0 to DMA_CHANNEL_COUNT - 1).
+ * @param source - the DMAMUX request source.
+ * @param callback - the callback for the channel events, or NULL.
+ * @param arg - an argument passed to the callback.
+ *
+ * @note This function should be called after the DMA_Init.
+ */
+void DMA_InitChannel( uint8_t channel, dmaRequestSource_t source, dmaCallback_t callback, void *arg );
+
+/**
+ * @brief Start a single transfer between a peripheral register and a buffer.
+ *
+ * The callback is called with DMA_EVENT_FULL_COMPLETE when all bytes are
+ * transferred. It is allowed to start a new transfer from the callback.
+ *
+ * @param channel - the DMA channel.
+ * @param direction - the transfer direction.
+ * @param peripheral - the peripheral register address.
+ * @param buffer - the buffer address, aligned to the transfer size.
+ * @param length - the number of bytes, multiple of the transfer size, up to
+ *                 DMA_MAX_TRANSFER_LENGTH.
+ * @param size - the size of each access.
+ *
+ * @return SYSTEM_STATUS_SUCCESS if the transfer was started, or
+ *         SYSTEM_STATUS_BUSY if the channel has a transfer in progress.
+ */
+uint8_t DMA_StartTransfer( uint8_t channel, dmaDirection_t direction, volatile void *peripheral,
+		void *buffer, size_t length, dmaTransferSize_t size );
+
+/**
+ * @brief Start a circular double-buffered transfer.
+ *
+ * The buffer is split in two halves. The callback is called with
+ * DMA_EVENT_HALF_COMPLETE when the first half is done and with
+ * DMA_EVENT_FULL_COMPLETE when the second half is done, and the channel keeps
+ * running from the other half until DMA_StopChannel is called. The application
+ * must process a half before the channel returns to it.
+ *
+ * @param channel - the DMA channel.
+ * @param direction - the transfer direction.
+ * @param peripheral - the peripheral register address.
+ * @param buffer - the buffer address, aligned to the transfer size.
+ * @param length - the whole buffer length in bytes, multiple of twice the transfer size,
+ *                 up to twice DMA_MAX_TRANSFER_LENGTH.
+ * @param size - the size of each access.
+ *
+ * @return SYSTEM_STATUS_SUCCESS if the transfer was started, or
+ *         SYSTEM_STATUS_BUSY if the channel has a transfer in progress.
+ */
+uint8_t DMA_StartDoubleBuffer( uint8_t channel, dmaDirection_t direction, volatile void *peripheral,
+		void *buffer, size_t length, dmaTransferSize_t size );
+
+/**
+ * @brief Stop the channel, discarding the transfer in progress.
+ *
+ * @param channel - the DMA channel.
+ */
+void DMA_StopChannel( uint8_t channel );
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+static inline uint32_t DMA_GetRemainingBytes( uint8_t channel )
+{
+	return DMA0->DMA[channel].DSR_BCR & DMA_DSR_BCR_BCR_MASK;
+}
+
+/**********************************************************************************/
+static inline uint32_t DMA_GetDestinationAddress( uint8_t channel )
+{
+	return DMA0->DMA[channel].DAR;
+}
+
+/**********************************************************************************/
+static inline bool DMA_IsChannelBusy( uint8_t channel )
+{
+	return DMA_GetRemainingBytes( channel ) != 0U;
+}
+
+/*! @}*/
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* DMA_DRV_H_ */
@@ -0,0 +1,371 @@
+/***************************************************************************************
+ * @file        dma_stream.c
+ * @version     1.0
+ * @date        10/15/2026
+ * @brief       DMA adapters that move UART0 Tx/Rx bytes and ADC0 results.
+ * @remarks     None.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "dma_stream.h"
+#include "Drivers/uart/uart0.h"
+#include "Drivers/adc/adc.h"
+
+/*!
+ * @addtogroup dma driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#if ( DMA_UART0_TX_BUFFER_SIZE & ( DMA_UART0_TX_BUFFER_SIZE - 1U ) ) || \
+	( DMA_UART0_RX_BUFFER_SIZE & ( DMA_UART0_RX_BUFFER_SIZE - 1U ) ) || \
+	( DMA_ADC0_BUFFER_SAMPLES & ( DMA_ADC0_BUFFER_SAMPLES - 1U ) )
+#error "DMA_UART0_TX_BUFFER_SIZE, DMA_UART0_RX_BUFFER_SIZE and DMA_ADC0_BUFFER_SAMPLES must be powers of 2."
+#endif
+
+/*!
+ * @brief Reader of a circular buffer filled by a DMA channel.
+ *
+ * The write index is not stored: it is the channel destination address, so it
+ * is always up to date without any interrupt. The halves completed tell the
+ * laps, so a full buffer is not taken for an empty one and the bytes written
+ * over before being read are detected.
+ */
+typedef struct
+{
+	uint8_t *buffer;            /*!< The circular buffer. */
+	uint16_t size;              /*!< The buffer size in bytes, power of 2. */
+	uint32_t tail;              /*!< Free running read index. */
+	volatile uint32_t halves;   /*!< Halves completed by the channel. */
+	bool overrun;               /*!< If bytes were written over before being read. */
+	uint8_t channel;            /*!< The DMA channel filling the buffer. */
+	dmaCallback_t callback;     /*!< The application callback, or NULL. */
+	void *arg;                  /*!< The application callback argument. */
+}dmaCircularReader_t;
+
+/*!
+ * @brief Single-producer/single-consumer ring drained by a DMA channel.
+ *
+ * The indexes are free running. The head is only written by the application;
+ * the tail and inFlight only in the channel interrupt, or with it disabled.
+ */
+typedef struct
+{
+	volatile uint16_t head;     /*!< Write index. */
+	volatile uint16_t tail;     /*!< Index of the first byte not sent yet. */
+	volatile uint16_t inFlight; /*!< Bytes of the transfer in progress. */
+	uint8_t channel;            /*!< The DMA channel draining the ring. */
+}dmaTxRing_t;
+
+static uint8_t g_dmaUart0TxData[DMA_UART0_TX_BUFFER_SIZE];
+static dmaTxRing_t g_dmaUart0Tx;
+
+static uint8_t g_dmaUart0RxData[DMA_UART0_RX_BUFFER_SIZE];
+static dmaCircularReader_t g_dmaUart0Rx;
+
+static uint16_t g_dmaAdc0Data[DMA_ADC0_BUFFER_SAMPLES];
+static dmaCircularReader_t g_dmaAdc0;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Start the transfer of the next contiguous block of the Tx ring, if idle.
+ *
+ * Must be called from the channel interrupt or with it disabled.
+ */
+static void DMA_Uart0TxKick( void )
+{
+	uint16_t count = g_dmaUart0Tx.head - g_dmaUart0Tx.tail;
+
+	if ( g_dmaUart0Tx.inFlight == 0U && count != 0U )
+	{
+		uint16_t start = g_dmaUart0Tx.tail & ( DMA_UART0_TX_BUFFER_SIZE - 1U );
+		uint16_t block = DMA_UART0_TX_BUFFER_SIZE - start; /* Up to the end of the ring */
+
+		if ( block > count )
+		{
+			block = count;
+		}
+		g_dmaUart0Tx.inFlight = block;
+		DMA_StartTransfer( g_dmaUart0Tx.channel, DMA_MEMORY_TO_PERIPHERAL, &UART0->D,
+				&g_dmaUart0TxData[start], block, DMA_TRANSFER_SIZE_8BIT );
+	}
+}
+
+/**
+ * @brief UART0 Tx channel callback: release the block sent and start the next one.
+ */
+static void DMA_Uart0TxCallback( uint8_t channel, dmaEvent_t event, void *arg )
+{
+	(void)channel;
+	(void)event; /* On error the block is dropped */
+	(void)arg;
+
+	g_dmaUart0Tx.tail += g_dmaUart0Tx.inFlight;
+	g_dmaUart0Tx.inFlight = 0U;
+	DMA_Uart0TxKick();
+}
+
+/**
+ * @brief Circular buffer channel callback: count the halves completed.
+ */
+static void DMA_CircularCallback( uint8_t channel, dmaEvent_t event, void *arg )
+{
+	dmaCircularReader_t *reader = arg;
+
+	if ( event != DMA_EVENT_ERROR )
+	{
+		++reader->halves;
+	}
+	if ( reader->callback != NULL )
+	{
+		reader->callback( channel, event, reader->arg );
+	}
+}
+
+/**
+ * @brief Get the free running write index of a circular buffer.
+ */
+static uint32_t DMA_CircularGetHead( const dmaCircularReader_t *reader )
+{
+	const uint32_t half = reader->size / 2U;
+	uint32_t halves, offset;
+
+	/* The channel interrupt moves the address to the other half */
+	do
+	{
+		halves = reader->halves;
+		offset = DMA_GetDestinationAddress( reader->channel ) - (uint32_t)(uintptr_t)reader->buffer;
+	} while ( halves != reader->halves );
+
+	/* Until the interrupt, the address is at the end of the completed half */
+	return halves * half + offset - ( halves & 1U ) * half;
+}
+
+/**
+ * @brief Get the number of bytes not read in a circular buffer.
+ *
+ * On an overrun the bytes not read are dropped and the overrun flag is set.
+ */
+static size_t DMA_CircularGetCount( dmaCircularReader_t *reader )
+{
+	const uint32_t head = DMA_CircularGetHead( reader );
+
+	if ( head - reader->tail > reader->size )
+	{
+		reader->tail = head;
+		reader->overrun = true;
+	}
+
+	return head - reader->tail;
+}
+
+/**
+ * @brief Read from a circular buffer, a multiple of unit bytes.
+ */
+static size_t DMA_CircularRead( dmaCircularReader_t *reader, uint8_t *data, size_t length, size_t unit )
+{
+	size_t count = DMA_CircularGetCount( reader );
+	size_t i;
+
+	if ( length > count )
+	{
+		length = count;
+	}
+	length -= length % unit;
+	for ( i = 0; i < length; ++i )
+	{
+		data[i] = reader->buffer[( reader->tail + i ) & ( reader->size - 1U )];
+	}
+
+	/* The channel may have written over the first bytes while they were copied */
+	if ( ( length != 0U ) && ( DMA_CircularGetHead( reader ) - reader->tail > reader->size ) )
+	{
+		reader->tail = DMA_CircularGetHead( reader );
+		reader->overrun = true;
+		return 0U;
+	}
+	reader->tail += length;
+
+	return length;
+}
+
+/**
+ * @brief Start a circular buffer reader and its channel.
+ */
+static void DMA_CircularInit( dmaCircularReader_t *reader, uint8_t channel, dmaRequestSource_t source,
+		volatile void *peripheral, void *buffer, uint16_t size, dmaTransferSize_t transferSize,
+		dmaCallback_t callback, void *arg )
+{
+	reader->buffer = (uint8_t*)buffer;
+	reader->size = size;
+	reader->tail = 0U;
+	reader->halves = 0U;
+	reader->overrun = false;
+	reader->channel = channel;
+	reader->callback = callback;
+	reader->arg = arg;
+
+	DMA_InitChannel( channel, source, DMA_CircularCallback, reader );
+	DMA_StartDoubleBuffer( channel, DMA_PERIPHERAL_TO_MEMORY, peripheral, buffer, size, transferSize );
+}
+
+/**
+ * @brief Tell and clear the overrun flag of a circular buffer.
+ */
+static bool DMA_CircularGetOverrun( dmaCircularReader_t *reader )
+{
+	bool overrun;
+
+	DMA_CircularGetCount( reader );
+	overrun = reader->overrun;
+	reader->overrun = false;
+
+	return overrun;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void DMA_Uart0TxInit( uint8_t channel )
+{
+	g_dmaUart0Tx.head = g_dmaUart0Tx.tail = g_dmaUart0Tx.inFlight = 0U;
+	g_dmaUart0Tx.channel = channel;
+
+	DMA_InitChannel( channel, DMA_SOURCE_UART0_TX, DMA_Uart0TxCallback, NULL );
+
+	/* With TDMAE set, TDRE asserts a DMA request instead of the Tx interrupt */
+	UART0->C5 |= UART0_C5_TDMAE_MASK;
+	UART0->C2 |= UART0_C2_TIE_MASK;
+}
+
+/**********************************************************************************/
+size_t DMA_Uart0GetTxFree( void )
+{
+	return DMA_UART0_TX_BUFFER_SIZE - (uint16_t)( g_dmaUart0Tx.head - g_dmaUart0Tx.tail );
+}
+
+/**********************************************************************************/
+size_t DMA_Uart0WriteBlock( const uint8_t *data, size_t length )
+{
+	size_t space = DMA_Uart0GetTxFree();
+	uint16_t head = g_dmaUart0Tx.head;
+	IRQn_Type irq = (IRQn_Type)( DMA0_IRQn + g_dmaUart0Tx.channel );
+	size_t i;
+
+	if ( length > space )
+	{
+		length = space;
+	}
+	for ( i = 0; i < length; ++i )
+	{
+		g_dmaUart0TxData[( head + i ) & ( DMA_UART0_TX_BUFFER_SIZE - 1U )] = data[i];
+	}
+	g_dmaUart0Tx.head = head + length;
+
+	NVIC_DisableIRQ( irq );
+	DMA_Uart0TxKick();
+	NVIC_EnableIRQ( irq );
+
+	return length;
+}
+
+/**********************************************************************************/
+void DMA_Uart0WriteByte( const uint8_t data )
+{
+	DMA_Uart0WriteBlock( &data, 1U );
+}
+
+/**********************************************************************************/
+void DMA_Uart0RxInit( uint8_t channel )
+{
+	DMA_CircularInit( &g_dmaUart0Rx, channel, DMA_SOURCE_UART0_RX, &UART0->D,
+			g_dmaUart0RxData, DMA_UART0_RX_BUFFER_SIZE, DMA_TRANSFER_SIZE_8BIT, NULL, NULL );
+
+	/* With RDMAE set, RDRF asserts a DMA request instead of the Rx interrupt */
+	UART0_CleanRxBuffer();
+	UART0->C5 |= UART0_C5_RDMAE_MASK;
+	UART0->C2 |= UART0_C2_RIE_MASK;
+}
+
+/**********************************************************************************/
+size_t DMA_Uart0GetRxCount( void )
+{
+	return DMA_CircularGetCount( &g_dmaUart0Rx );
+}
+
+/**********************************************************************************/
+size_t DMA_Uart0ReadBlock( uint8_t *data, size_t length )
+{
+	return DMA_CircularRead( &g_dmaUart0Rx, data, length, 1U );
+}
+
+/**********************************************************************************/
+bool DMA_Uart0GetRxOverrun( void )
+{
+	return DMA_CircularGetOverrun( &g_dmaUart0Rx );
+}
+
+/**********************************************************************************/
+uint8_t DMA_Uart0ReadByte( void )
+{
+	uint8_t data = 0U;
+
+	DMA_CircularRead( &g_dmaUart0Rx, &data, 1U, 1U );
+
+	return data;
+}
+
+/**********************************************************************************/
+void DMA_Adc0Init( uint8_t channel, dmaCallback_t callback, void *arg )
+{
+	DMA_CircularInit( &g_dmaAdc0, channel, DMA_SOURCE_ADC0, (volatile void*)&ADC0->R[0],
+			g_dmaAdc0Data, sizeof( g_dmaAdc0Data ), DMA_TRANSFER_SIZE_16BIT, callback, arg );
+
+	ADC_EnableDMA( ADC0 );
+}
+
+/**********************************************************************************/
+const uint16_t *DMA_Adc0GetSamples( dmaEvent_t event )
+{
+	return ( event == DMA_EVENT_HALF_COMPLETE ) ?
+			&g_dmaAdc0Data[0] : &g_dmaAdc0Data[DMA_ADC0_BUFFER_SAMPLES / 2U];
+}
+
+/**********************************************************************************/
+size_t DMA_Adc0GetBytesToRead( void )
+{
+	return DMA_CircularGetCount( &g_dmaAdc0 );
+}
+
+/**********************************************************************************/
+size_t DMA_Adc0ReadBlock( uint8_t *data, size_t length )
+{
+	/* Whole samples only */
+	return DMA_CircularRead( &g_dmaAdc0, data, length, sizeof( uint16_t ) );
+}
+
+/**********************************************************************************/
+bool DMA_Adc0GetOverrun( void )
+{
+	return DMA_CircularGetOverrun( &g_dmaAdc0 );
+}
+
+/**********************************************************************************/
+uint8_t DMA_Adc0ReadByte( void )
+{
+	uint8_t data = 0U;
+
+	DMA_CircularRead( &g_dmaAdc0, &data, 1U, 1U );
+
+	return data;
+}
+
+/*! @}*/
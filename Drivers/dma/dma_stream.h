@@ -0,0 +1,196 @@
+/***************************************************************************************
+ * @file        dma_stream.h
+ * @version     1.0
+ * @date        10/15/2026
+ * @brief       DMA adapters that move UART0 Tx/Rx bytes and ADC0 results without CPU
+ *              intervention per byte. The functions have the same signatures as the
+ *              Stream callbacks, so they can be passed directly to a streamConfig_t.
+ * @remarks     The UART0 adapters replace the UART0 buffered mode: do not call
+ *              UART0_EnableBufferedMode when they are in use.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef DMA_STREAM_DRV_H_
+#define DMA_STREAM_DRV_H_
+
+#include <common.h>
+#include "dma.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @addtogroup dma driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< The UART0 Tx buffer size in bytes. Must be a power of 2. */
+#define DMA_UART0_TX_BUFFER_SIZE 64U
+/*!< The UART0 Rx circular buffer size in bytes (two halves). Must be a power of 2. */
+#define DMA_UART0_RX_BUFFER_SIZE 64U
+/*!< The ADC0 circular buffer size in samples (two halves). Must be a power of 2. */
+#define DMA_ADC0_BUFFER_SAMPLES 32U
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Start the UART0 Tx adapter.
+ *
+ * The bytes written are copied to a ring buffer and the DMA channel sends the
+ * largest contiguous block at a time, so the application keeps filling the
+ * ring while the previous block is being sent.
+ *
+ * @param channel - the DMA channel reserved for UART0 Tx.
+ *
+ * @note This function should be called after the UART0_Init and DMA_Init.
+ */
+void DMA_Uart0TxInit( uint8_t channel );
+
+/**
+ * @brief Get the free space in the UART0 Tx buffer.
+ *
+ * @return The number of bytes that can be written.
+ */
+size_t DMA_Uart0GetTxFree( void );
+
+/**
+ * @brief Write a block of bytes to UART0 through DMA, without blocking.
+ *
+ * @param data - a pointer to the bytes to be sent.
+ * @param length - the number of bytes to be sent.
+ *
+ * @return The number of bytes actually copied to the Tx buffer.
+ */
+size_t DMA_Uart0WriteBlock( const uint8_t *data, size_t length );
+
+/**
+ * @brief Write a byte to UART0 through DMA.
+ *
+ * @param data - the byte to be sent. It is dropped if the Tx buffer is full.
+ */
+void DMA_Uart0WriteByte( const uint8_t data );
+
+/**
+ * @brief Start the UART0 Rx adapter.
+ *
+ * The DMA channel fills a circular double buffer continuously. The application
+ * must read the bytes before the channel wraps around to them, or they are lost
+ * (see DMA_Uart0GetRxOverrun).
+ *
+ * @param channel - the DMA channel reserved for UART0 Rx.
+ *
+ * @note This function should be called after the UART0_Init and DMA_Init.
+ */
+void DMA_Uart0RxInit( uint8_t channel );
+
+/**
+ * @brief Get the number of bytes received and not read yet.
+ *
+ * @return The number of bytes that can be read.
+ */
+size_t DMA_Uart0GetRxCount( void );
+
+/**
+ * @brief Read a block of received bytes, without blocking.
+ *
+ * @param data - a pointer to the destination buffer.
+ * @param length - the maximum number of bytes to read.
+ *
+ * @return The number of bytes actually read.
+ */
+size_t DMA_Uart0ReadBlock( uint8_t *data, size_t length );
+
+/**
+ * @brief Read a received byte.
+ *
+ * @return The byte read, or 0 if there is nothing to read.
+ */
+uint8_t DMA_Uart0ReadByte( void );
+
+/**
+ * @brief Verify if received bytes were lost, and clear the indication.
+ *
+ * When the channel writes over bytes not read yet, all the bytes not read are
+ * dropped and reading starts again from the next byte received.
+ *
+ * @return true if bytes were lost since the last call.
+ */
+bool DMA_Uart0GetRxOverrun( void );
+
+/**
+ * @brief Start the ADC0 adapter.
+ *
+ * The DMA channel copies every ADC0 result (R[0]) to a circular double buffer
+ * of 16-bit samples. The callback is called from the DMA interrupt when each
+ * half is full; use DMA_Adc0GetSamples to get the completed half. The ADC0
+ * must be configured (channel, continuous conversion or hardware trigger) by
+ * the application.
+ *
+ * @param channel - the DMA channel reserved for ADC0.
+ * @param callback - the half/full complete callback, or NULL.
+ * @param arg - an argument passed to the callback.
+ *
+ * @note This function should be called after the ADC_Init and DMA_Init.
+ */
+void DMA_Adc0Init( uint8_t channel, dmaCallback_t callback, void *arg );
+
+/**
+ * @brief Get the half of the ADC0 buffer completed in an event.
+ *
+ * @param event - DMA_EVENT_HALF_COMPLETE or DMA_EVENT_FULL_COMPLETE.
+ *
+ * @return A pointer to DMA_ADC0_BUFFER_SAMPLES / 2 samples.
+ */
+const uint16_t *DMA_Adc0GetSamples( dmaEvent_t event );
+
+/**
+ * @brief Get the number of bytes of ADC0 samples not read yet.
+ *
+ * Samples are read as little-endian byte pairs.
+ *
+ * @return The number of bytes that can be read.
+ */
+size_t DMA_Adc0GetBytesToRead( void );
+
+/**
+ * @brief Read a block of ADC0 sample bytes, without blocking.
+ *
+ * @param data - a pointer to the destination buffer.
+ * @param length - the maximum number of bytes to read. Only whole samples are
+ *                 read: an odd length is rounded down.
+ *
+ * @return The number of bytes actually read.
+ */
+size_t DMA_Adc0ReadBlock( uint8_t *data, size_t length );
+
+/**
+ * @brief Read an ADC0 sample byte.
+ *
+ * @return The byte read, or 0 if there is nothing to read.
+ */
+uint8_t DMA_Adc0ReadByte( void );
+
+/**
+ * @brief Verify if ADC0 samples were lost, and clear the indication.
+ *
+ * When the channel writes over samples not read yet, all the samples not read
+ * are dropped and reading starts again from the next sample.
+ *
+ * @return true if samples were lost since the last call.
+ */
+bool DMA_Adc0GetOverrun( void );
+
+/*! @}*/
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* DMA_STREAM_DRV_H_ */
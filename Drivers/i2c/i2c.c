@@ -38,147 +38,505 @@
 #define I2C_POST_INIT						\
 {											\
 	/** Activates I2C module */				\
-	base->C1 = 1 << 7;						\
+	base->C1 = I2C_C1_IICEN_MASK;			\
+	/** Starts the transaction engine */	\
+	I2C_EngineInit(base);					\
 }
 
 /**
- * @def I2C_START_SLAVE_TRANSMISSION(op)
- * @brief Start a transmission to a slave with a given operation.
- * @param op 0 if starting a write operation, 1 if starting a read operation.
+ * @brief SCL divider for each ICR value, from the reference manual.
  */
-#define I2C_START_SLAVE_TRANSMISSION(op)									\
-{																			\
-	/**
-	 * Puts the I2C module in transmitter and master mode and puts the Start
-	 * condition on the bus
-	 */																		\
-	I2C_Start(base);														\
-	/**
-	 * Sends the 7 bits slave address and last bit as 0 signaling a write op
-	 */																		\
-	I2C_WriteByte(base, (uint8_t)((slave_addr << 1) | op));					\
-	/** Waits and checks for timeout */										\
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;						\
-	/** Checks for invalid address */										\
-	if (I2C_GetRxAk(base)) return SYSTEM_STATUS_INVALID_ADDRESS;			\
+static const uint16_t _sclDividers[64] = {
+	20U, 22U, 24U, 26U, 28U, 30U, 34U, 40U,
+	28U, 32U, 36U, 40U, 44U, 48U, 56U, 68U,
+	48U, 56U, 64U, 72U, 80U, 88U, 104U, 128U,
+	80U, 96U, 112U, 128U, 144U, 160U, 192U, 240U,
+	160U, 192U, 224U, 256U, 288U, 320U, 384U, 480U,
+	320U, 384U, 448U, 512U, 576U, 640U, 768U, 960U,
+	640U, 768U, 896U, 1024U, 1152U, 1280U, 1536U, 1920U,
+	1280U, 1536U, 1792U, 2048U, 2304U, 2560U, 3072U, 3840U
+};
+
+/**
+ * @brief States of the transaction engine.
+ */
+typedef enum
+{
+	I2C_ENGINE_IDLE,          /**< No transaction running */
+	I2C_ENGINE_WAIT_STOP,     /**< Next transaction waiting for the bus to be free */
+	I2C_ENGINE_ADDRESS_WRITE, /**< Slave address sent for writing */
+	I2C_ENGINE_REGISTER,      /**< Register address sent */
+	I2C_ENGINE_TX,            /**< Data byte sent */
+	I2C_ENGINE_ADDRESS_READ,  /**< Slave address sent for reading */
+	I2C_ENGINE_RX             /**< Receiving data bytes */
+} i2cEngineState_t;
+
+/**
+ * @brief The transaction engine of the I2C0 module.
+ *
+ * The queue is a linked list of the caller descriptors, the first one is the
+ * transaction running. It is only modified by I2C0_IRQHandler or with the
+ * interrupts masked (PRIMASK).
+ *
+ * Every transaction is run as a list of segments: a register transaction is a
+ * write segment (register address and tx_data) and a read segment (rx_data).
+ */
+typedef struct
+{
+	I2C_Type *base;             /**< The I2C module */
+	i2cTransaction_t *head;     /**< Running transaction */
+	i2cTransaction_t *tail;     /**< Last queued transaction */
+	i2cEngineState_t state;     /**< State of the running transaction */
+	i2cSegment_t segment;       /**< Current segment of the running transaction */
+	size_t segmentIndex;        /**< Index of the current segment */
+	uint16_t index;             /**< Index of the current tx/rx byte in the segment */
+	volatile uint32_t progress; /**< Incremented on each bus event, used for timeouts */
+} i2cEngine_t;
+
+static i2cEngine_t g_i2cEngine;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Returns the bus clock, that feeds the I2C module, in [Hz].
+ */
+static uint32_t I2C_GetBusClock(void)
+{
+	return SystemCoreClock / (((SIM->CLKDIV1 & SIM_CLKDIV1_OUTDIV4_MASK) >> SIM_CLKDIV1_OUTDIV4_SHIFT) + 1U);
 }
 
 /**
- * @def I2C_START_ADDRESS_TRANSMISSION
- * @brief Send a given register address after sending the slave address.
+ * @brief Resets the engine and enables the I2C interrupt.
  */
-#define I2C_START_REGISTER_TRANSMISSION										\
-{																			\
-	/** Sends the register address byte */									\
-	I2C_WriteByte(base, register_addr);										\
-	/** Waits and checks for timeout */										\
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;						\
-	/** Checks for invalid register */										\
-	if (I2C_GetRxAk(base)) return SYSTEM_STATUS_INVALID_REGISTER;			\
+static void I2C_EngineInit(I2C_Type *base)
+{
+	g_i2cEngine.base = base;
+	g_i2cEngine.head = g_i2cEngine.tail = NULL;
+	g_i2cEngine.state = I2C_ENGINE_IDLE;
+
+	base->S = I2C_S_IICIF_MASK | I2C_S_ARBL_MASK;
+	base->FLT = (base->FLT & ~I2C_FLT_STOPIE_MASK) | I2C_FLT_STOPF_MASK;
+	base->C1 |= I2C_C1_IICIE_MASK;
+	NVIC_EnableIRQ(I2C0_IRQn);
 }
 
 /**
- * @def I2C_REPEATED_START_CONDITION
- * @brief Execute all steps to put the I2C bus into a repeated start condition.
+ * @brief Generates a repeated start condition.
+ *
+ * Some Kinetis I2C modules do not generate the repeated start while F[MULT]
+ * is not zero, so MULT is cleared while RSTA is set, as done by the NXP SDK.
  */
-#define I2C_REPEATED_START_CONDITION										\
-{																			\
-	/**
-	 * Initiates the repeated start condition to avoid other master to get
-	 * the bus and specify the slave that wants to be read
-	 */																		\
-	I2C_RepeatedStart(base);												\
-	/**
-	 * Sends the 7 bits slave address and last bit as 1 signaling a read op
-	 */																		\
-	I2C_WriteByte(base, (uint8_t)((slave_addr << 1) | 1));					\
-	/** Waits and checks for timeout */										\
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;						\
-	/** Checks for invalid address */										\
-	if (I2C_GetRxAk(base)) return SYSTEM_STATUS_INVALID_ADDRESS;			\
+static void I2C_EngineRepeatedStart(I2C_Type *base)
+{
+	const uint8_t f = base->F;
+
+	base->F = f & ~I2C_F_MULT_MASK;
+	I2C_RepeatedStart(base);
+	base->F = f;
+}
+
+/**
+ * @brief Loads the n-th segment of a transaction in the engine.
+ *
+ * @return false if the transaction has no such segment.
+ */
+static bool I2C_EngineLoadSegment(const i2cTransaction_t *transaction, size_t n)
+{
+	i2cSegment_t *segment = &g_i2cEngine.segment;
+	const bool has_write = transaction->use_register || (transaction->tx_size != 0);
+
+	if (transaction->segments != NULL)
+	{
+		if (n >= transaction->segment_count)
+		{
+			return false;
+		}
+		*segment = transaction->segments[n];
+	}
+	else if ((n == 0) && has_write)
+	{
+		segment->direction = I2C_SEGMENT_WRITE;
+		segment->tx_data = transaction->tx_data;
+		segment->rx_data = NULL;
+		segment->size = transaction->tx_size;
+	}
+	else if ((n == (has_write ? 1U : 0U)) && (transaction->rx_size != 0))
+	{
+		segment->direction = I2C_SEGMENT_READ;
+		segment->tx_data = NULL;
+		segment->rx_data = transaction->rx_data;
+		segment->size = transaction->rx_size;
+	}
+	else
+	{
+		return false;
+	}
+
+	if (transaction->segments == NULL)
+	{
+		segment->slave_addr = transaction->slave_addr;
+	}
+	/** The receiver NACKs the byte at size - 1: a read needs at least one byte */
+	SYSTEM_ASSERT((segment->direction != I2C_SEGMENT_READ) || (segment->size >= 1));
+
+	return true;
+}
+
+/**
+ * @brief Starts the loaded segment: START, or repeated START if the bus is
+ *        already owned, and the slave address.
+ */
+static void I2C_EngineStartSegment(I2C_Type *base)
+{
+	const i2cSegment_t *segment = &g_i2cEngine.segment;
+
+	if (base->C1 & I2C_C1_MST_MASK)
+	{
+		I2C_EngineRepeatedStart(base);
+	}
+	else
+	{
+		I2C_Start(base);
+	}
+
+	g_i2cEngine.index = 0;
+	if (segment->direction == I2C_SEGMENT_READ)
+	{
+		I2C_WriteByte(base, (uint8_t)((segment->slave_addr << 1) | 1));
+		g_i2cEngine.state = I2C_ENGINE_ADDRESS_READ;
+	}
+	else
+	{
+		I2C_WriteByte(base, (uint8_t)(segment->slave_addr << 1));
+		g_i2cEngine.state = I2C_ENGINE_ADDRESS_WRITE;
+	}
+}
+
+/**
+ * @brief Removes the running transaction from the queue and starts the next one.
+ *
+ * @param status Result of the running transaction.
+ * @param notify If the transaction callback must be called.
+ */
+static void I2C_EngineFinish(uint8_t status, bool notify);
+
+/**
+ * @brief Disables the stop detection interrupt and clears its flags.
+ */
+static void I2C_EngineStopWaitingBus(I2C_Type *base)
+{
+	base->FLT = (base->FLT & ~I2C_FLT_STOPIE_MASK) | I2C_FLT_STOPF_MASK;
+	base->S = I2C_S_IICIF_MASK;
 }
 
+/**
+ * @brief Starts the first queued transaction, if any.
+ *
+ * If the bus is still busy, e.g. with the STOP of the previous transaction,
+ * the transaction is started by the stop detection interrupt instead of
+ * waiting for it here.
+ */
+static void I2C_EngineStartNext(void)
+{
+	I2C_Type *base = g_i2cEngine.base;
+	i2cTransaction_t *transaction = g_i2cEngine.head;
+
+	if (transaction == NULL)
+	{
+		g_i2cEngine.state = I2C_ENGINE_IDLE;
+		I2C_EngineStopWaitingBus(base);
+		return;
+	}
+
+	g_i2cEngine.segmentIndex = 0;
+	if (!I2C_EngineLoadSegment(transaction, 0))
+	{
+		/** Nothing to transfer */
+		I2C_EngineFinish(SYSTEM_STATUS_SUCCESS, true);
+		return;
+	}
+
+	/** STOPF is cleared before BUSY is read, so a STOP ending in between still raises the interrupt */
+	base->FLT |= I2C_FLT_STOPF_MASK | I2C_FLT_STOPIE_MASK;
+	if (base->S & I2C_S_BUSY_MASK)
+	{
+		g_i2cEngine.state = I2C_ENGINE_WAIT_STOP;
+		return;
+	}
+	I2C_EngineStopWaitingBus(base);
+
+	I2C_EnableAck(base);
+	I2C_EngineStartSegment(base);
+}
+
+/**********************************************************************************/
+static void I2C_EngineFinish(uint8_t status, bool notify)
+{
+	I2C_Type *base = g_i2cEngine.base;
+	i2cTransaction_t *transaction = g_i2cEngine.head;
+
+	/** Puts the Stop condition on the bus, if not done yet */
+	if (base->C1 & I2C_C1_MST_MASK)
+	{
+		I2C_Stop(base);
+	}
+
+	g_i2cEngine.head = transaction->next;
+	if (g_i2cEngine.head == NULL)
+	{
+		g_i2cEngine.tail = NULL;
+	}
+	transaction->next = NULL;
+	transaction->status = status;
+	g_i2cEngine.state = I2C_ENGINE_IDLE;
+
+	if (notify && (transaction->callback != NULL))
+	{
+		transaction->callback(transaction);
+	}
+
+	/** The callback may have submitted, and so started, a transaction */
+	if (g_i2cEngine.state == I2C_ENGINE_IDLE)
+	{
+		I2C_EngineStartNext();
+	}
+}
+
+/**
+ * @brief Sends the next byte of a write segment, or starts the next segment.
+ */
+static void I2C_EngineWriteNext(I2C_Type *base, const i2cTransaction_t *transaction)
+{
+	if (g_i2cEngine.index < g_i2cEngine.segment.size)
+	{
+		I2C_WriteByte(base, g_i2cEngine.segment.tx_data[g_i2cEngine.index++]);
+		g_i2cEngine.state = I2C_ENGINE_TX;
+	}
+	else if (I2C_EngineLoadSegment(transaction, ++g_i2cEngine.segmentIndex))
+	{
+		I2C_EngineStartSegment(base);
+	}
+	else
+	{
+		I2C_EngineFinish(SYSTEM_STATUS_SUCCESS, true);
+	}
+}
+
+/**
+ * @brief Processes one bus event (IICIF) of the running transaction.
+ */
+static void I2C_EngineStep(void)
+{
+	I2C_Type *base = g_i2cEngine.base;
+	i2cTransaction_t *transaction = g_i2cEngine.head;
+	const uint16_t size = g_i2cEngine.segment.size;
+
+	/** Clears the interrupt flag */
+	base->S = I2C_S_IICIF_MASK;
+	++g_i2cEngine.progress;
+
+	if ((transaction == NULL) || (g_i2cEngine.state == I2C_ENGINE_IDLE))
+	{
+		return;
+	}
+
+	if (g_i2cEngine.state == I2C_ENGINE_WAIT_STOP)
+	{
+		/** Stop detection interrupt: starts the transaction once the bus is free */
+		if (!(base->S & I2C_S_BUSY_MASK))
+		{
+			I2C_EngineStopWaitingBus(base);
+			I2C_EnableAck(base);
+			I2C_EngineStartSegment(base);
+		}
+		return;
+	}
+
+	if (I2C_GetArbLost(base))
+	{
+		/** The module is already back to slave mode */
+		base->S = I2C_S_ARBL_MASK;
+		I2C_EngineFinish(SYSTEM_STATUS_TRANSFER_FAIL, true);
+		return;
+	}
+
+	switch (g_i2cEngine.state)
+	{
+	case I2C_ENGINE_ADDRESS_WRITE:
+		if (I2C_GetRxAk(base))
+		{
+			I2C_EngineFinish(SYSTEM_STATUS_INVALID_ADDRESS, true);
+		}
+		else if ((transaction->segments == NULL) && transaction->use_register)
+		{
+			I2C_WriteByte(base, transaction->register_addr);
+			g_i2cEngine.state = I2C_ENGINE_REGISTER;
+		}
+		else
+		{
+			I2C_EngineWriteNext(base, transaction);
+		}
+		break;
+
+	case I2C_ENGINE_REGISTER:
+		if (I2C_GetRxAk(base))
+		{
+			I2C_EngineFinish(SYSTEM_STATUS_INVALID_REGISTER, true);
+		}
+		else
+		{
+			I2C_EngineWriteNext(base, transaction);
+		}
+		break;
+
+	case I2C_ENGINE_TX:
+		if (I2C_GetRxAk(base))
+		{
+			I2C_EngineFinish(SYSTEM_STATUS_TRANSFER_FAIL, true);
+		}
+		else
+		{
+			I2C_EngineWriteNext(base, transaction);
+		}
+		break;
+
+	case I2C_ENGINE_ADDRESS_READ:
+		if (I2C_GetRxAk(base))
+		{
+			I2C_EngineFinish(SYSTEM_STATUS_INVALID_ADDRESS, true);
+			break;
+		}
+		/** Changes to receiver mode, NACK only the last byte */
+		I2C_SetRxMode(base);
+		if (size == 1)
+		{
+			I2C_DisableAck(base);
+		}
+		else
+		{
+			I2C_EnableAck(base);
+		}
+		g_i2cEngine.state = I2C_ENGINE_RX;
+		/** Performs the dummy read that starts the reception */
+		(void)I2C_ReadByte(base);
+		break;
+
+	case I2C_ENGINE_RX:
+		if (g_i2cEngine.index == size - 1)
+		{
+			uint8_t *last = &g_i2cEngine.segment.rx_data[g_i2cEngine.index];
+
+			if (I2C_EngineLoadSegment(transaction, ++g_i2cEngine.segmentIndex))
+			{
+				/** Keeps the bus: in transmitter mode, reading the last byte does not start another reception */
+				I2C_SetTxMode(base);
+				*last = I2C_ReadByte(base);
+				I2C_EnableAck(base);
+				I2C_EngineStartSegment(base);
+			}
+			else
+			{
+				/** Sends the stop condition before reading the last byte */
+				I2C_Stop(base);
+				*last = I2C_ReadByte(base);
+				I2C_EngineFinish(SYSTEM_STATUS_SUCCESS, true);
+			}
+		}
+		else
+		{
+			if (g_i2cEngine.index == size - 2)
+			{
+				/** Signals to the slave to not send more data after the next byte */
+				I2C_DisableAck(base);
+			}
+			g_i2cEngine.segment.rx_data[g_i2cEngine.index++] = I2C_ReadByte(base);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
 /**
  * @brief Initializes the I2C module using a given baud rate.
  * 
  * @param base I2C mem map of the I2C module to be initialized.
  * @param baud_rate Baud rate to initialize I2C module in [bps].
  * 
- * @return SYSTEM_STATUS_SUCCESS if the requested baud rate in [bps] was achievable, otherwise SYSTEM_STATUS_FAIL.
+ * The fastest baud rate at or below the requested one is selected among all
+ * the ICR/MULT pairs, so the nearest rate is set when the requested one is not
+ * exactly achievable. Use I2C_GetBaudRate to get the rate actually set.
+ * 
+ * @return SYSTEM_STATUS_SUCCESS if a baud rate at or below the requested one was achievable,
+ *         otherwise (the request is slower than the slowest configuration) SYSTEM_STATUS_FAIL.
  */
 uint8_t I2C_InitWithBaud(I2C_Type *base, uint32_t baud_rate)
 {
+	const uint32_t bus_clock = I2C_GetBusClock();
+	uint32_t best_divider = UINT32_MAX;
+	uint8_t best_icr = 0;
+	uint8_t best_mult = 0;
+
 	/** Pre initialization steps */
 	I2C_PRE_INIT
 
-	/** ICR values from reference manual */
-	const static uint8_t icr_indexes[] = {
-		0x10U, 0x11U, 0x12U, 0x13U, 0x14U, 0x15U,
-		0x19U, 0x16U, 0x1AU, 0x17U, 0x1CU, 0x1DU,
-		0x1EU, 0x22U, 0x1FU, 0x23U, 0x24U, 0x25U,
-		0x26U, 0x27U, 0x28U, 0x29U, 0x2AU, 0x2BU,
-		0x2CU, 0x2DU, 0x2EU, 0x2FU, 0x30U, 0x31U,
-		0x32U, 0x33U, 0x34U, 0x35U, 0x36U, 0x3AU,
-		0x37U, 0x3BU, 0x3CU, 0x3DU, 0x3EU, 0x3FU
-	};
-
-	/** SCL divider for the aligned icr_index */
-	const static uint16_t scl_dividers[] = {
-		48U, 56U, 64U, 72U, 80U, 88U,
-		96U, 104U, 112U, 128U, 144U, 160U,
-		192U, 224U, 240U, 256U, 288U, 320U,
-		384U, 480U, 320U, 384U, 448U, 512U,
-		576U, 640U, 768U, 960U, 640U, 768U,
-		896U, 1024U, 1152U, 1280U, 1536U, 1792U,
-		1920U, 2048U, 2304U, 2560U, 3072U, 3840U
-	};
-
 	/**
 	 * baud_rate = bus speed (Hz) / (mult * SCL divider)
-	 * SCL divider = bus speed (Hz) / (mult * baud_rate)
+	 *
+	 * Searches all the MULT/ICR pairs for the smallest total divider that
+	 * does not exceed the requested baud rate. On ties the smallest MULT
+	 * is kept.
+	 *
+	 * MULT values are:
+	 *  - mask(00) = mult(1) = 1 << 0
+	 *  - mask(01) = mult(2) = 1 << 1
+	 *  - mask(10) = mult(4) = 1 << 2
 	 */
-
-	/** For multipliers 1, 2, 4 */
-	for (uint8_t mult = 1; mult <= 4; mult *= 2)
+	for (uint8_t mult = 0; mult <= 2; ++mult)
 	{
-		const uint32_t scl_divider = SystemCoreClock / (baud_rate * mult);
-
-		/** scl_divider must be greater of equal to minimum available divider */
-		if (scl_divider < scl_dividers[0]) return SYSTEM_STATUS_FAIL;
-
-		/** scl_divider is greater than all available dividers, increase mult */
-		if (
-			scl_divider > scl_dividers[
-				(sizeof(scl_dividers) / sizeof(scl_dividers[0])) - 1
-			]
-		) continue;
-
-		/** Searches for a valid SCL divider fit */
-		for (uint8_t j = 0; j < sizeof(scl_dividers) / sizeof(scl_dividers[0]); ++j)
+		for (uint8_t icr = 0; icr < sizeof(_sclDividers) / sizeof(_sclDividers[0]); ++icr)
 		{
-			/** Valid configuration */
-			if (scl_dividers[j] == scl_divider)
+			const uint32_t divider = (uint32_t)_sclDividers[icr] << mult;
+
+			if (
+				(divider < best_divider) &&
+				((uint64_t)baud_rate * divider >= bus_clock)
+			)
 			{
-				/**
-				 * Applies the selected ICR and MULT
-				 * 
-				 * MULT values are:
-				 *  - mask(00) = mult(1) = mult(0b001) = mask(mult(0b001) >> 1)
-				 *  - mask(01) = mult(2) = mult(0b010) = mask(mult(0b010) >> 1)
-				 *  - mask(10) = mult(4) = mult(0b100) = mask(mult(0b100) >> 1)
-				 */
-				base->F = I2C_F_ICR(icr_indexes[j]) | I2C_F_MULT(mult >> 1);
-
-				/** Post initialization steps */
-				I2C_POST_INIT
-
-				return SYSTEM_STATUS_SUCCESS;
+				best_divider = divider;
+				best_icr = icr;
+				best_mult = mult;
 			}
 		}
 	}
 
-	/** No configuration found */
-	return SYSTEM_STATUS_FAIL;
+	/** The requested baud rate is slower than the slowest configuration */
+	if (best_divider == UINT32_MAX) return SYSTEM_STATUS_FAIL;
+
+	/** Applies the selected ICR and MULT */
+	base->F = I2C_F_ICR(best_icr) | I2C_F_MULT(best_mult);
+
+	/** Fast mode plus requires the high drive pads */
+	if ((bus_clock / best_divider) > 400000U)
+	{
+		base->C2 |= I2C_C2_HDRS_MASK;
+	}
+	else
+	{
+		base->C2 &= ~I2C_C2_HDRS_MASK;
+	}
+
+	/** Post initialization steps */
+	I2C_POST_INIT
+
+	return SYSTEM_STATUS_SUCCESS;
 }
 
 
@@ -188,9 +546,8 @@ uint8_t I2C_InitWithBaud(I2C_Type *base, uint32_t baud_rate)
  * @param base I2C mem map of the I2C module to be initialized.
  * 
  * @return \a SYSTEM_STATUS_SUCCESS if 100 [kbps] baud rate was set successfully.
- *         \a SYSTEM_STATUS_FAIL in case of any error when trying
- *             to set this speed or if this speed was not possible to be set
- *             with current bus clock speed.
+ *         \a SYSTEM_STATUS_SUCCESS with the fastest rate below 100 [kbps] if it
+ *             is not exactly achievable with the current bus clock.
  */
 uint8_t I2C_Init(I2C_Type *base)
 {
@@ -204,9 +561,8 @@ uint8_t I2C_Init(I2C_Type *base)
  * @param base I2C mem map of the I2C module to be initialized.
  * 
  * @return \a SYSTEM_STATUS_SUCCESS if 400 [kbps] baud rate was set successfully.
- *         \a SYSTEM_STATUS_FAIL in case  of any error when trying to set
- *             this speed or if this speed was not possible to be set with current
- *             bus clock speed.
+ *         \a SYSTEM_STATUS_SUCCESS with the fastest rate below 400 [kbps] if it
+ *             is not exactly achievable with the current bus clock.
  */
 uint8_t I2C_Init_400kbps(I2C_Type *base)
 {
@@ -214,6 +570,34 @@ uint8_t I2C_Init_400kbps(I2C_Type *base)
 }
 
 
+/**
+ * @brief Initializes the I2C module using the fast mode plus with a fixed baud rate of 1 [Mbps].
+ * 
+ * @param base I2C mem map of the I2C module to be initialized.
+ * 
+ * @return \a SYSTEM_STATUS_SUCCESS if 1 [Mbps] baud rate was set successfully.
+ *         \a SYSTEM_STATUS_FAIL if the bus clock is not fast enough for
+ *             this speed. In this case the module is not changed.
+ */
+uint8_t I2C_Init_1Mbps(I2C_Type *base)
+{
+	/** The smallest SCL divider is 20 */
+	if (I2C_GetBusClock() < (1000000U * _sclDividers[0])) return SYSTEM_STATUS_FAIL;
+
+	return I2C_InitWithBaud(base, 1000000);
+}
+
+
+/**********************************************************************************/
+uint32_t I2C_GetBaudRate(I2C_Type *base)
+{
+	const uint8_t icr = (base->F & I2C_F_ICR_MASK) >> I2C_F_ICR_SHIFT;
+	const uint8_t mult = (base->F & I2C_F_MULT_MASK) >> I2C_F_MULT_SHIFT;
+
+	return I2C_GetBusClock() / ((uint32_t)_sclDividers[icr] << mult);
+}
+
+
 /**
  * @brief Initializes the I2C module using given ICR and MULT values.
  * 
@@ -247,6 +631,204 @@ void I2C_InitManual(I2C_Type *base, uint8_t icr, uint8_t mult)
 	I2C_POST_INIT
 }
 
+/**********************************************************************************/
+uint8_t I2C_Submit(I2C_Type *base, i2cTransaction_t *transaction)
+{
+	uint8_t status = SYSTEM_STATUS_SUCCESS;
+	/** PRIMASK, not only the I2C0 interrupt: a higher priority handler may submit too */
+	const uint32_t primask = __get_PRIMASK();
+
+	SYSTEM_ASSERT(base == g_i2cEngine.base);
+	SYSTEM_ASSERT(transaction);
+
+	__disable_irq();
+
+	/** The status of a new descriptor is not initialized: the queue tells if it is already submitted */
+	for (const i2cTransaction_t *queued = g_i2cEngine.head; queued != NULL; queued = queued->next)
+	{
+		if (queued == transaction)
+		{
+			status = SYSTEM_STATUS_BUSY;
+			break;
+		}
+	}
+
+	if (status == SYSTEM_STATUS_SUCCESS)
+	{
+		transaction->status = SYSTEM_STATUS_BUSY;
+		transaction->next = NULL;
+
+		if (g_i2cEngine.tail == NULL)
+		{
+			g_i2cEngine.head = g_i2cEngine.tail = transaction;
+			if (g_i2cEngine.state == I2C_ENGINE_IDLE)
+			{
+				I2C_EngineStartNext();
+			}
+		}
+		else
+		{
+			g_i2cEngine.tail->next = transaction;
+			g_i2cEngine.tail = transaction;
+		}
+	}
+
+	__set_PRIMASK(primask);
+
+	return status;
+}
+
+/**********************************************************************************/
+uint8_t I2C_Execute(I2C_Type *base, i2cTransaction_t *transaction)
+{
+	/** Same timeout as I2C_Wait, restarted on each bus event */
+	const uint32_t timeout_tries = (SystemCoreClock >> 9);
+	/** I2C0_IRQHandler can not run while the interrupts are masked: the engine is run from here */
+	const bool polled = (__get_PRIMASK() != 0U);
+	uint32_t progress;
+	uint32_t tries = 0;
+
+	/** From a handler the wait would block I2C0_IRQHandler, or run the engine under it */
+	SYSTEM_ASSERT(__get_IPSR() == 0U);
+
+	if (I2C_Submit(base, transaction) != SYSTEM_STATUS_SUCCESS)
+	{
+		return SYSTEM_STATUS_BUSY;
+	}
+
+	progress = g_i2cEngine.progress;
+	while (transaction->status == SYSTEM_STATUS_BUSY)
+	{
+		/** The flag is read on every pass, so the loop waits on the module and not only on RAM */
+		if (I2C_GetInterruptFlag(base) && polled)
+		{
+			I2C_EngineStep();
+		}
+
+		if (progress != g_i2cEngine.progress)
+		{
+			progress = g_i2cEngine.progress;
+			tries = 0;
+		}
+		else if (++tries >= timeout_tries)
+		{
+			I2C_Cancel(base, transaction);
+		}
+	}
+
+	return transaction->status;
+}
+
+/**********************************************************************************/
+void I2C_Cancel(I2C_Type *base, i2cTransaction_t *transaction)
+{
+	const uint32_t primask = __get_PRIMASK();
+
+	SYSTEM_ASSERT(base == g_i2cEngine.base);
+
+	__disable_irq();
+
+	if (transaction->status == SYSTEM_STATUS_BUSY)
+	{
+		if (transaction == g_i2cEngine.head)
+		{
+			I2C_EngineFinish(SYSTEM_STATUS_TIMEOUT, false);
+		}
+		else
+		{
+			/** Removes the transaction from the queue */
+			i2cTransaction_t *prev = g_i2cEngine.head;
+
+			while ((prev != NULL) && (prev->next != transaction))
+			{
+				prev = prev->next;
+			}
+			if (prev != NULL)
+			{
+				prev->next = transaction->next;
+				if (g_i2cEngine.tail == transaction)
+				{
+					g_i2cEngine.tail = prev;
+				}
+			}
+			transaction->next = NULL;
+			transaction->status = SYSTEM_STATUS_TIMEOUT;
+		}
+	}
+
+	__set_PRIMASK(primask);
+}
+
+/**********************************************************************************/
+uint8_t I2C_Transfer(I2C_Type *base, const i2cSegment_t *segs, size_t n)
+{
+	i2cTransaction_t transaction = {
+		.segments = segs, .segment_count = n
+	};
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		SYSTEM_ASSERT((segs[i].direction != I2C_SEGMENT_READ) || (segs[i].size >= 1));
+	}
+
+	return I2C_Execute(base, &transaction);
+}
+
+/**********************************************************************************/
+uint8_t I2C_ReadRegisterMap(
+	I2C_Type *base, uint8_t slave_addr, const uint8_t *registers,
+	uint8_t *values, size_t count
+)
+{
+	/** Each burst is a write segment with the first register and a read segment */
+	i2cSegment_t segments[2U * I2C_REGISTER_MAP_MAX_BURSTS];
+	uint8_t status = SYSTEM_STATUS_SUCCESS;
+	size_t n = 0;
+	size_t i = 0;
+
+	while ((i < count) && (status == SYSTEM_STATUS_SUCCESS))
+	{
+		size_t run = 1;
+
+		/** Coalesces consecutive register addresses, without wrapping around 0xFF */
+		while (((i + run) < count) && (registers[i + run] == registers[i + run - 1] + 1))
+		{
+			++run;
+		}
+
+		segments[n++] = (i2cSegment_t){
+			.slave_addr = slave_addr, .direction = I2C_SEGMENT_WRITE,
+			.tx_data = &registers[i], .size = 1
+		};
+		segments[n++] = (i2cSegment_t){
+			.slave_addr = slave_addr, .direction = I2C_SEGMENT_READ,
+			.rx_data = &values[i], .size = (uint16_t)run
+		};
+		i += run;
+
+		if ((n == (sizeof(segments) / sizeof(segments[0]))) || (i == count))
+		{
+			status = I2C_Transfer(base, segments, n);
+			n = 0;
+		}
+	}
+
+	return status;
+}
+
+/**********************************************************************************/
+void I2C0_IRQHandler(void)
+{
+	/**
+	 * The NVIC keeps a request latched after IICIF was cleared with the interrupts
+	 * masked, e.g. by I2C_EngineStartNext: such a stale request has no bus event
+	 */
+	if (I2C_GetInterruptFlag(g_i2cEngine.base))
+	{
+		I2C_EngineStep();
+	}
+}
+
 /**
  * 
  * @brief Writes one data byte in a given slave
@@ -266,26 +848,11 @@ uint8_t I2C_WriteSlave(
 	I2C_Type *base, uint8_t slave_addr, uint8_t data
 )
 {
-	/** Starts Write operation */
-	I2C_START_SLAVE_TRANSMISSION(0)
-
-	/** Transmit the data */
-	I2C_WriteByte(base, data);
-	/** Waits and checks for timeout */
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-	/** Checks transfer error */
-	if (I2C_GetRxAk(base) || !I2C_GetTcf(base)) return SYSTEM_STATUS_TRANSFER_FAIL;
-
-	/**
-	 * Puts the I2C module in receiver and slave mode and puts the Stop
-	 * condition on the bus
-	 */
-	I2C_Stop(base);
-
-	/** Performs a small pause */
-	I2C_Pause();
+	i2cTransaction_t transaction = {
+		.slave_addr = slave_addr, .tx_data = &data, .tx_size = 1
+	};
 
-	return SYSTEM_STATUS_SUCCESS;
+	return I2C_Execute(base, &transaction);
 }
 
 /**
@@ -308,29 +875,11 @@ uint8_t I2C_WriteSlaveChunk(
 	uint16_t data_size
 )
 {
-	/** Starts Write operation */
-	I2C_START_SLAVE_TRANSMISSION(0)
-
-	for (uint16_t i = 0; i < data_size; ++i)
-	{
-		/** Transmit the data */
-		I2C_WriteByte(base, data[i]);
-		/** Waits and checks for timeout */
-		if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-		/** Checks transfer error */
-		if (I2C_GetRxAk(base) || !I2C_GetTcf(base)) return SYSTEM_STATUS_TRANSFER_FAIL;
-	}
-
-	/**
-	 * Puts the I2C module in receiver and slave mode and puts the Stop
-	 * condition on the bus
-	 */
-	I2C_Stop(base);
-
-	/** Performs a small pause */
-	I2C_Pause();
+	i2cTransaction_t transaction = {
+		.slave_addr = slave_addr, .tx_data = data, .tx_size = data_size
+	};
 
-	return SYSTEM_STATUS_SUCCESS;
+	return I2C_Execute(base, &transaction);
 }
 
 /**
@@ -352,27 +901,12 @@ uint8_t I2C_WriteRegister(
 	I2C_Type *base, uint8_t slave_addr, uint8_t register_addr, uint8_t data
 )
 {
-	/** Starts Write operation */
-	I2C_START_SLAVE_TRANSMISSION(0)
-	I2C_START_REGISTER_TRANSMISSION
-
-	/** Transmit the data */
-	I2C_WriteByte(base, data);
-	/** Waits and checks for timeout */
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-	/** Checks transfer error */
-	if (I2C_GetRxAk(base) || !I2C_GetTcf(base)) return SYSTEM_STATUS_TRANSFER_FAIL;
-
-	/**
-	 * Puts the I2C module in receiver and slave mode and puts the Stop
-	 * condition on the bus
-	 */
-	I2C_Stop(base);
-
-	/** Performs a small pause */
-	I2C_Pause();
+	i2cTransaction_t transaction = {
+		.slave_addr = slave_addr, .use_register = true, .register_addr = register_addr,
+		.tx_data = &data, .tx_size = 1
+	};
 
-	return SYSTEM_STATUS_SUCCESS;
+	return I2C_Execute(base, &transaction);
 }
 
 /**
@@ -396,30 +930,12 @@ uint8_t I2C_WriteRegisterChunk(
 	const uint8_t* const data, uint16_t data_size
 )
 {
-	/** Starts Write operation */
-	I2C_START_SLAVE_TRANSMISSION(0)
-	I2C_START_REGISTER_TRANSMISSION
-
-	for (uint16_t i = 0; i < data_size; ++i)
-	{
-		/** Transmit the data */
-		I2C_WriteByte(base, data[i]);
-		/** Waits and checks for timeout */
-		if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-		/** Checks transfer error */
-		if (I2C_GetRxAk(base) || !I2C_GetTcf(base)) return SYSTEM_STATUS_TRANSFER_FAIL;
-	}
-
-	/**
-	 * Puts the I2C module in receiver and slave mode and puts the Stop
-	 * condition on the bus
-	 */
-	I2C_Stop(base);
-
-	/** Performs a small pause */
-	I2C_Pause();
+	i2cTransaction_t transaction = {
+		.slave_addr = slave_addr, .use_register = true, .register_addr = register_addr,
+		.tx_data = data, .tx_size = data_size
+	};
 
-	return SYSTEM_STATUS_SUCCESS;
+	return I2C_Execute(base, &transaction);
 }
 
 /**
@@ -440,31 +956,11 @@ uint8_t I2C_ReadSlave(
 	I2C_Type *base, uint8_t slave_addr, uint8_t* const result
 )
 {
-		/** Starts Write operation */
-	I2C_START_SLAVE_TRANSMISSION(1)
-
-	/** Initiates the repeated start condition */
-	I2C_REPEATED_START_CONDITION
-
-	/** Changes to receiver mode */
-	I2C_SetRxMode(base);
-	/**
-	 * Disable ACK bit signaling to slave to not send more data after this
-	 * byte be received
-	 */
-	I2C_DisableAck(base);
-
-	/** Performs the dummy read */
-	*result = I2C_ReadByte(base);
-	/** Waits and checks for timeout */
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-
-	/** Sends a I2C stop condition onto the bus */
-	I2C_Stop(base);
-	/** Performs actual read of the byte */
-	*result = I2C_ReadByte(base);
+	i2cTransaction_t transaction = {
+		.slave_addr = slave_addr, .rx_data = result, .rx_size = 1
+	};
 
-	return SYSTEM_STATUS_SUCCESS;
+	return I2C_Execute(base, &transaction);
 }
 
 /**
@@ -487,49 +983,11 @@ uint8_t I2C_ReadSlaveChunk(
 	uint16_t result_size
 )
 {
-	/** Starts Write operation */
-	I2C_START_SLAVE_TRANSMISSION(1)
-
-	/** Initiates the repeated start condition */
-	I2C_REPEATED_START_CONDITION
-
-	/** Changes to receiver mode */
-	I2C_SetRxMode(base);
-	/**
-	 * Enable ACK bit signaling to slave to send more data after this byte
-	 * be received
-	 */
-	I2C_EnableAck(base);
-
-	/** Performs the dummy read */
-	*result[0] = I2C_ReadByte(base);
-	/** Waits and checks for timeout */
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-
-	uint16_t i;
-	for (i = 0; i < result_size - 2; ++i)
-	{
-		/** Reads one byte */
-		*result[i] = I2C_ReadByte(base);
-		/** Waits and checks for timeout */
-		if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-	}
-	/**
-	 * Disable ACK bit signaling to slave to not send more data after this
-	 * byte be received
-	 */
-	I2C_DisableAck(base);
-	/** Reads one byte */
-	*result[i++] = I2C_ReadByte(base);
-	/** Waits and checks for timeout */
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-
-	/** Sends a I2C stop condition onto the bus */
-	I2C_Stop(base);
-	/** Read last byte */
-	*result[i] = I2C_ReadByte(base);
+	i2cTransaction_t transaction = {
+		.slave_addr = slave_addr, .rx_data = *result, .rx_size = result_size
+	};
 
-	return SYSTEM_STATUS_SUCCESS;
+	return I2C_Execute(base, &transaction);
 }
 
 /**
@@ -552,32 +1010,12 @@ uint8_t I2C_ReadRegister(
 	uint8_t* const result
 )
 {
-	/** Starts Write operation */
-	I2C_START_SLAVE_TRANSMISSION(1)
-	I2C_START_REGISTER_TRANSMISSION
-
-	/** Initiates the repeated start condition */
-	I2C_REPEATED_START_CONDITION
-
-	/** Changes to receiver mode */
-	I2C_SetRxMode(base);
-	/**
-	 * Disable ACK bit signaling to slave to not send more data after this
-	 * byte be received
-	 */
-	I2C_DisableAck(base);
-
-	/** Performs the dummy read */
-	*result = I2C_ReadByte(base);
-	/** Waits and checks for timeout */
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-
-	/** Sends a I2C stop condition onto the bus */
-	I2C_Stop(base);
-	/** Performs actual read of the byte */
-	*result = I2C_ReadByte(base);
+	i2cTransaction_t transaction = {
+		.slave_addr = slave_addr, .use_register = true, .register_addr = register_addr,
+		.rx_data = result, .rx_size = 1
+	};
 
-	return SYSTEM_STATUS_SUCCESS;
+	return I2C_Execute(base, &transaction);
 }
 
 /**
@@ -601,50 +1039,12 @@ uint8_t I2C_ReadRegisterChunk(
 	uint8_t** const result, uint16_t result_size
 )
 {
-	/** Starts Write operation */
-	I2C_START_SLAVE_TRANSMISSION(1)
-	I2C_START_REGISTER_TRANSMISSION
-
-	/** Initiates the repeated start condition */
-	I2C_REPEATED_START_CONDITION
-
-	/** Changes to receiver mode */
-	I2C_SetRxMode(base);
-	/**
-	 * Enable ACK bit signaling to slave to send more data after this byte
-	 * be received
-	 */
-	I2C_EnableAck(base);
-
-	/** Performs the dummy read */
-	*result[0] = I2C_ReadByte(base);
-	/** Waits and checks for timeout */
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-
-	uint16_t i;
-	for (i = 0; i < result_size - 2; ++i)
-	{
-		/** Reads one byte */
-		*result[i] = I2C_ReadByte(base);
-		/** Waits and checks for timeout */
-		if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-	}
-	/**
-	 * Disable ACK bit signaling to slave to not send more data after this
-	 * byte be received
-	 */
-	I2C_DisableAck(base);
-	/** Reads one byte */
-	*result[i++] = I2C_ReadByte(base);
-	/** Waits and checks for timeout */
-	if (I2C_Wait(base)) return SYSTEM_STATUS_TIMEOUT;
-
-	/** Sends a I2C stop condition onto the bus */
-	I2C_Stop(base);
-	/** Read last byte */
-	*result[i] = I2C_ReadByte(base);
+	i2cTransaction_t transaction = {
+		.slave_addr = slave_addr, .use_register = true, .register_addr = register_addr,
+		.rx_data = *result, .rx_size = result_size
+	};
 
-	return SYSTEM_STATUS_SUCCESS;
+	return I2C_Execute(base, &transaction);
 }
 
 /*! @}*/
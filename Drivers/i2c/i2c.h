@@ -20,6 +20,77 @@ extern "C" {
  * @{
  */
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Maximum number of register bursts of I2C_ReadRegisterMap in one transfer. Longer maps are split in several transfers. */
+#define I2C_REGISTER_MAP_MAX_BURSTS (8U)
+
+/**
+ * @brief Direction of a transfer segment.
+ */
+typedef enum
+{
+	I2C_SEGMENT_WRITE, /**< Master writes to the slave */
+	I2C_SEGMENT_READ   /**< Master reads from the slave */
+} i2cSegmentDirection_t;
+
+/**
+ * @brief One segment of a combined transfer: a (repeated) START, the slave address and the data bytes.
+ */
+typedef struct
+{
+	uint8_t slave_addr;              /**< 7 bits slave address */
+	i2cSegmentDirection_t direction; /**< Write or read */
+	const uint8_t *tx_data;          /**< Bytes to write, for a write segment */
+	uint8_t *rx_data;                /**< Destination of the bytes read, for a read segment */
+	uint16_t size;                   /**< Number of bytes. Read segments must have at least 1 byte */
+} i2cSegment_t;
+
+typedef struct i2cTransaction i2cTransaction_t;
+
+/**
+ * @brief Transaction completion callback, called from I2C0_IRQHandler.
+ *
+ * @param transaction The completed transaction. Its status field has the result.
+ *
+ * @note With FreeRTOS, a task can be notified from here with the FromISR API
+ *       (e.g. vTaskNotifyGiveFromISR or xSemaphoreGiveFromISR).
+ */
+typedef void (*i2cCallback_t)(i2cTransaction_t *transaction);
+
+/**
+ * @brief Descriptor of a master transaction processed by the interrupt-driven engine.
+ *
+ * The transaction is: START, slave address (write), optional register address,
+ * tx_size bytes of tx_data, then, if rx_size is not zero, a repeated START,
+ * slave address (read) and rx_size bytes to rx_data, and STOP. If there is no
+ * register and no tx data, the read starts directly after the first START.
+ *
+ * If segments is not NULL, the fields above are ignored and the transaction is
+ * the list of segments, chained with repeated STARTs and ended by one STOP.
+ *
+ * The descriptor memory is owned by the caller and must stay valid until the
+ * status is not SYSTEM_STATUS_BUSY.
+ */
+struct i2cTransaction
+{
+	uint8_t slave_addr;       /**< 7 bits slave address */
+	bool use_register;        /**< If register_addr is sent after the slave address */
+	uint8_t register_addr;    /**< 1 byte slave register address */
+	const uint8_t *tx_data;   /**< Data to be written, or NULL */
+	uint16_t tx_size;         /**< Number of bytes to be written */
+	uint8_t *rx_data;         /**< Destination of the data read, or NULL */
+	uint16_t rx_size;         /**< Number of bytes to be read */
+	const i2cSegment_t *segments; /**< Segments of a combined transfer, or NULL */
+	size_t segment_count;     /**< Number of segments */
+	i2cCallback_t callback;   /**< Completion callback, or NULL */
+	void *arg;                /**< User argument, not used by the driver */
+	volatile uint8_t status;  /**< SYSTEM_STATUS_BUSY while queued or running, then the result */
+	i2cTransaction_t *next;   /**< Queue link, used internally */
+};
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -146,7 +217,11 @@ static inline uint8_t I2C_ReadByte(I2C_Type *base);
  * @param base I2C mem map of the I2C module to be initialized.
  * @param baud_rate Baud rate to initialize I2C module in [bps].
  *
- * @return SYSTEM_STATUS_SUCCESS if the requested baud rate in [bps] was achievable, otherwise SYSTEM_STATUS_FAIL.
+ * The fastest baud rate at or below the requested one is selected among all
+ * the ICR/MULT pairs. Use I2C_GetBaudRate to get the rate actually set.
+ *
+ * @return SYSTEM_STATUS_SUCCESS if a baud rate at or below the requested one was achievable,
+ *         otherwise (the request is slower than the slowest configuration) SYSTEM_STATUS_FAIL.
  */
 uint8_t I2C_InitWithBaud(I2C_Type *base, uint32_t baud_rate);
 
@@ -156,9 +231,8 @@ uint8_t I2C_InitWithBaud(I2C_Type *base, uint32_t baud_rate);
  * @param base I2C mem map of the I2C module to be initialized.
  *
  * @return \a SYSTEM_STATUS_SUCCESS if 100 [kbps] baud rate was set successfully.
- *         \a SYSTEM_STATUS_FAIL in case of any error when trying
- *             to set this speed or if this speed was not possible to be set
- *             with current bus clock speed.
+ *         \a SYSTEM_STATUS_SUCCESS with the fastest rate below 100 [kbps] if it
+ *             is not exactly achievable with the current bus clock.
  */
 uint8_t I2C_Init(I2C_Type *base);
 
@@ -168,12 +242,33 @@ uint8_t I2C_Init(I2C_Type *base);
  * @param base I2C mem map of the I2C module to be initialized.
  *
  * @return \a SYSTEM_STATUS_SUCCESS if 400 [kbps] baud rate was set successfully.
- *         \a SYSTEM_STATUS_FAIL in case  of any error when trying to set
- *             this speed or if this speed was not possible to be set with current
- *             bus clock speed.
+ *         \a SYSTEM_STATUS_SUCCESS with the fastest rate below 400 [kbps] if it
+ *             is not exactly achievable with the current bus clock.
  */
 uint8_t I2C_Init_400kbps(I2C_Type *base);
 
+/**
+ * @brief Initializes the I2C module using the fast mode plus with a fixed baud rate of 1 [Mbps].
+ *
+ * The pads are set to high drive. The slaves must support fast mode plus.
+ *
+ * @param base I2C mem map of the I2C module to be initialized.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if 1 [Mbps] baud rate was set successfully.
+ *         \a SYSTEM_STATUS_FAIL if the bus clock is not fast enough for
+ *             this speed. In this case the module is not changed.
+ */
+uint8_t I2C_Init_1Mbps(I2C_Type *base);
+
+/**
+ * @brief Returns the baud rate currently set in a given I2C module.
+ *
+ * @param base I2C mem map of the I2C module.
+ *
+ * @return The baud rate in [bps].
+ */
+uint32_t I2C_GetBaudRate(I2C_Type *base);
+
 /**
  * @brief Initializes the I2C module using given ICR and MULT values.
  *
@@ -197,6 +292,107 @@ uint8_t I2C_Init_400kbps(I2C_Type *base);
  */
 void I2C_InitManual(I2C_Type *base, uint8_t icr, uint8_t mult);
 
+/**
+ * @brief Queues a transaction to be processed by I2C0_IRQHandler, without blocking.
+ *
+ * The transaction starts immediately if the bus is idle, otherwise after the
+ * transactions queued before it. A transaction waiting for the STOP of the
+ * previous one is started by the stop detection interrupt.
+ *
+ * The status field is set by this function, it needs no initialization. Can
+ * be called from an interrupt handler of any priority, including from a
+ * completion callback: the queue is updated with the interrupts masked
+ * (PRIMASK), which is restored on return.
+ *
+ * @param base I2C mem map of the I2C module.
+ * @param transaction The transaction descriptor.
+ *
+ * @return
+ *          \a SYSTEM_STATUS_SUCCESS if the transaction was queued
+ *          \a SYSTEM_STATUS_BUSY if the descriptor is already queued
+ */
+uint8_t I2C_Submit(I2C_Type *base, i2cTransaction_t *transaction);
+
+/**
+ * @brief Queues a transaction and waits for its completion.
+ *
+ * If the bus makes no progress within approximately 40ms the transaction is
+ * cancelled. When the interrupts are masked with PRIMASK (e.g. before the RTOS
+ * scheduler starts), the engine is run from this function.
+ *
+ * @note Must be called from thread mode (a task or the main loop), which is
+ *       asserted. In an interrupt handler use I2C_Submit with a callback: the
+ *       wait would block I2C0_IRQHandler if it has the same or a lower priority.
+ *
+ * @param base I2C mem map of the I2C module.
+ * @param transaction The transaction descriptor.
+ *
+ * @return
+ *          \a SYSTEM_STATUS_SUCCESS
+ *          \a SYSTEM_STATUS_BUSY
+ *          \a SYSTEM_STATUS_TIMEOUT
+ *          \a SYSTEM_STATUS_INVALID_ADDRESS
+ *          \a SYSTEM_STATUS_INVALID_REGISTER
+ *          \a SYSTEM_STATUS_TRANSFER_FAIL
+ */
+uint8_t I2C_Execute(I2C_Type *base, i2cTransaction_t *transaction);
+
+/**
+ * @brief Cancels a queued or running transaction.
+ *
+ * A running transaction is ended with a STOP condition. The status of the
+ * transaction is set to SYSTEM_STATUS_TIMEOUT and its callback is not called.
+ * The queue is updated with the interrupts masked (PRIMASK).
+ *
+ * @param base I2C mem map of the I2C module.
+ * @param transaction The transaction descriptor.
+ */
+void I2C_Cancel(I2C_Type *base, i2cTransaction_t *transaction);
+
+/**
+ * @brief Executes a combined transfer: the segments are chained with repeated
+ *        STARTs and only the last one is followed by a STOP.
+ *
+ * A typical write-then-read is a write segment with the register address
+ * followed by a read segment.
+ *
+ * @param base I2C mem map of the I2C module.
+ * @param segs The segments, in bus order.
+ * @param n Number of segments.
+ *
+ * @return
+ *          \a SYSTEM_STATUS_SUCCESS
+ *          \a SYSTEM_STATUS_TIMEOUT
+ *          \a SYSTEM_STATUS_INVALID_ADDRESS
+ *          \a SYSTEM_STATUS_TRANSFER_FAIL
+ */
+uint8_t I2C_Transfer(I2C_Type *base, const i2cSegment_t *segs, size_t n);
+
+/**
+ * @brief Reads a list of registers of a slave in as few bus transactions as possible.
+ *
+ * Runs of consecutive addresses (registers[i + 1] == registers[i] + 1) are
+ * read in a single burst, and all the bursts are chained in one I2C_Transfer
+ * (up to I2C_REGISTER_MAP_MAX_BURSTS bursts per transfer). The slave must
+ * auto-increment the register address on burst reads.
+ *
+ * @param base I2C mem map of the I2C module.
+ * @param slave_addr 7 bits slave address.
+ * @param registers The register addresses, preferably sorted.
+ * @param values Destination of the values, values[i] is the value of registers[i].
+ * @param count Number of registers.
+ *
+ * @return
+ *          \a SYSTEM_STATUS_SUCCESS
+ *          \a SYSTEM_STATUS_TIMEOUT
+ *          \a SYSTEM_STATUS_INVALID_ADDRESS
+ *          \a SYSTEM_STATUS_TRANSFER_FAIL
+ */
+uint8_t I2C_ReadRegisterMap(
+	I2C_Type *base, uint8_t slave_addr, const uint8_t *registers,
+	uint8_t *values, size_t count
+);
+
 /**
  *
  * @brief Writes one data byte in a given slave
@@ -476,7 +672,7 @@ static inline void I2C_Pause()
 {
 	for (uint8_t i = 0; i < 50; ++i)
 	{
-		__asm("nop");
+		__NOP();
 	}
 }
 
@@ -22,7 +22,7 @@ void PORT_Init(PORT_Type* base)
 {
 	SYSTEM_ASSERT(base);
 
-	unsigned int portIndex =  ( (unsigned int)((unsigned int)base - (unsigned int)PORTA ) / 0x1000U ) + 9;
+	unsigned int portIndex =  ( (unsigned int)((uintptr_t)base - (uintptr_t)PORTA ) / 0x1000U ) + 9;
 
 	SIM->SCGC5 |= 1 << portIndex;
 }
@@ -20,6 +20,31 @@
 
 static systemClock_t g_uartClkSrc;
 
+#ifdef UART0_BUFFERED_MODE
+/*!
+ * @brief Single-producer/single-consumer ring buffer.
+ *
+ * The indexes are free running and only masked when accessing the data array,
+ * so "head - tail" is always the number of bytes stored. The head is only
+ * written by the producer and the tail only by the consumer, so no critical
+ * section is needed between the API and UART0_IRQHandler.
+ */
+typedef struct
+{
+	volatile uint16_t head; /*!< Write index, modified only by the producer. */
+	volatile uint16_t tail; /*!< Read index, modified only by the consumer. */
+}uart0Ring_t;
+
+#if ( UART0_TX_BUFFER_SIZE & ( UART0_TX_BUFFER_SIZE - 1U ) ) || ( UART0_RX_BUFFER_SIZE & ( UART0_RX_BUFFER_SIZE - 1U ) )
+#error "UART0_TX_BUFFER_SIZE and UART0_RX_BUFFER_SIZE must be powers of 2."
+#endif
+
+static uint8_t g_uartTxData[UART0_TX_BUFFER_SIZE];
+static uint8_t g_uartRxData[UART0_RX_BUFFER_SIZE];
+static uart0Ring_t g_uartTxRing, g_uartRxRing;
+static volatile uint32_t g_uartRxBufferOverruns, g_uartRxHwOverruns;
+#endif /* UART0_BUFFERED_MODE */
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -84,4 +109,157 @@ void UART0_Init( uint32_t baudRate,
     UART0->C1 |= parity; /* Enable parity */
 }
 
+#ifdef UART0_BUFFERED_MODE
+
+/**********************************************************************************/
+void UART0_EnableBufferedMode( void )
+{
+	UART0_DisableTxIRQ();
+
+	g_uartTxRing.head = g_uartTxRing.tail = 0U;
+	g_uartRxRing.head = g_uartRxRing.tail = 0U;
+	g_uartRxBufferOverruns = 0U;
+	g_uartRxHwOverruns = 0U;
+
+	UART0_CleanRxBuffer();
+	UART0_EnableRxIRQ();
+	NVIC_EnableIRQ( UART0_IRQn );
+}
+
+/**********************************************************************************/
+size_t UART0_GetTxBufferFree( void )
+{
+	return UART0_TX_BUFFER_SIZE - (uint16_t)( g_uartTxRing.head - g_uartTxRing.tail );
+}
+
+/**********************************************************************************/
+size_t UART0_GetRxBufferCount( void )
+{
+	return (uint16_t)( g_uartRxRing.head - g_uartRxRing.tail );
+}
+
+/**********************************************************************************/
+size_t UART0_WriteBuffer( const uint8_t *data, size_t length )
+{
+	uint16_t head = g_uartTxRing.head;
+	size_t space = UART0_GetTxBufferFree();
+	size_t i;
+
+	if ( length > space )
+	{
+		length = space;
+	}
+
+	for ( i = 0; i < length; ++i )
+	{
+		g_uartTxData[head & ( UART0_TX_BUFFER_SIZE - 1U )] = data[i];
+		++head;
+	}
+	g_uartTxRing.head = head; /* Publish the bytes only after they are stored */
+
+	if ( length )
+	{
+		UART0_EnableTxIRQ();
+	}
+	return length;
+}
+
+/**********************************************************************************/
+size_t UART0_ReadBuffer( uint8_t *data, size_t length )
+{
+	uint16_t tail = g_uartRxRing.tail;
+	size_t count = UART0_GetRxBufferCount();
+	size_t i;
+
+	if ( length > count )
+	{
+		length = count;
+	}
+
+	for ( i = 0; i < length; ++i )
+	{
+		data[i] = g_uartRxData[tail & ( UART0_RX_BUFFER_SIZE - 1U )];
+		++tail;
+	}
+	g_uartRxRing.tail = tail; /* Release the slots only after they are read */
+
+	return length;
+}
+
+/**********************************************************************************/
+void UART0_WriteBufferByte( const uint8_t data )
+{
+	UART0_WriteBuffer( &data, 1 );
+}
+
+/**********************************************************************************/
+uint8_t UART0_ReadBufferByte( void )
+{
+	uint8_t data = 0U;
+
+	UART0_ReadBuffer( &data, 1 );
+	return data;
+}
+
+/**********************************************************************************/
+uint32_t UART0_GetRxBufferOverrunCount( void )
+{
+	return g_uartRxBufferOverruns;
+}
+
+/**********************************************************************************/
+uint32_t UART0_GetRxHwOverrunCount( void )
+{
+	return g_uartRxHwOverruns;
+}
+
+/**********************************************************************************/
+void UART0_IRQHandler( void )
+{
+	uint8_t status = UART0->S1;
+
+	/* Error flags are cleared by writing 1 to them */
+	if ( status & ( UART0_S1_OR_MASK | UART0_S1_NF_MASK | UART0_S1_FE_MASK | UART0_S1_PF_MASK ) )
+	{
+		if ( status & UART0_S1_OR_MASK )
+		{
+			++g_uartRxHwOverruns;
+		}
+		UART0->S1 = status & ( UART0_S1_OR_MASK | UART0_S1_NF_MASK | UART0_S1_FE_MASK | UART0_S1_PF_MASK );
+	}
+
+	if ( status & UART0_S1_RDRF_MASK )
+	{
+		uint8_t data = UART0_Read();
+		uint16_t head = g_uartRxRing.head;
+
+		if ( (uint16_t)( head - g_uartRxRing.tail ) < UART0_RX_BUFFER_SIZE )
+		{
+			g_uartRxData[head & ( UART0_RX_BUFFER_SIZE - 1U )] = data;
+			g_uartRxRing.head = head + 1U;
+		}
+		else
+		{
+			++g_uartRxBufferOverruns;
+		}
+	}
+
+	if ( ( UART0->C2 & UART0_C2_TIE_MASK ) && ( status & UART0_S1_TDRE_MASK ) )
+	{
+		uint16_t tail = g_uartTxRing.tail;
+
+		if ( tail != g_uartTxRing.head )
+		{
+			UART0_Write( g_uartTxData[tail & ( UART0_TX_BUFFER_SIZE - 1U )] );
+			g_uartTxRing.tail = tail + 1U;
+		}
+		else
+		{
+			UART0_DisableTxIRQ(); /* Nothing else to send */
+		}
+	}
+}
+
+#endif /* UART0_BUFFERED_MODE */
+
 /*! @}*/
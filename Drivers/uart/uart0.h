@@ -27,6 +27,16 @@ extern "C" {
 
 #define UART0_OSR_FIELD_VALUE 15
 
+/*!< Defines the interrupt-driven buffered mode. In this mode, UART0_IRQHandler
+ *   is implemented by the driver and moves bytes between the UART0 data register
+ *   and the Tx/Rx ring buffers. Uncomment this macro or set in the compiler
+ *   parameters to use it, it is off so the application can keep its own handler. */
+//#define UART0_BUFFERED_MODE
+/*!< The Tx ring buffer size in bytes. Must be a power of 2. */
+#define UART0_TX_BUFFER_SIZE 32U
+/*!< The Rx ring buffer size in bytes. Must be a power of 2. */
+#define UART0_RX_BUFFER_SIZE 32U
+
 
 /* @brief Possible combinations to enable Tx and Rx */
 typedef enum{
@@ -202,6 +212,98 @@ void UART0_Init( uint32_t baudRate,
                 uart0Parity_t parity,
                 uart0StopBitNum_t stopBitsN);
 
+#ifdef UART0_BUFFERED_MODE
+/**
+ * @brief Enable the interrupt-driven buffered mode.
+ *
+ * This function clears the Tx/Rx ring buffers and the overrun counters, enables
+ * the Rx interrupt and the UART0 interrupt in NVIC. The Tx interrupt is enabled
+ * on demand, only while there are bytes in the Tx ring buffer.
+ *
+ * @note This function should be called after the UART0_Init.
+ */
+void UART0_EnableBufferedMode( void );
+
+/**
+ * @brief Write a block of bytes in the Tx ring buffer.
+ *
+ * This function does not block. It copies as many bytes as there is space in
+ * the Tx ring buffer and the transmission is done by UART0_IRQHandler.
+ *
+ * @param data - a pointer to the bytes to be sent.
+ * @param length - the number of bytes to be sent.
+ *
+ * @return The number of bytes actually copied to the Tx ring buffer.
+ */
+size_t UART0_WriteBuffer( const uint8_t *data, size_t length );
+
+/**
+ * @brief Read a block of bytes from the Rx ring buffer.
+ *
+ * This function does not block. It copies as many bytes as there are
+ * received in the Rx ring buffer, up to length.
+ *
+ * @param data - a pointer to the buffer that stores the bytes read.
+ * @param length - the maximum number of bytes to read.
+ *
+ * @return The number of bytes actually read from the Rx ring buffer.
+ */
+size_t UART0_ReadBuffer( uint8_t *data, size_t length );
+
+/**
+ * @brief Get the free space in the Tx ring buffer.
+ *
+ * This function can be passed as the "GetAvailToWrite" callback of a stream.
+ *
+ * @return The number of bytes that can be written without blocking.
+ */
+size_t UART0_GetTxBufferFree( void );
+
+/**
+ * @brief Get the number of received bytes in the Rx ring buffer.
+ *
+ * This function can be passed as the "GetBytesToRead" callback of a stream.
+ *
+ * @return The number of bytes that can be read without blocking.
+ */
+size_t UART0_GetRxBufferCount( void );
+
+/**
+ * @brief Write one byte in the Tx ring buffer.
+ *
+ * This function can be passed as the "Write" callback of a stream.
+ *
+ * @param data - The 8-bit data to send.
+ *
+ * @note The byte is discarded if the Tx ring buffer is full. Check
+ *       UART0_GetTxBufferFree before calling it.
+ */
+void UART0_WriteBufferByte( const uint8_t data );
+
+/**
+ * @brief Read one byte from the Rx ring buffer.
+ *
+ * This function can be passed as the "Read" callback of a stream.
+ *
+ * @return The 8-bit data received, or 0 if the Rx ring buffer is empty.
+ */
+uint8_t UART0_ReadBufferByte( void );
+
+/**
+ * @brief Get the number of bytes lost because the Rx ring buffer was full.
+ *
+ * @return The Rx ring buffer overrun counter.
+ */
+uint32_t UART0_GetRxBufferOverrunCount( void );
+
+/**
+ * @brief Get the number of hardware Rx overruns (OR flag) detected in the handler.
+ *
+ * @return The Rx hardware overrun counter.
+ */
+uint32_t UART0_GetRxHwOverrunCount( void );
+#endif /* UART0_BUFFERED_MODE */
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -254,7 +356,7 @@ static inline uint8_t UART0_IsTxAvailable( void )
 /**********************************************************************************/
 static inline void UART0_Write( uint8_t data )
 {
-    UART0_D = data;
+    UART0->D = data;
 }
 
 /**********************************************************************************/
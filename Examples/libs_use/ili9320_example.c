@@ -4,7 +4,7 @@
 #include "mcu/drivers/port/port.h"
 #include "mcu/drivers/gpio/gpio.h"
 #include "libraries/delay/delay.h"
-//#include "libraries/GfxLCD/tftlcd_ili9341.h"
+//#include "libraries/ili9341/tftlcd_ili9341.h"
 #include "ili9320.h"
 
 int main(void)
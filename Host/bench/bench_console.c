@@ -0,0 +1,166 @@
+/***************************************************************************************
+ * @file        bench_console.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the calls made by Console_Println and Console_Printf per
+ *              line of output.
+ * @remarks     The console writes to a stream with block callbacks, as the UART0
+ *              rings have. The stream calls are counted by linking with
+ *              --wrap=Stream_WriteBlocking. The "before" cases are the previous
+ *              implementations, kept here as a reference: Println wrote the body
+ *              and then each newline character on its own, and Printf wrote each
+ *              formatted character on its own. They do not take the console mutex.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/console/console.h>
+#include <Libraries/stream/stream.h>
+
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_LINES 1000U
+
+#define BENCH_LINE "temperature sensor 2: ok"
+#define BENCH_NEW_LINE "\r\n"
+
+static uint64_t g_streamCalls;
+static uint64_t g_deviceCalls;
+static uint64_t g_bytes;
+
+void __real_Stream_WriteBlocking( streamHandle_t handle, const uint8_t *data, size_t length );
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+void __wrap_Stream_WriteBlocking( streamHandle_t handle, const uint8_t *data, size_t length )
+{
+	++g_streamCalls;
+	__real_Stream_WriteBlocking( handle, data, length );
+}
+
+/**********************************************************************************/
+static size_t SinkGetAvailToWrite( void )
+{
+	++g_deviceCalls;
+	return SIZE_MAX;
+}
+
+/**********************************************************************************/
+static void SinkWrite( const uint8_t data )
+{
+	(void)data;
+	++g_deviceCalls;
+	++g_bytes;
+}
+
+/**********************************************************************************/
+static size_t SinkWriteBlock( const uint8_t *data, size_t length )
+{
+	(void)data;
+	++g_deviceCalls;
+	g_bytes += length;
+	return length;
+}
+
+/**********************************************************************************/
+static void BaselinePrintln( streamHandle_t stream, const char *line )
+{
+	const char *newLine = BENCH_NEW_LINE;
+	size_t i;
+
+	for ( i = 0; line[i] != '\0'; ++i )
+	{}
+
+	Stream_WriteBlocking( stream, (const uint8_t*)line, i );
+
+	for ( int j = 0; newLine[j]; ++j )
+	{
+		while ( !Stream_GetAvailToWrite( stream ) );
+		Stream_WriteBlocking( stream, (const uint8_t*)&newLine[j], 1 );
+	}
+}
+
+/**********************************************************************************/
+static void BaselineOutPrintf( char character, void *arg )
+{
+	Stream_WriteBlocking( arg, (const uint8_t*)&character, 1 );
+}
+
+/**
+ * @brief Runs one way of writing a line and reports the calls per line.
+ */
+static void BenchCase( const char *name, streamHandle_t stream, consoleHandle_t console, bool println,
+		bool baseline )
+{
+	g_streamCalls = 0U;
+	g_deviceCalls = 0U;
+	g_bytes = 0U;
+
+	const double start = HostBench_Ns();
+
+	for ( unsigned i = 0; i < BENCH_LINES; ++i )
+	{
+		if ( println && baseline )
+		{
+			BaselinePrintln( stream, BENCH_LINE );
+		}
+		else if ( println )
+		{
+			Console_Println( console, BENCH_LINE );
+		}
+		else if ( baseline )
+		{
+			fctprintf( BaselineOutPrintf, stream, "adc %u: %d mV, %s" BENCH_NEW_LINE, i % 8U, (int)i * 3, "ok" );
+		}
+		else
+		{
+			Console_Printf( console, "adc %u: %d mV, %s" BENCH_NEW_LINE, i % 8U, (int)i * 3, "ok" );
+		}
+	}
+
+	const double ns = HostBench_Ns() - start;
+
+	HostBench_Report( name, "Stream_WriteBlocking calls", (double)g_streamCalls / BENCH_LINES, "calls/line" );
+	HostBench_Report( name, "device callbacks", (double)g_deviceCalls / BENCH_LINES, "calls/line" );
+	HostBench_Report( name, "bytes", (double)g_bytes / BENCH_LINES, "bytes/line" );
+	HostBench_Report( name, "host time", ns / BENCH_LINES, "ns/line" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	streamConfig_t *streamConfig = Stream_CreateConfig();
+	consoleConfig_t *consoleConfig = Console_CreateConfig();
+
+	HostBench_Open( argc, argv, "bench_console" );
+	HostSim_Init();
+
+	streamConfig->GetAvailToWrite = SinkGetAvailToWrite;
+	streamConfig->Write = SinkWrite;
+	streamConfig->WriteBlock = SinkWriteBlock;
+	streamConfig->newLine = (const unsigned char*)BENCH_NEW_LINE;
+	consoleConfig->stream = Stream_Init( streamConfig );
+	consoleConfig->newLine = (const unsigned char*)BENCH_NEW_LINE;
+
+	consoleHandle_t console = Console_Init( consoleConfig );
+
+	BenchCase( "Println, before", consoleConfig->stream, console, true, true );
+	BenchCase( "Println, after", consoleConfig->stream, console, true, false );
+	BenchCase( "Printf, before", consoleConfig->stream, console, false, true );
+	BenchCase( "Printf, after", consoleConfig->stream, console, false, false );
+
+	return HostBench_Close();
+}
@@ -0,0 +1,169 @@
+/***************************************************************************************
+ * @file        bench_decimal.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the base 10 conversion of Util_IntToStr with the digit
+ *              pair table against the division loop it replaced.
+ * @remarks     Reports the host time per call and, for the Cortex-M0+, the exact count
+ *              of the run-time library calls of each conversion and a cycle estimate
+ *              from it. The M0+ has no divider: the loop calls __aeabi_idivmod once
+ *              per digit. The table path calls no division and does one 32x32->64
+ *              multiply per two digits. The cycle costs of the calls are parameters
+ *              of the model, set below; the rest of the code is not counted.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/util/string.h>
+
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_VALUES 4096U
+#define BENCH_REPEAT 200U
+
+/*!< Model of the Cortex-M0+: cycles of a 32-bit __aeabi_idivmod call by 10 (shift
+ * and subtract over about 30 quotient bits) and of a 32x32->64 multiply built from
+ * four 16x16 MULS. */
+#define BENCH_M0_DIVMOD_CYCLES 100U
+#define BENCH_M0_MUL64_CYCLES 20U
+
+static int32_t g_values[BENCH_VALUES];
+static uint8_t g_str[16];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Util_IntToStr before the digit pair table, for base 10.
+ */
+static int ReferenceIntToStr( int32_t num, uint8_t *str )
+{
+	int i = 0;
+	bool isNegative = false;
+
+	if ( num == 0 )
+	{
+		str[i++] = '0';
+		str[i] = '\0';
+		return i;
+	}
+	if ( num < 0 )
+	{
+		isNegative = true;
+		num = -num;
+	}
+	while ( num != 0 )
+	{
+		str[i++] = num % 10 + '0';
+		num = num / 10;
+	}
+	if ( isNegative )
+	{
+		str[i++] = '-';
+	}
+	str[i] = '\0';
+	Util_ReverseStr( str, i );
+	return i;
+}
+
+/**********************************************************************************/
+static unsigned Digits( int32_t value )
+{
+	uint32_t magnitude = ( value < 0 ) ? 0U - (uint32_t)value : (uint32_t)value;
+	unsigned digits = 1U;
+
+	while ( magnitude >= 10U )
+	{
+		magnitude /= 10U;
+		++digits;
+	}
+	return digits;
+}
+
+/**
+ * @brief Runs the conversion of a set of values both ways and reports it.
+ */
+static void BenchCase( const char *name, int32_t (*generate)( unsigned i ) )
+{
+	double reference = 1e300, table = 1e300;
+	uint64_t divisions = 0U, multiplies = 0U;
+	char caseName[64];
+
+	for ( unsigned i = 0; i < BENCH_VALUES; ++i )
+	{
+		const unsigned digits = Digits( g_values[i] = generate( i ) );
+
+		divisions += digits;
+		multiplies += ( digits - 1U ) / 2U;
+	}
+
+	for ( unsigned r = 0; r < BENCH_REPEAT; ++r )
+	{
+		double start = HostBench_Ns();
+
+		for ( unsigned i = 0; i < BENCH_VALUES; ++i )
+		{
+			ReferenceIntToStr( g_values[i], g_str );
+		}
+
+		double ns = ( HostBench_Ns() - start ) / BENCH_VALUES;
+
+		reference = ( ns < reference ) ? ns : reference;
+		start = HostBench_Ns();
+		for ( unsigned i = 0; i < BENCH_VALUES; ++i )
+		{
+			Util_IntToStr( g_values[i], g_str, 10U );
+		}
+		ns = ( HostBench_Ns() - start ) / BENCH_VALUES;
+		table = ( ns < table ) ? ns : table;
+	}
+
+	snprintf( caseName, sizeof(caseName), "%s, division loop", name );
+	HostBench_Report( caseName, "host time per call", reference, "ns" );
+	HostBench_Report( caseName, "M0+ divisions per call", (double)divisions / BENCH_VALUES, "calls" );
+	HostBench_Report( caseName, "M0+ library cycles per call",
+			(double)( divisions * BENCH_M0_DIVMOD_CYCLES ) / BENCH_VALUES, "cycles" );
+
+	snprintf( caseName, sizeof(caseName), "%s, digit pairs", name );
+	HostBench_Report( caseName, "host time per call", table, "ns" );
+	HostBench_Report( caseName, "M0+ divisions per call", 0.0, "calls" );
+	HostBench_Report( caseName, "M0+ 64-bit multiplies per call", (double)multiplies / BENCH_VALUES, "calls" );
+	HostBench_Report( caseName, "M0+ library cycles per call",
+			(double)( multiplies * BENCH_M0_MUL64_CYCLES ) / BENCH_VALUES, "cycles" );
+}
+
+/**********************************************************************************/
+static int32_t AdcReading( unsigned i )
+{
+	return (int32_t)( ( i * 2654435761U ) >> 20 ); /* 0 to 4095 */
+}
+
+/**********************************************************************************/
+static int32_t AnyMagnitude( unsigned i )
+{
+	const int32_t value = (int32_t)( ( i * 2654435761U ) >> ( 1U + i % 31U ) );
+
+	return ( i & 1U ) ? -value : value;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	HostBench_Open( argc, argv, "bench_decimal" );
+
+	BenchCase( "12-bit readings", AdcReading );
+	BenchCase( "any magnitude", AnyMagnitude );
+
+	return HostBench_Close();
+}
@@ -0,0 +1,316 @@
+/***************************************************************************************
+ * @file        bench_display_list.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the redraws of a UI screen by the display list against
+ *              the widgets drawn pixel by pixel.
+ * @remarks     The display is the ILI9320 of the TFT LCD model of host_devices.h on
+ *              the 8-bit bus. The screen has a title bar, 3 buttons with outlines
+ *              and labels, a gauge and a status line: 14 items on a background.
+ *              The pixel by pixel case floods the background with ili9320_FillRect
+ *              and draws each widget with ili9320_WritePixel, a cursor per pixel,
+ *              as the widgets did. The display list case renders the same items
+ *              in its RAM band through the display HAL. Each way redraws the whole
+ *              screen, then a pressed button, the pixels of both ways are compared,
+ *              and the bus bytes, window commands and bus time are reported.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/display/display.h>
+#include <Libraries/display/display_list.h>
+#include <Libraries/display/drivers/display_ili9320.h>
+#include <Libraries/ili9320/ili9320.h>
+
+#include "host_devices.h"
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Bus pins of the boards: data and DC, CS on PTA, data, WR and RD on PTB. */
+#define BENCH_PTA_PINS ( ( 1UL << 0 ) | ( 1UL << 8 ) | ( 1UL << 10 ) | ( 1UL << 11 ) | ( 1UL << 12 ) )
+#define BENCH_PTB_PINS ( ( 1UL << 5 ) | ( 1UL << 6 ) | ( 1UL << 7 ) | ( 1UL << 8 ) | ( 1UL << 9 ) | \
+		( 1UL << 10 ) | ( 1UL << 11 ) )
+
+#define BENCH_BACKGROUND 0x0010U
+#define BENCH_WHITE 0xFFFFU
+#define BENCH_PRESSED 0xFD20U
+
+/*!< The items of the screen, and the button fill that is pressed. */
+#define BENCH_ITEMS 14U
+#define BENCH_PRESSED_ITEM 3U
+
+/*!< The bytes of the text bitmaps: 16 lines of up to 20 characters of 8 pixels. */
+#define BENCH_TEXT_BYTES ( 16U * 20U )
+
+/*!< The kinds of items. */
+typedef enum
+{
+	BENCH_FILL,
+	BENCH_FRAME,
+	BENCH_TEXT
+} benchKind_t;
+
+/*!
+ * @brief An item of the screen.
+ */
+typedef struct
+{
+	benchKind_t kind;
+	int16_t x, y;
+	uint16_t w, h;
+	uint16_t color;
+	bool transparent;
+	uint8_t text;      /*!< The text bitmap of a text item. */
+} benchItem_t;
+
+/*!< The screen, from bottom to top. */
+static benchItem_t g_items[BENCH_ITEMS] = {
+	{ BENCH_FILL, 0, 0, 320U, 24U, 0x39E7U, false, 0U },           /* title bar */
+	{ BENCH_TEXT, 8, 4, 96U, 16U, BENCH_WHITE, true, 0U },         /* title */
+	{ BENCH_FILL, 10, 60, 95U, 40U, 0x03E0U, false, 0U },          /* buttons */
+	{ BENCH_FILL, 113, 60, 95U, 40U, 0x001FU, false, 0U },
+	{ BENCH_FILL, 216, 60, 95U, 40U, 0x7800U, false, 0U },
+	{ BENCH_FRAME, 10, 60, 95U, 40U, BENCH_WHITE, false, 0U },
+	{ BENCH_FRAME, 113, 60, 95U, 40U, BENCH_WHITE, false, 0U },
+	{ BENCH_FRAME, 216, 60, 95U, 40U, BENCH_WHITE, false, 0U },
+	{ BENCH_TEXT, 37, 72, 40U, 16U, BENCH_WHITE, true, 1U },       /* button labels */
+	{ BENCH_TEXT, 140, 72, 40U, 16U, BENCH_WHITE, true, 2U },
+	{ BENCH_TEXT, 243, 72, 40U, 16U, BENCH_WHITE, true, 3U },
+	{ BENCH_FRAME, 10, 140, 300U, 20U, BENCH_WHITE, false, 0U },   /* gauge */
+	{ BENCH_FILL, 12, 142, 180U, 16U, 0x07E0U, false, 0U },
+	{ BENCH_TEXT, 8, 200, 160U, 16U, BENCH_WHITE, false, 4U }      /* status line */
+};
+
+/*!< The text bitmaps: glyph-like bits, about a third of them set. */
+static uint8_t g_texts[5][BENCH_TEXT_BYTES];
+
+static hostTftLcd_t g_lcd;
+static displayHandle_t g_display;
+static displayListHandle_t g_list;
+static displayItem_t g_listItems[BENCH_ITEMS];
+
+/*!< The GRAM drawn pixel by pixel, to which the display list is compared, and
+ *   the whole screen before the button is pressed. */
+static uint16_t g_expected[HOSTTFTLCD_GRAM_HEIGHT][HOSTTFTLCD_GRAM_WIDTH];
+static uint16_t g_screen[HOSTTFTLCD_GRAM_HEIGHT][HOSTTFTLCD_GRAM_WIDTH];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Tells if a bit of a text item is set.
+ */
+static bool TextBit( const benchItem_t *item, uint16_t x, uint16_t y )
+{
+	const uint16_t stride = ( item->w + 7U ) / 8U;
+
+	return ( g_texts[item->text][y * stride + x / 8U] & ( 0x80U >> ( x % 8U ) ) ) != 0U;
+}
+
+/**
+ * @brief Draws an item pixel by pixel.
+ */
+static void DrawItemPixels( const benchItem_t *item )
+{
+	for ( uint16_t y = 0; y < item->h; ++y )
+	{
+		for ( uint16_t x = 0; x < item->w; ++x )
+		{
+			const bool edge = ( x == 0U ) || ( y == 0U ) || ( x == item->w - 1U ) || ( y == item->h - 1U );
+
+			switch ( item->kind )
+			{
+			case BENCH_FILL:
+				ili9320_WritePixel( item->x + x, item->y + y, item->color );
+				break;
+			case BENCH_FRAME:
+				if ( edge )
+				{
+					ili9320_WritePixel( item->x + x, item->y + y, item->color );
+				}
+				break;
+			default:
+				if ( TextBit( item, x, y ) )
+				{
+					ili9320_WritePixel( item->x + x, item->y + y, item->color );
+				}
+				else if ( !item->transparent )
+				{
+					ili9320_WritePixel( item->x + x, item->y + y, BENCH_BACKGROUND );
+				}
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Tells if two items overlap.
+ */
+static bool Overlap( const benchItem_t *a, const benchItem_t *b )
+{
+	return ( a->x < b->x + (int16_t)b->w ) && ( b->x < a->x + (int16_t)a->w ) &&
+			( a->y < b->y + (int16_t)b->h ) && ( b->y < a->y + (int16_t)a->h );
+}
+
+/**
+ * @brief Redraws pixel by pixel the whole screen, or only the items over an item.
+ */
+static void RedrawPixels( const benchItem_t *changed )
+{
+	/* The window left by the fills and the display HAL */
+	ili9320_SetDisplayWindow( 0U, 0U, ILI9320_LCD_PIXEL_WIDTH, ILI9320_LCD_PIXEL_HEIGHT );
+	if ( changed == NULL )
+	{
+		ili9320_FillRect( BENCH_BACKGROUND, 0U, 0U, ILI9320_LCD_PIXEL_WIDTH, ILI9320_LCD_PIXEL_HEIGHT );
+	}
+	for ( uint8_t i = 0; i < BENCH_ITEMS; ++i )
+	{
+		/* The changed item and the ones above it that it overlaps */
+		if ( ( changed == NULL ) || ( changed == &g_items[i] ) ||
+				( ( changed < &g_items[i] ) && Overlap( changed, &g_items[i] ) ) )
+		{
+			DrawItemPixels( &g_items[i] );
+		}
+	}
+}
+
+/**
+ * @brief Sets the GRAM to a copy.
+ */
+static void LoadGram( const uint16_t ( *gram )[HOSTTFTLCD_GRAM_WIDTH] )
+{
+	if ( gram == NULL )
+	{
+		memset( g_lcd.gram, 0, sizeof(g_lcd.gram) );
+	}
+	else
+	{
+		memcpy( g_lcd.gram, gram, sizeof(g_lcd.gram) );
+	}
+}
+
+/**
+ * @brief Runs a redraw, checks its pixels against the ones drawn pixel by pixel,
+ *        and reports it.
+ */
+static void BenchCase( const char *name, bool pixels, bool pressed )
+{
+	g_lcd.stats = (hostTftLcdStats_t){ 0 };
+
+	const uint64_t cycles = HostSim_GetCycles();
+
+	if ( pixels )
+	{
+		RedrawPixels( pressed ? &g_items[BENCH_PRESSED_ITEM] : NULL );
+	}
+	else
+	{
+		/* The pixel by pixel case wrote behind the display HAL */
+		Display_Invalidate( g_display );
+		if ( pressed )
+		{
+			DisplayList_SetColor( g_list, g_listItems[BENCH_PRESSED_ITEM], g_items[BENCH_PRESSED_ITEM].color );
+		}
+		else
+		{
+			DisplayList_Invalidate( g_list, 0, 0, ILI9320_LCD_PIXEL_WIDTH, ILI9320_LCD_PIXEL_HEIGHT );
+		}
+		DisplayList_Render( g_list );
+	}
+
+	const double seconds = (double)( HostSim_GetCycles() - cycles ) / DEFAULT_SYSTEM_CLOCK;
+
+	if ( pixels )
+	{
+		memcpy( g_expected, g_lcd.gram, sizeof(g_expected) );
+	}
+	else if ( memcmp( g_expected, g_lcd.gram, sizeof(g_expected) ) != 0 )
+	{
+		HostSim_Fatal( "%s: the display list pixels differ from the ones drawn pixel by pixel", name );
+	}
+	if ( g_lcd.stats.violations != 0U )
+	{
+		HostSim_Fatal( "%s: %llu bus timing violations", name, (unsigned long long)g_lcd.stats.violations );
+	}
+
+	HostBench_Report( name, "bus bytes", (double)g_lcd.stats.bytes, "bytes" );
+	HostBench_Report( name, "window commands", (double)g_lcd.stats.windowCommands, "commands" );
+	HostBench_Report( name, "bus time", seconds * 1e3, "ms" );
+	HostBench_Report( name, "RAM band", pixels ? 0.0 : 2.0 * DISPLAY_LIST_MAX_WIDTH * DISPLAY_LIST_BAND_LINES,
+			"bytes" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	uint32_t seed = 12345U;
+
+	HostBench_Open( argc, argv, "bench_display_list" );
+
+	HostSim_Init();
+	Delay_Init();
+	HostTftLcd_AttachGpio( &g_lcd );
+
+	/* The pins are outputs and the control lines idle, as the application configures them */
+	GPIOA->PSOR = ( 1UL << 0 ) | ( 1UL << 8 );
+	GPIOB->PSOR = ( 1UL << 8 ) | ( 1UL << 9 );
+	GPIOA->PDDR |= BENCH_PTA_PINS;
+	GPIOB->PDDR |= BENCH_PTB_PINS;
+	HostTftLcd_Init( &g_lcd, HOSTTFTLCD_ILI9320 );
+	ili9320_Init();
+
+	for ( uint8_t t = 0; t < 5U; ++t )
+	{
+		for ( uint16_t i = 0; i < BENCH_TEXT_BYTES; ++i )
+		{
+			seed = seed * 1103515245U + 12345U;
+			g_texts[t][i] = (uint8_t)( ( seed >> 16 ) & ( seed >> 8 ) );
+		}
+	}
+
+	g_display = Display_Init( &g_displayIli9320Driver );
+	g_list = DisplayList_Init( g_display, BENCH_BACKGROUND );
+	for ( uint8_t i = 0; i < BENCH_ITEMS; ++i )
+	{
+		const benchItem_t *item = &g_items[i];
+
+		switch ( item->kind )
+		{
+		case BENCH_FILL:
+			g_listItems[i] = DisplayList_AddFillRect( g_list, item->x, item->y, item->w, item->h, item->color );
+			break;
+		case BENCH_FRAME:
+			g_listItems[i] = DisplayList_AddFrameRect( g_list, item->x, item->y, item->w, item->h, item->color );
+			break;
+		default:
+			g_listItems[i] = DisplayList_AddBitmap( g_list, item->x, item->y, item->w, item->h, g_texts[item->text],
+					item->color, BENCH_BACKGROUND, item->transparent );
+			break;
+		}
+	}
+
+	LoadGram( NULL );
+	BenchCase( "full redraw, per pixel", true, false );
+	memcpy( g_screen, g_expected, sizeof(g_screen) );
+	LoadGram( NULL );
+	BenchCase( "full redraw, display list", false, false );
+
+	g_items[BENCH_PRESSED_ITEM].color = BENCH_PRESSED;
+	LoadGram( g_screen );
+	BenchCase( "button press, per pixel", true, true );
+	LoadGram( g_screen );
+	BenchCase( "button press, display list", false, true );
+
+	return HostBench_Close();
+}
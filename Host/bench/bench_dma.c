@@ -0,0 +1,145 @@
+/***************************************************************************************
+ * @file        bench_dma.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the CPU time taken by sending a block on UART0 with the
+ *              polled API, the interrupt-driven rings and the DMA adapter.
+ * @remarks     Sends 1 KiB at 115200 baud on the simulated KL05 and sleeps with WFI
+ *              whenever the driver has no room. Reports the simulated core cycles in
+ *              which the CPU was not sleeping, the register accesses of the core and
+ *              the exceptions taken.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/dma/dma.h>
+#include <Drivers/dma/dma_stream.h>
+#include <Drivers/uart/uart0.h>
+
+#include "host_models.h"
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_LENGTH 1024U
+#define BENCH_DMA_CHANNEL 0U
+
+typedef enum
+{
+	BENCH_POLLED,
+	BENCH_BUFFERED,
+	BENCH_DMA
+} benchMode_t;
+
+static uint8_t g_message[BENCH_LENGTH];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static size_t WriteSome( benchMode_t mode, const uint8_t *data, size_t length )
+{
+	if ( mode == BENCH_BUFFERED )
+	{
+		return UART0_WriteBuffer( data, length );
+	}
+	return DMA_Uart0WriteBlock( data, length );
+}
+
+/**********************************************************************************/
+static size_t GetTxFree( benchMode_t mode )
+{
+	return ( mode == BENCH_BUFFERED ) ? UART0_GetTxBufferFree() : DMA_Uart0GetTxFree();
+}
+
+/**
+ * @brief Sends the message in one mode and reports it.
+ */
+static void BenchCase( benchMode_t mode, const char *name )
+{
+	const size_t ringSize = ( mode == BENCH_BUFFERED ) ? UART0_TX_BUFFER_SIZE : DMA_UART0_TX_BUFFER_SIZE;
+	size_t sent = 0U;
+
+	HostSim_Init();
+	UART0_SetClkSrc( UART0_CLOCK_FLL );
+	UART0_Init( 115200U, UART0_TX_RX_ENABLE, UART0_NO_PARITY, UART0_ONE_STOP_BIT );
+	if ( mode == BENCH_BUFFERED )
+	{
+		UART0_EnableBufferedMode();
+	}
+	else if ( mode == BENCH_DMA )
+	{
+		DMA_Init();
+		DMA_Uart0TxInit( BENCH_DMA_CHANNEL );
+	}
+
+	const uint64_t cycles = HostSim_GetCycles();
+	const uint64_t idle = HostSim_GetIdleCycles();
+	const uint64_t accesses = HostSim_GetAccessCount();
+	const uint64_t exceptions = HostSim_GetExceptionCount();
+
+	if ( mode == BENCH_POLLED )
+	{
+		for ( size_t i = 0; i < sizeof(g_message); ++i )
+		{
+			while ( !UART0_IsTxAvailable() ) {}
+			UART0_Write( g_message[i] );
+		}
+	}
+	else
+	{
+		while ( sent < sizeof(g_message) )
+		{
+			sent += WriteSome( mode, &g_message[sent], sizeof(g_message) - sent );
+			if ( sent < sizeof(g_message) )
+			{
+				__WFI();
+			}
+		}
+		while ( GetTxFree( mode ) != ringSize )
+		{
+			__WFI();
+		}
+	}
+	while ( !( UART0->S1 & UART0_S1_TC_MASK ) ) {}
+
+	if ( ( HostUart0_GetTxCount() != sizeof(g_message) )
+			|| ( memcmp( HostUart0_GetTxData(), g_message, sizeof(g_message) ) != 0 ) )
+	{
+		HostSim_Fatal( "%s: the line did not carry the message", name );
+	}
+
+	const uint64_t total = HostSim_GetCycles() - cycles;
+	const uint64_t busy = total - ( HostSim_GetIdleCycles() - idle );
+
+	HostBench_Report( name, "transfer time", (double)total * 1000.0 / DEFAULT_SYSTEM_CLOCK, "ms" );
+	HostBench_Report( name, "CPU busy cycles per KiB", (double)busy, "cycles" );
+	HostBench_Report( name, "CPU busy fraction", 100.0 * (double)busy / (double)total, "%" );
+	HostBench_Report( name, "core register accesses", (double)( HostSim_GetAccessCount() - accesses ), "accesses" );
+	HostBench_Report( name, "exceptions", (double)( HostSim_GetExceptionCount() - exceptions ), "exceptions" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	HostBench_Open( argc, argv, "bench_dma" );
+	for ( size_t i = 0; i < sizeof(g_message); ++i )
+	{
+		g_message[i] = (uint8_t)( i * 7U + 3U );
+	}
+
+	BenchCase( BENCH_POLLED, "UART0 Tx, polled" );
+	BenchCase( BENCH_BUFFERED, "UART0 Tx, interrupt rings" );
+	BenchCase( BENCH_DMA, "UART0 Tx, DMA ring" );
+
+	return HostBench_Close();
+}
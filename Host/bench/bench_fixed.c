@@ -0,0 +1,135 @@
+/***************************************************************************************
+ * @file        bench_fixed.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Accuracy and throughput of the fixed-point formatting (%k,
+ *              Util_FixedToStr) against the float path (%f, Util_FloatToStr).
+ * @remarks     The values are Q16.16 readings between -1000 and 1000, printed with 4
+ *              digits after the point. The float paths get the same value converted
+ *              to double or float. An output is exact when it is the value of the Q
+ *              number rounded half away from zero; the error is the distance to that
+ *              value in units of the last digit. The host times leave out the cost of
+ *              the soft-float library on the Cortex-M0+, which the fixed path avoids.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/printf/printf.h>
+#include <Libraries/util/string.h>
+
+#include "host_bench.h"
+
+#undef snprintf
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_VALUES 4096U
+#define BENCH_REPEAT 100U
+#define BENCH_DIGITS 4U
+#define BENCH_SCALE 10000.0
+
+typedef enum
+{
+	BENCH_PRINTF_FIXED,
+	BENCH_PRINTF_DOUBLE,
+	BENCH_UTIL_FIXED,
+	BENCH_UTIL_FLOAT
+} benchPath_t;
+
+static int32_t g_values[BENCH_VALUES];
+static char g_str[40];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void Format( benchPath_t path, int32_t value )
+{
+	switch ( path )
+	{
+		case BENCH_PRINTF_FIXED:
+			snprintf_( g_str, sizeof(g_str), "%.4k", value );
+			break;
+		case BENCH_PRINTF_DOUBLE:
+			snprintf_( g_str, sizeof(g_str), "%.4f", value / 65536.0 );
+			break;
+		case BENCH_UTIL_FIXED:
+			Util_FixedToStr( value, UTIL_Q16_16_FRAC_BITS, (uint8_t*)g_str, BENCH_DIGITS );
+			break;
+		default:
+			Util_FloatToStr( value / 65536.0f, (uint8_t*)g_str, BENCH_DIGITS );
+			break;
+	}
+}
+
+/**
+ * @brief Formats every value with one path and reports its accuracy and time.
+ */
+static void BenchCase( benchPath_t path, const char *name )
+{
+	unsigned exact = 0U;
+	double maxError = 0.0;
+	double best = 1e300;
+
+	for ( unsigned i = 0; i < BENCH_VALUES; ++i )
+	{
+		const double value = g_values[i] / 65536.0;
+		const double rounded = copysign( floor( fabs( value ) * BENCH_SCALE + 0.5 ), value ) / BENCH_SCALE;
+		double error;
+
+		Format( path, g_values[i] );
+		error = fabs( strtod( g_str, NULL ) - rounded ) * BENCH_SCALE;
+		exact += ( error < 0.5 );
+		maxError = ( error > maxError ) ? error : maxError;
+	}
+
+	for ( unsigned r = 0; r < BENCH_REPEAT; ++r )
+	{
+		const double start = HostBench_Ns();
+
+		for ( unsigned i = 0; i < BENCH_VALUES; ++i )
+		{
+			Format( path, g_values[i] );
+		}
+
+		const double ns = ( HostBench_Ns() - start ) / BENCH_VALUES;
+
+		best = ( ns < best ) ? ns : best;
+	}
+
+	HostBench_Report( name, "exactly rounded outputs", 100.0 * exact / BENCH_VALUES, "%" );
+	HostBench_Report( name, "max error", maxError, "last digit" );
+	HostBench_Report( name, "host time per call", best, "ns" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	uint32_t seed = 12345U;
+
+	HostBench_Open( argc, argv, "bench_fixed" );
+	for ( unsigned i = 0; i < BENCH_VALUES; ++i )
+	{
+		seed = seed * 1664525U + 1013904223U;
+		g_values[i] = (int32_t)( seed % ( 2000U << 16 ) ) - ( 1000 << 16 );
+	}
+
+	BenchCase( BENCH_PRINTF_FIXED, "snprintf_ %.4k (Q16.16)" );
+	BenchCase( BENCH_PRINTF_DOUBLE, "snprintf_ %.4f (double)" );
+	BenchCase( BENCH_UTIL_FIXED, "Util_FixedToStr (Q16.16)" );
+	BenchCase( BENCH_UTIL_FLOAT, "Util_FloatToStr (float)" );
+
+	return HostBench_Close();
+}
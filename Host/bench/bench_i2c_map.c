@@ -0,0 +1,112 @@
+/***************************************************************************************
+ * @file        bench_i2c_map.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the bus cost of reading a register snapshot of a sensor
+ *              with one I2C_ReadRegister per register and with I2C_ReadRegisterMap.
+ * @remarks     The sensor is the simulated register file of host_devices.h, on I2C0
+ *              at 400 kbps. Reports the SCL cycles per sample, the START, repeated
+ *              START and STOP conditions, the bus bytes and the time of a snapshot.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/i2c/i2c.h>
+
+#include "host_devices.h"
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_SLAVE_ADDRESS 0x6AU
+#define BENCH_SNAPSHOTS 16U
+
+/*!< Gyroscope, temperature, status and accelerometer: two runs of consecutive registers. */
+static const uint8_t _burstMap[] = {
+	0x18U, 0x19U, 0x1AU, 0x1BU, 0x1CU, 0x1DU,
+	0x26U, 0x27U, 0x28U, 0x29U, 0x2AU, 0x2BU, 0x2CU, 0x2DU
+};
+/*!< Scattered configuration registers: nothing to coalesce. */
+static const uint8_t _sparseMap[] = { 0x0FU, 0x12U, 0x16U, 0x20U, 0x24U, 0x30U, 0x38U, 0x3FU };
+
+static hostRegisterFile_t g_sensor;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Reads a map in one way and reports it.
+ */
+static void BenchCase( const char *name, const uint8_t *map, size_t count, bool coalesce )
+{
+	uint8_t values[sizeof(_burstMap)];
+
+	HostSim_Init();
+	HostI2c_RemoveSlaves();
+	HostRegisterFile_Init( &g_sensor, BENCH_SLAVE_ADDRESS );
+	for ( size_t i = 0; i < sizeof(g_sensor.registers); ++i )
+	{
+		g_sensor.registers[i] = (uint8_t)( i ^ 0x5AU );
+	}
+	(void)I2C_Init_400kbps( I2C0 );
+	HostI2c_ClearStats();
+
+	const uint64_t cycles = HostSim_GetCycles();
+
+	for ( unsigned s = 0; s < BENCH_SNAPSHOTS; ++s )
+	{
+		memset( values, 0, sizeof(values) );
+		if ( coalesce )
+		{
+			(void)I2C_ReadRegisterMap( I2C0, BENCH_SLAVE_ADDRESS, map, values, count );
+		}
+		else
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				(void)I2C_ReadRegister( I2C0, BENCH_SLAVE_ADDRESS, map[i], &values[i] );
+			}
+		}
+		for ( size_t i = 0; i < count; ++i )
+		{
+			if ( values[i] != (uint8_t)( map[i] ^ 0x5AU ) )
+			{
+				HostSim_Fatal( "%s: register 0x%02X read as 0x%02X", name, map[i], values[i] );
+			}
+		}
+	}
+
+	const hostI2cStats_t *stats = HostI2c_GetStats();
+	const double samples = (double)BENCH_SNAPSHOTS * (double)count;
+
+	HostBench_Report( name, "SCL cycles per sample", (double)stats->sclCycles / samples, "cycles" );
+	HostBench_Report( name, "START per snapshot", (double)stats->starts / BENCH_SNAPSHOTS, "conditions" );
+	HostBench_Report( name, "repeated START per snapshot", (double)stats->repeatedStarts / BENCH_SNAPSHOTS,
+			"conditions" );
+	HostBench_Report( name, "STOP per snapshot", (double)stats->stops / BENCH_SNAPSHOTS, "conditions" );
+	HostBench_Report( name, "bus bytes per snapshot", (double)stats->bytes / BENCH_SNAPSHOTS, "bytes" );
+	HostBench_Report( name, "snapshot time", (double)( HostSim_GetCycles() - cycles ) * 1e6 / DEFAULT_SYSTEM_CLOCK
+			/ BENCH_SNAPSHOTS, "us" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	HostBench_Open( argc, argv, "bench_i2c_map" );
+
+	BenchCase( "14 registers, ReadRegister each", _burstMap, sizeof(_burstMap), false );
+	BenchCase( "14 registers, ReadRegisterMap", _burstMap, sizeof(_burstMap), true );
+	BenchCase( "8 scattered, ReadRegister each", _sparseMap, sizeof(_sparseMap), false );
+	BenchCase( "8 scattered, ReadRegisterMap", _sparseMap, sizeof(_sparseMap), true );
+
+	return HostBench_Close();
+}
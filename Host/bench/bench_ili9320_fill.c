@@ -0,0 +1,214 @@
+/***************************************************************************************
+ * @file        bench_ili9320_fill.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the solid fills of the ILI9320 driver: the flood of
+ *              ili9320_FillRect against the former lines copied from a RAM buffer.
+ * @remarks     The display is the TFT LCD model of host_devices.h on the 8-bit bus.
+ *              The buffer case reproduces the former ili9320_DrawHLine/DrawVLine: a
+ *              line of up to 320 pixels (640 bytes of RAM) filled with the color and
+ *              written with LCD_IO_WriteMultipleData, once per line. Each case fills
+ *              the whole screen, a 100x60 rectangle and 32 vertical lines, with a
+ *              color of different bytes (0xF800) and of equal bytes (0xFFFF), checks
+ *              the pixels, and reports the WR strobes, the GPIO writes and the bus
+ *              time per filled pixel. The time of the buffer copy loop is not
+ *              counted: the simulator only times the register accesses.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <common.h>
+#include <Libraries/ili9320/ili9320.h>
+
+#include "host_devices.h"
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Bus pins of the boards: data and DC, CS on PTA, data, WR and RD on PTB. */
+#define BENCH_PTA_PINS ( ( 1UL << 0 ) | ( 1UL << 8 ) | ( 1UL << 10 ) | ( 1UL << 11 ) | ( 1UL << 12 ) )
+#define BENCH_PTB_PINS ( ( 1UL << 5 ) | ( 1UL << 6 ) | ( 1UL << 7 ) | ( 1UL << 8 ) | ( 1UL << 9 ) | \
+		( 1UL << 10 ) | ( 1UL << 11 ) )
+
+/*!< The vertical lines of a case. */
+#define BENCH_VLINES 32U
+
+/*!
+ * @brief A fill of a case.
+ */
+typedef enum
+{
+	BENCH_SCREEN,
+	BENCH_RECT,
+	BENCH_VLINES_SHAPE
+} benchShape_t;
+
+static hostTftLcd_t g_lcd;
+
+/*!< The line buffer of the former driver. */
+static uint16_t g_arrayRGB[320];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief The former ili9320_DrawHLine: the line is copied to the RAM buffer.
+ */
+static void BufferHLine( uint16_t color, uint16_t x, uint16_t y, uint16_t length )
+{
+	ili9320_SetCursor( x, y );
+	LCD_IO_WriteReg( LCD_REG_34 );
+	for ( uint16_t i = 0; i < length; ++i )
+	{
+		g_arrayRGB[i] = color;
+	}
+	LCD_IO_WriteMultipleData( (uint8_t*)g_arrayRGB, length * 2U );
+}
+
+/**
+ * @brief The former ili9320_DrawVLine: the address is moved horizontally first.
+ */
+static void BufferVLine( uint16_t color, uint16_t x, uint16_t y, uint16_t length )
+{
+	ili9320_WriteReg( LCD_REG_3, 0x1010 );
+	BufferHLine( color, x, y, length );
+	ili9320_WriteReg( LCD_REG_3, 0x1018 );
+}
+
+/**
+ * @brief Fills a shape, and gives its number of pixels.
+ */
+static uint32_t Fill( benchShape_t shape, bool buffer, uint16_t color )
+{
+	switch ( shape )
+	{
+	case BENCH_SCREEN:
+	case BENCH_RECT:
+	{
+		const uint16_t x = ( shape == BENCH_SCREEN ) ? 0U : 110U, y = ( shape == BENCH_SCREEN ) ? 0U : 90U;
+		const uint16_t w = ( shape == BENCH_SCREEN ) ? ILI9320_LCD_PIXEL_WIDTH : 100U;
+		const uint16_t h = ( shape == BENCH_SCREEN ) ? ILI9320_LCD_PIXEL_HEIGHT : 60U;
+
+		if ( !buffer )
+		{
+			ili9320_FillRect( color, x, y, w, h );
+			return (uint32_t)w * h;
+		}
+		for ( uint16_t row = 0; row < h; ++row )
+		{
+			BufferHLine( color, x, y + row, w );
+		}
+		return (uint32_t)w * h;
+	}
+	default:
+		for ( uint16_t i = 0; i < BENCH_VLINES; ++i )
+		{
+			if ( buffer )
+			{
+				BufferVLine( color, 8U + i * 9U, 0U, ILI9320_LCD_PIXEL_HEIGHT );
+			}
+			else
+			{
+				ili9320_DrawVLine( color, 8U + i * 9U, 0U, ILI9320_LCD_PIXEL_HEIGHT );
+			}
+		}
+		return BENCH_VLINES * ILI9320_LCD_PIXEL_HEIGHT;
+	}
+}
+
+/**
+ * @brief Tells if a pixel is in a shape.
+ */
+static bool InShape( benchShape_t shape, uint16_t x, uint16_t y )
+{
+	switch ( shape )
+	{
+	case BENCH_SCREEN:
+		return true;
+	case BENCH_RECT:
+		return ( x >= 110U ) && ( x < 210U ) && ( y >= 90U ) && ( y < 150U );
+	default:
+		return ( x >= 8U ) && ( ( x - 8U ) % 9U == 0U ) && ( ( x - 8U ) / 9U < BENCH_VLINES );
+	}
+}
+
+/**
+ * @brief Fills a shape in one way on a black screen, checks it and reports it.
+ */
+static void BenchCase( const char *name, benchShape_t shape, bool buffer, uint16_t color )
+{
+	/* A black screen */
+	for ( uint16_t row = 0; row < HOSTTFTLCD_GRAM_HEIGHT; ++row )
+	{
+		for ( uint16_t column = 0; column < HOSTTFTLCD_GRAM_WIDTH; ++column )
+		{
+			g_lcd.gram[row][column] = 0U;
+		}
+	}
+	g_lcd.stats = (hostTftLcdStats_t){ 0 };
+
+	const uint64_t writes = HostGpio_GetWriteCount( HOSTSIM_PORT_A ) + HostGpio_GetWriteCount( HOSTSIM_PORT_B );
+	const uint64_t cycles = HostSim_GetCycles();
+	const double pixels = (double)Fill( shape, buffer, color );
+	const double seconds = (double)( HostSim_GetCycles() - cycles ) / DEFAULT_SYSTEM_CLOCK;
+	const uint64_t gpioWrites = HostGpio_GetWriteCount( HOSTSIM_PORT_A ) + HostGpio_GetWriteCount( HOSTSIM_PORT_B ) -
+			writes;
+
+	for ( uint16_t y = 0; y < ILI9320_LCD_PIXEL_HEIGHT; ++y )
+	{
+		for ( uint16_t x = 0; x < ILI9320_LCD_PIXEL_WIDTH; ++x )
+		{
+			const uint16_t expected = InShape( shape, x, y ) ? color : 0U;
+
+			if ( HostTftLcd_GetPixel( &g_lcd, x, y ) != expected )
+			{
+				HostSim_Fatal( "%s: pixel %u,%u is 0x%04X instead of 0x%04X", name, x, y,
+						HostTftLcd_GetPixel( &g_lcd, x, y ), expected );
+			}
+		}
+	}
+	if ( g_lcd.stats.violations != 0U )
+	{
+		HostSim_Fatal( "%s: %llu bus timing violations", name, (unsigned long long)g_lcd.stats.violations );
+	}
+
+	HostBench_Report( name, "WR strobes per pixel", (double)g_lcd.stats.bytes / pixels, "strobes" );
+	HostBench_Report( name, "GPIO writes per pixel", (double)gpioWrites / pixels, "writes" );
+	HostBench_Report( name, "time per pixel", seconds * 1e9 / pixels, "ns" );
+	HostBench_Report( name, "RAM buffer", buffer ? (double)sizeof(g_arrayRGB) : 0.0, "bytes" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	HostBench_Open( argc, argv, "bench_ili9320_fill" );
+
+	HostSim_Init();
+	HostTftLcd_AttachGpio( &g_lcd );
+
+	/* The pins are outputs and the control lines idle, as the application configures them */
+	GPIOA->PSOR = ( 1UL << 0 ) | ( 1UL << 8 );
+	GPIOB->PSOR = ( 1UL << 8 ) | ( 1UL << 9 );
+	GPIOA->PDDR |= BENCH_PTA_PINS;
+	GPIOB->PDDR |= BENCH_PTB_PINS;
+	HostTftLcd_Init( &g_lcd, HOSTTFTLCD_ILI9320 );
+	ili9320_Init();
+
+	BenchCase( "screen, buffer, 0xF800", BENCH_SCREEN, true, 0xF800U );
+	BenchCase( "screen, flood, 0xF800", BENCH_SCREEN, false, 0xF800U );
+	BenchCase( "screen, flood, 0xFFFF", BENCH_SCREEN, false, 0xFFFFU );
+	BenchCase( "100x60, buffer, 0xF800", BENCH_RECT, true, 0xF800U );
+	BenchCase( "100x60, flood, 0xF800", BENCH_RECT, false, 0xF800U );
+	BenchCase( "100x60, flood, 0xFFFF", BENCH_RECT, false, 0xFFFFU );
+	BenchCase( "32 vlines, buffer, 0xF800", BENCH_VLINES_SHAPE, true, 0xF800U );
+	BenchCase( "32 vlines, flood, 0xF800", BENCH_VLINES_SHAPE, false, 0xF800U );
+	BenchCase( "32 vlines, flood, 0xFFFF", BENCH_VLINES_SHAPE, false, 0xFFFFU );
+
+	return HostBench_Close();
+}
@@ -0,0 +1,229 @@
+/***************************************************************************************
+ * @file        bench_lcd_glyphs.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the CGRAM uploads of bar graph animations, with the glyph
+ *              cache and with the glyphs of each frame uploaded by LCD_CreateChar.
+ * @remarks     Built with LCD_GLYPH_CACHE. The display is the HD44780 model of
+ *              host_devices.h on a PCF8574 backpack at 100 kbps. Two horizontal bar
+ *              graphs of 15 cells with 5 levels per cell are animated for 200 frames,
+ *              alone and next to 3 icons of a page, the page changing every 25
+ *              frames (11 glyphs for 8 slots). After each case the bench checks that
+ *              every custom character on the display shows the right bit map.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/i2c/i2c.h>
+#include <Libraries/delay/delay.h>
+#include <Libraries/lcd/lcd.h>
+#include <Libraries/lcd/adapters/lcd_i2c_adapter.h>
+
+#include "host_devices.h"
+#include "host_bench.h"
+
+#ifndef LCD_GLYPH_CACHE
+#error "bench_lcd_glyphs is built with LCD_GLYPH_CACHE"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_LCD_ADDRESS 0x27U
+#define BENCH_COLS 20U
+#define BENCH_LINES 4U
+#define BENCH_FRAMES 200U
+#define BENCH_PAGE_FRAMES 25U
+
+/*!< Bar graph cells and levels per cell. */
+#define BENCH_BAR_CELLS 15U
+#define BENCH_BAR_LEVELS 5U
+
+/*!< Glyph numbers: the bar cell with 1 to 5 columns, then two pages of 3 icons. */
+#define BENCH_GLYPH_BAR 1U
+#define BENCH_GLYPH_ICONS 6U
+#define BENCH_GLYPHS 11U
+#define BENCH_PAGE_ICONS 3U
+
+/*!< The glyph bit maps. */
+static const uint8_t _glyphs[BENCH_GLYPHS][8] = {
+	{ 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x00U },
+	{ 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x00U },
+	{ 0x1CU, 0x1CU, 0x1CU, 0x1CU, 0x1CU, 0x1CU, 0x1CU, 0x00U },
+	{ 0x1EU, 0x1EU, 0x1EU, 0x1EU, 0x1EU, 0x1EU, 0x1EU, 0x00U },
+	{ 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x00U },
+	{ 0x04U, 0x0AU, 0x0AU, 0x0EU, 0x0EU, 0x1FU, 0x1FU, 0x0EU }, /* thermometer */
+	{ 0x04U, 0x04U, 0x0AU, 0x0AU, 0x11U, 0x11U, 0x11U, 0x0EU }, /* drop */
+	{ 0x04U, 0x0EU, 0x0EU, 0x0EU, 0x1FU, 0x00U, 0x04U, 0x00U }, /* bell */
+	{ 0x0EU, 0x1BU, 0x11U, 0x11U, 0x11U, 0x11U, 0x1FU, 0x00U }, /* battery */
+	{ 0x00U, 0x0AU, 0x1FU, 0x1FU, 0x0EU, 0x04U, 0x00U, 0x00U }, /* heart */
+	{ 0x00U, 0x0EU, 0x15U, 0x17U, 0x11U, 0x0EU, 0x00U, 0x00U }  /* clock */
+};
+
+static hostPcf8574_t g_expander;
+static hostHd44780_t g_lcd;
+static lcdHandle_t g_handle;
+
+/*!< The glyph number shown in each cell, 0 for a character of the ROM. */
+static uint8_t g_shown[BENCH_LINES][BENCH_COLS];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Gets the glyph numbers of a frame: a line per bar graph, with the page
+ *        icons in the first columns of the first one.
+ */
+static void RenderFrame( unsigned frame, bool icons, uint8_t cells[2][BENCH_COLS] )
+{
+	const unsigned range = BENCH_BAR_CELLS * BENCH_BAR_LEVELS;
+
+	memset( cells, 0, 2U * BENCH_COLS );
+	for ( unsigned bar = 0; bar < 2U; ++bar )
+	{
+		/* Triangle waves of different periods */
+		const unsigned phase = ( frame * ( 3U + 2U * bar ) ) % ( 2U * range );
+		const unsigned value = ( phase < range ) ? phase : ( 2U * range - phase );
+
+		for ( unsigned c = 0; c < BENCH_BAR_CELLS; ++c )
+		{
+			const unsigned fill = ( value > c * BENCH_BAR_LEVELS ) ? ( value - c * BENCH_BAR_LEVELS ) : 0U;
+
+			cells[bar][BENCH_COLS - BENCH_BAR_CELLS + c] = ( fill == 0U ) ? 0U :
+					(uint8_t)( BENCH_GLYPH_BAR - 1U + ( ( fill > BENCH_BAR_LEVELS ) ? BENCH_BAR_LEVELS : fill ) );
+		}
+	}
+	if ( icons )
+	{
+		const unsigned page = ( frame / BENCH_PAGE_FRAMES ) % 2U;
+
+		for ( unsigned i = 0; i < BENCH_PAGE_ICONS; ++i )
+		{
+			cells[0][i] = (uint8_t)( BENCH_GLYPH_ICONS + page * BENCH_PAGE_ICONS + i );
+		}
+	}
+}
+
+/**
+ * @brief Animates the bar graphs in one way and reports it.
+ */
+static void BenchCase( const char *name, bool icons, bool cache )
+{
+	uint8_t cells[2][BENCH_COLS];
+
+	LCD_Clear( g_handle );
+	/* Nothing cached: the slots of the previous case are forgotten */
+	LCD_SetGlyphTable( g_handle, _glyphs, BENCH_GLYPHS );
+	memset( &g_lcd.stats, 0, sizeof(g_lcd.stats) );
+	HostI2c_ClearStats();
+
+	const uint64_t cycles = HostSim_GetCycles();
+
+	for ( unsigned frame = 0; frame < BENCH_FRAMES; ++frame )
+	{
+		uint8_t codes[BENCH_GLYPHS + 1U] = { 0 };
+		uint8_t used = 0U;
+
+		RenderFrame( frame, icons, cells );
+		if ( !cache )
+		{
+			/* Without an allocator, each frame uploads what it shows to fixed slots */
+			for ( uint8_t line = 0; line < 2U; ++line )
+			{
+				for ( uint8_t col = 0; col < BENCH_COLS; ++col )
+				{
+					const uint8_t glyph = cells[line][col];
+
+					if ( ( glyph != 0U ) && ( codes[glyph] == 0U ) )
+					{
+						codes[glyph] = ++used;
+						LCD_CreateChar( g_handle, codes[glyph], _glyphs[glyph - 1U] );
+					}
+				}
+			}
+		}
+
+		for ( uint8_t line = 0; line < 2U; ++line )
+		{
+			LCD_SetCursor( g_handle, 0U, line );
+			for ( uint8_t col = 0; col < BENCH_COLS; ++col )
+			{
+				const uint8_t glyph = cells[line][col];
+
+				if ( glyph == 0U )
+				{
+					LCD_Write( g_handle, ' ' );
+				}
+				else
+				{
+					LCD_Write( g_handle, cache ? LCD_GetGlyph( g_handle, glyph ) : codes[glyph] );
+				}
+				g_shown[line][col] = glyph;
+			}
+		}
+	}
+
+	const double seconds = (double)( HostSim_GetCycles() - cycles ) / DEFAULT_SYSTEM_CLOCK;
+
+	/* Each cell shows its glyph, or a space */
+	for ( uint8_t line = 0; line < 2U; ++line )
+	{
+		for ( uint8_t col = 0; col < BENCH_COLS; ++col )
+		{
+			const uint8_t code = g_lcd.ddram[line * 0x40U + col];
+			const uint8_t glyph = g_shown[line][col];
+
+			if ( ( glyph == 0U ) ? ( code != ' ' ) :
+					( ( code >= 8U ) || ( memcmp( &g_lcd.cgram[code * 8U], _glyphs[glyph - 1U], 8U ) != 0 ) ) )
+			{
+				HostSim_Fatal( "%s: cell %u,%u shows code 0x%02X instead of glyph %u", name, line, col, code, glyph );
+			}
+		}
+	}
+	if ( g_lcd.stats.ignored != 0U )
+	{
+		HostSim_Fatal( "%s: %llu writes ignored by the busy controller", name,
+				(unsigned long long)g_lcd.stats.ignored );
+	}
+
+	const double uploads = (double)g_lcd.stats.cgramWrites / 8.0;
+
+	HostBench_Report( name, "CGRAM uploads", uploads, "glyphs" );
+	HostBench_Report( name, "CGRAM uploads per frame", uploads / BENCH_FRAMES, "glyphs" );
+	HostBench_Report( name, "bus bytes per frame", (double)HostI2c_GetStats()->bytes / BENCH_FRAMES, "bytes" );
+	HostBench_Report( name, "frame time", seconds * 1e3 / BENCH_FRAMES, "ms" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	HostBench_Open( argc, argv, "bench_lcd_glyphs" );
+
+	HostSim_Init();
+	HostI2c_RemoveSlaves();
+	Delay_Init();
+	HostPcf8574_Init( &g_expander, BENCH_LCD_ADDRESS );
+	HostHd44780_Init( &g_lcd );
+	HostHd44780_AttachPcf8574( &g_lcd, &g_expander );
+
+	g_handle = LCD_Init( LCD_CreateI2CAdapter( I2C0, BENCH_LCD_ADDRESS ), BENCH_COLS, BENCH_LINES, LCD_5x8_DOTS );
+	if ( ( g_handle == NULL ) || ( g_lcd.stats.ignored != 0U ) )
+	{
+		HostSim_Fatal( "the LCD initialization failed" );
+	}
+
+	BenchCase( "bars, CreateChar per frame", false, false );
+	BenchCase( "bars, glyph cache", false, true );
+	BenchCase( "bars+icons, CreateChar per frame", true, false );
+	BenchCase( "bars+icons, glyph cache", true, true );
+
+	return HostBench_Close();
+}
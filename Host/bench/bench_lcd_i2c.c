@@ -0,0 +1,163 @@
+/***************************************************************************************
+ * @file        bench_lcd_i2c.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the character rate of a HD44780 on a PCF8574 backpack,
+ *              with one I2C transaction per expander write and with the bursts of
+ *              the I2C adapter.
+ * @remarks     The display is the HD44780 model of host_devices.h wired to the
+ *              PCF8574 model on I2C0 at 100 kbps. The per write case reproduces the
+ *              former adapter: three transactions per nibble and the 2 us and 100 us
+ *              waits. Both cases write a full 20x4 screen, checked on the model, and
+ *              report the characters per second, the transactions and bus bytes per
+ *              character and the writes the controller ignored because it was busy.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/i2c/i2c.h>
+#include <Libraries/delay/delay.h>
+#include <Libraries/lcd/lcd.h>
+#include <Libraries/lcd/adapters/lcd_i2c_adapter.h>
+
+#include "host_devices.h"
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_LCD_ADDRESS 0x27U
+#define BENCH_COLS 20U
+#define BENCH_LINES 4U
+#define BENCH_SCREENS 8U
+
+/*!< PCF8574 backpack wiring. */
+#define BENCH_PCF_RS 0x01U
+#define BENCH_PCF_E  0x04U
+
+/*!< The dashboard written by both cases. */
+static const char *_lines[BENCH_LINES] = {
+	"Temp   23.5 C  Fan 2",
+	"Press 1013 hPa  OK  ",
+	"RH 45%   Dew 10.9 C ",
+	"Up 12:34:56   Ch 3/8"
+};
+
+/*!< DDRAM address of the lines of a 20x4 module. */
+static const uint8_t _rowOffsets[BENCH_LINES] = { 0x00U, 0x40U, 0x14U, 0x54U };
+
+static hostPcf8574_t g_expander;
+static hostHd44780_t g_lcd;
+static lcdHandle_t g_handle;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Writes a byte as the former adapter did: for each nibble, a write to set
+ *        the data, a write with E high, 2 us, a write with E low and 100 us.
+ */
+static void PerWriteByte( uint8_t value, uint8_t mode )
+{
+	const uint8_t nibbles[2] = {
+		(uint8_t)( ( value & 0xF0U ) | mode | LCD_BACKLIGHT ),
+		(uint8_t)( ( ( value << 4 ) & 0xF0U ) | mode | LCD_BACKLIGHT )
+	};
+
+	for ( unsigned i = 0; i < 2U; ++i )
+	{
+		(void)I2C_WriteSlave( I2C0, BENCH_LCD_ADDRESS, nibbles[i] );
+		(void)I2C_WriteSlave( I2C0, BENCH_LCD_ADDRESS, nibbles[i] | BENCH_PCF_E );
+		Delay_Waitus( 2U );
+		(void)I2C_WriteSlave( I2C0, BENCH_LCD_ADDRESS, nibbles[i] );
+		Delay_Waitus( 100U );
+	}
+}
+
+/**
+ * @brief Writes the dashboard BENCH_SCREENS times in one way and reports it.
+ */
+static void BenchCase( const char *name, bool burst )
+{
+	char screen[BENCH_COLS * BENCH_LINES];
+
+	LCD_Clear( g_handle );
+	memset( &g_lcd.stats, 0, sizeof(g_lcd.stats) );
+	HostI2c_ClearStats();
+
+	const uint64_t cycles = HostSim_GetCycles();
+
+	for ( unsigned s = 0; s < BENCH_SCREENS; ++s )
+	{
+		for ( uint8_t line = 0; line < BENCH_LINES; ++line )
+		{
+			if ( burst )
+			{
+				LCD_SetCursor( g_handle, 0U, line );
+				LCD_WriteString( g_handle, (char*)_lines[line] );
+				continue;
+			}
+			PerWriteByte( LCD_SET_DD_RAM_ADDR | _rowOffsets[line], LCD_COMMAND_MODE );
+			for ( const char *c = _lines[line]; *c != '\0'; ++c )
+			{
+				PerWriteByte( (uint8_t)*c, BENCH_PCF_RS );
+			}
+		}
+	}
+
+	const double seconds = (double)( HostSim_GetCycles() - cycles ) / DEFAULT_SYSTEM_CLOCK;
+	const double chars = (double)BENCH_SCREENS * BENCH_COLS * BENCH_LINES;
+	const hostI2cStats_t *stats = HostI2c_GetStats();
+
+	HostHd44780_GetScreen( &g_lcd, BENCH_COLS, BENCH_LINES, screen );
+	for ( uint8_t line = 0; line < BENCH_LINES; ++line )
+	{
+		if ( memcmp( &screen[line * BENCH_COLS], _lines[line], BENCH_COLS ) != 0 )
+		{
+			HostSim_Fatal( "%s: line %u shows \"%.20s\"", name, line, &screen[line * BENCH_COLS] );
+		}
+	}
+	if ( g_lcd.stats.ignored != 0U )
+	{
+		HostSim_Fatal( "%s: %llu writes ignored by the busy controller", name,
+				(unsigned long long)g_lcd.stats.ignored );
+	}
+
+	HostBench_Report( name, "characters per second", chars / seconds, "chars/s" );
+	HostBench_Report( name, "I2C transactions per character", (double)stats->starts / chars, "transactions" );
+	HostBench_Report( name, "bus bytes per character", (double)stats->bytes / chars, "bytes" );
+	HostBench_Report( name, "writes ignored by the controller", (double)g_lcd.stats.ignored, "writes" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	HostBench_Open( argc, argv, "bench_lcd_i2c" );
+
+	HostSim_Init();
+	HostI2c_RemoveSlaves();
+	Delay_Init();
+	HostPcf8574_Init( &g_expander, BENCH_LCD_ADDRESS );
+	HostHd44780_Init( &g_lcd );
+	HostHd44780_AttachPcf8574( &g_lcd, &g_expander );
+
+	/* LCD_CreateI2CAdapter sets the bus to 100 kbps */
+	g_handle = LCD_Init( LCD_CreateI2CAdapter( I2C0, BENCH_LCD_ADDRESS ), BENCH_COLS, BENCH_LINES, LCD_5x8_DOTS );
+	if ( ( g_handle == NULL ) || !g_lcd.fourBit || !g_lcd.twoLines || ( g_lcd.stats.ignored != 0U ) )
+	{
+		HostSim_Fatal( "the LCD initialization failed" );
+	}
+
+	BenchCase( "100 kbps, 3 transactions per nibble", false );
+	BenchCase( "100 kbps, I2C adapter bursts", true );
+
+	return HostBench_Close();
+}
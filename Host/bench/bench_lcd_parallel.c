@@ -0,0 +1,158 @@
+/***************************************************************************************
+ * @file        bench_lcd_parallel.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the HD44780 parallel adapter with the fixed worst case
+ *              waits and with the busy flag polling.
+ * @remarks     The display is the HD44780 model of host_devices.h wired in 4 bits to
+ *              GPIOB. The model ignores what it latches while busy, so the bench
+ *              checks that no write is lost as well as the screen contents. Reports
+ *              the characters per second of a 20x4 screen, the LCD_Clear time and
+ *              the busy flag reads per character, with a typical controller (37 us,
+ *              1.52 ms) and with a slow one (80 us, 3.3 ms, as at low supply voltage).
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/delay/delay.h>
+#include <Libraries/lcd/lcd.h>
+#include <Libraries/lcd/adapters/lcd_parallel_adapter.h>
+
+#include "host_devices.h"
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_COLS 20U
+#define BENCH_LINES 4U
+#define BENCH_SCREENS 8U
+
+/*!< RS, R/W and E on PTB0..2, DB4..DB7 on PTB8..11. */
+static const hostHd44780Wiring_t _wiring = {
+	.rs = HOSTHD44780_PIN( HOSTSIM_PORT_B, 0U ), .rw = HOSTHD44780_PIN( HOSTSIM_PORT_B, 2U ),
+	.enable = HOSTHD44780_PIN( HOSTSIM_PORT_B, 1U ),
+	.data = {
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 8U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 9U ),
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 10U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 11U )
+	},
+	.dataCount = 4U
+};
+
+/*!< The screen written by every case. */
+static const char *_lines[BENCH_LINES] = {
+	"Temp   23.5 C  Fan 2",
+	"Press 1013 hPa  OK  ",
+	"RH 45%   Dew 10.9 C ",
+	"Up 12:34:56   Ch 3/8"
+};
+
+static hostHd44780_t g_lcd;
+static lcdAdapter_t g_adapter;
+static lcdHandle_t g_handle;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Gets a pin of GPIOB as the adapter takes it.
+ */
+static lcdPin_t BenchPin( uint8_t pin )
+{
+	return (lcdPin_t){ .portRegister = GPIOB, .pinMask = 1UL << pin };
+}
+
+/**
+ * @brief Writes the screen BENCH_SCREENS times and clears it in one configuration,
+ *        and reports it.
+ */
+static void BenchCase( const char *name, uint32_t executionUs, uint32_t clearUs )
+{
+	char screen[BENCH_COLS * BENCH_LINES];
+
+	g_lcd.executionUs = executionUs;
+	g_lcd.clearUs = clearUs;
+	memset( &g_lcd.stats, 0, sizeof(g_lcd.stats) );
+
+	uint64_t cycles = HostSim_GetCycles();
+
+	for ( unsigned s = 0; s < BENCH_SCREENS; ++s )
+	{
+		for ( uint8_t line = 0; line < BENCH_LINES; ++line )
+		{
+			LCD_SetCursor( g_handle, 0U, line );
+			LCD_WriteString( g_handle, (char*)_lines[line] );
+		}
+	}
+
+	const double seconds = (double)( HostSim_GetCycles() - cycles ) / DEFAULT_SYSTEM_CLOCK;
+	const double chars = (double)BENCH_SCREENS * BENCH_COLS * BENCH_LINES;
+	const uint64_t busyReads = g_lcd.stats.busyReads;
+
+	HostHd44780_GetScreen( &g_lcd, BENCH_COLS, BENCH_LINES, screen );
+	for ( uint8_t line = 0; line < BENCH_LINES; ++line )
+	{
+		if ( memcmp( &screen[line * BENCH_COLS], _lines[line], BENCH_COLS ) != 0 )
+		{
+			HostSim_Fatal( "%s: line %u shows \"%.20s\"", name, line, &screen[line * BENCH_COLS] );
+		}
+	}
+
+	/* The clear, and a character to see that the next write waits for its end */
+	cycles = HostSim_GetCycles();
+	LCD_Clear( g_handle );
+	const double clear = (double)( HostSim_GetCycles() - cycles ) * 1e6 / DEFAULT_SYSTEM_CLOCK;
+
+	LCD_WriteString( g_handle, "x" );
+	if ( ( g_lcd.ddram[0] != 'x' ) || ( g_lcd.ddram[1] != ' ' ) || ( g_lcd.stats.ignored != 0U ) )
+	{
+		HostSim_Fatal( "%s: %llu writes ignored by the busy controller", name,
+				(unsigned long long)g_lcd.stats.ignored );
+	}
+
+	HostBench_Report( name, "characters per second", chars / seconds, "chars/s" );
+	HostBench_Report( name, "LCD_Clear time", clear, "us" );
+	HostBench_Report( name, "busy flag reads per character", (double)busyReads / chars, "reads" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	lcdPin_t data[4] = { BenchPin( 8U ), BenchPin( 9U ), BenchPin( 10U ), BenchPin( 11U ) };
+	lcdPin_t rs = BenchPin( 0U );
+	lcdPin_t en = BenchPin( 1U );
+	lcdPin_t rw = BenchPin( 2U );
+
+	HostBench_Open( argc, argv, "bench_lcd_parallel" );
+
+	HostSim_Init();
+	Delay_Init();
+	HostHd44780_Init( &g_lcd );
+	HostHd44780_AttachGpio( &g_lcd, &_wiring );
+
+	/* The pins are outputs, as the application configures them */
+	GPIOB->PDDR |= 0x0F07U;
+
+	g_adapter = LCD_CreateParallelAdapter( data, &rs, &en );
+	g_handle = LCD_Init( g_adapter, BENCH_COLS, BENCH_LINES, LCD_5x8_DOTS );
+	if ( ( g_handle == NULL ) || !g_lcd.fourBit || !g_lcd.twoLines || ( g_lcd.stats.ignored != 0U ) )
+	{
+		HostSim_Fatal( "the LCD initialization failed" );
+	}
+
+	BenchCase( "fixed waits, R/W not wired", HOSTHD44780_EXECUTION_US, HOSTHD44780_CLEAR_US );
+
+	LCD_ParallelSetRwPin( g_adapter, &rw );
+	BenchCase( "busy flag", HOSTHD44780_EXECUTION_US, HOSTHD44780_CLEAR_US );
+	BenchCase( "busy flag, slow controller", 80U, 3300U );
+
+	return HostBench_Close();
+}
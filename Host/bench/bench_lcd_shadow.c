@@ -0,0 +1,173 @@
+/***************************************************************************************
+ * @file        bench_lcd_shadow.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the bytes sent to a HD44780 per update of a 20x4 dashboard,
+ *              when every line is rewritten and with the shadow buffer.
+ * @remarks     Built with LCD_SHADOW_BUFFER. The display is the HD44780 model of
+ *              host_devices.h on a PCF8574 backpack at 100 kbps. The dashboard is
+ *              updated once per simulated second for ten minutes: the clock changes
+ *              at each update, the sensor values every few updates. The rewrite case
+ *              sends what LCD_WriteString sends without the shadow, a DDRAM address
+ *              and a block of 20 characters per line.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/i2c/i2c.h>
+#include <Libraries/delay/delay.h>
+#include <Libraries/lcd/lcd.h>
+#include <Libraries/lcd/adapters/lcd_i2c_adapter.h>
+
+#include "host_devices.h"
+#include "host_bench.h"
+
+#ifndef LCD_SHADOW_BUFFER
+#error "bench_lcd_shadow is built with LCD_SHADOW_BUFFER"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_LCD_ADDRESS 0x27U
+#define BENCH_COLS 20U
+#define BENCH_LINES 4U
+#define BENCH_UPDATES 600U
+
+/*!< DDRAM address of the lines of a 20x4 module. */
+static const uint8_t _rowOffsets[BENCH_LINES] = { 0x00U, 0x40U, 0x14U, 0x54U };
+
+static hostPcf8574_t g_expander;
+static hostHd44780_t g_lcd;
+static lcdAdapter_t g_adapter;
+static lcdHandle_t g_handle;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Formats the dashboard at a given second.
+ */
+static void FormatDashboard( unsigned second, char lines[BENCH_LINES][BENCH_COLS + 1U] )
+{
+	/* Slow sensors: the temperature every 10 s, the humidity every 30 s, the fan every minute */
+	const unsigned temperature = 215U + ( second / 10U ) % 40U;
+	const unsigned humidity = 40U + ( second / 30U ) % 20U;
+
+	snprintf( lines[0], BENCH_COLS + 1U, "Temp %2u.%u C  Fan %u  ", temperature / 10U, temperature % 10U,
+			1U + ( second / 60U ) % 3U );
+	snprintf( lines[1], BENCH_COLS + 1U, "Press 1013 hPa  OK  " );
+	snprintf( lines[2], BENCH_COLS + 1U, "RH %2u%%   Dew 10.9 C ", humidity );
+	snprintf( lines[3], BENCH_COLS + 1U, "Up %02u:%02u:%02u   Ch 3/8", ( second / 3600U ) % 24U, ( second / 60U ) % 60U,
+			second % 60U );
+}
+
+/**
+ * @brief Updates the dashboard BENCH_UPDATES times in one way and reports it.
+ */
+static void BenchCase( const char *name, bool shadow )
+{
+	lcdAdapterInterface_t *adapter = g_adapter;
+	char lines[BENCH_LINES][BENCH_COLS + 1U];
+	char screen[BENCH_COLS * BENCH_LINES];
+
+	memset( &g_lcd.stats, 0, sizeof(g_lcd.stats) );
+	HostI2c_ClearStats();
+
+	uint64_t busy = 0U;
+
+	for ( unsigned second = 0; second < BENCH_UPDATES; ++second )
+	{
+		const uint64_t start = HostSim_GetCycles();
+
+		FormatDashboard( second, lines );
+		for ( uint8_t line = 0; line < BENCH_LINES; ++line )
+		{
+			if ( shadow )
+			{
+				LCD_SetCursor( g_handle, 0U, line );
+				LCD_WriteString( g_handle, lines[line] );
+			}
+			else
+			{
+				LCD_Command( g_handle, LCD_SET_DD_RAM_ADDR | _rowOffsets[line] );
+				adapter->writeBlock( adapter, (const uint8_t*)lines[line], BENCH_COLS, LCD_DATA_MODE );
+			}
+		}
+		if ( shadow )
+		{
+			LCD_Flush( g_handle );
+		}
+		busy += HostSim_GetCycles() - start;
+	}
+
+	HostHd44780_GetScreen( &g_lcd, BENCH_COLS, BENCH_LINES, screen );
+	for ( uint8_t line = 0; line < BENCH_LINES; ++line )
+	{
+		if ( memcmp( &screen[line * BENCH_COLS], lines[line], BENCH_COLS ) != 0 )
+		{
+			HostSim_Fatal( "%s: line %u shows \"%.20s\"", name, line, &screen[line * BENCH_COLS] );
+		}
+	}
+	if ( g_lcd.stats.ignored != 0U )
+	{
+		HostSim_Fatal( "%s: %llu writes ignored by the busy controller", name,
+				(unsigned long long)g_lcd.stats.ignored );
+	}
+
+	const hostI2cStats_t *stats = HostI2c_GetStats();
+
+	HostBench_Report( name, "controller bytes per update",
+			(double)( g_lcd.stats.instructions + g_lcd.stats.dataWrites ) / BENCH_UPDATES, "bytes" );
+	HostBench_Report( name, "address commands per update", (double)g_lcd.stats.instructions / BENCH_UPDATES,
+			"commands" );
+	HostBench_Report( name, "bus bytes per update", (double)stats->bytes / BENCH_UPDATES, "bytes" );
+	HostBench_Report( name, "update time", (double)busy * 1e3 / DEFAULT_SYSTEM_CLOCK / BENCH_UPDATES, "ms" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	HostBench_Open( argc, argv, "bench_lcd_shadow" );
+
+	HostSim_Init();
+	HostI2c_RemoveSlaves();
+	Delay_Init();
+	HostPcf8574_Init( &g_expander, BENCH_LCD_ADDRESS );
+	HostHd44780_Init( &g_lcd );
+	HostHd44780_AttachPcf8574( &g_lcd, &g_expander );
+
+	g_adapter = LCD_CreateI2CAdapter( I2C0, BENCH_LCD_ADDRESS );
+	g_handle = LCD_Init( g_adapter, BENCH_COLS, BENCH_LINES, LCD_5x8_DOTS );
+	if ( ( g_handle == NULL ) || ( g_lcd.stats.ignored != 0U ) )
+	{
+		HostSim_Fatal( "the LCD initialization failed" );
+	}
+
+	BenchCase( "rewrite every line", false );
+	/* The shadow does not know what the rewrite case left: the first flush sends every character */
+	BenchCase( "shadow buffer and LCD_Flush", true );
+
+	/* A CGRAM upload between two flushes: the next flush must set the DDRAM address again */
+	static const uint8_t bar[8] = { 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU };
+
+	LCD_CreateChar( g_handle, 1U, bar );
+	LCD_SetCursor( g_handle, 19U, 1U );
+	LCD_WriteString( g_handle, "\x01" );
+	LCD_Flush( g_handle );
+	if ( ( memcmp( &g_lcd.cgram[8], bar, sizeof(bar) ) != 0 ) || ( g_lcd.ddram[0x40U + 19U] != 0x01U ) )
+	{
+		HostSim_Fatal( "the flush after LCD_CreateChar missed the DDRAM" );
+	}
+
+	return HostBench_Close();
+}
@@ -0,0 +1,178 @@
+/***************************************************************************************
+ * @file        bench_printf.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of snprintf_ from Libraries/printf against the glibc snprintf.
+ * @remarks     For each format reports the host time per call, the stack high-water
+ *              of one call and whether the output is the same as the glibc one. The
+ *              stack is measured by running the call on a painted stack of its own
+ *              (makecontext) and looking for the deepest byte it changed. The values
+ *              are those of the x86-64 build: they follow the changes of the code, not
+ *              the absolute figures of the Cortex-M0+.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <ucontext.h>
+
+#include <common.h>
+#include <Libraries/printf/printf.h>
+
+#include "host_bench.h"
+
+/* The glibc functions, hidden by the macros of printf.h */
+#undef snprintf
+#undef vsnprintf
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_CALLS 100000U
+#define BENCH_REPEAT 5U
+#define BENCH_BUFFER_SIZE 128U
+#define BENCH_STACK_SIZE ( 64U * 1024U )
+#define BENCH_STACK_PAINT 0xA5U
+
+/*!< Formats one case with snprintf_, or with the glibc snprintf if reference is set. */
+typedef int (*benchFormat_t)( char *buffer, size_t size, bool reference );
+
+typedef struct
+{
+	const char *name;
+	benchFormat_t format;
+} benchCase_t;
+
+/* Volatile: keeps the compiler from folding the glibc calls */
+static volatile int g_int = -123456789;
+static volatile unsigned long long g_longLong = 18446744073709551557ULL;
+static volatile unsigned g_hex = 0xBEEFU;
+static volatile double g_double = 3.14159265358979;
+static volatile double g_exponent = 12345.678;
+static const char *volatile g_string = "temperature sensor 2";
+
+static char g_buffer[BENCH_BUFFER_SIZE];
+static uint8_t g_stack[BENCH_STACK_SIZE];
+static ucontext_t g_mainContext, g_caseContext;
+static const benchCase_t *g_stackCase;
+static bool g_stackReference;
+
+/*!< Defines the formatter of a case. */
+#define BENCH_FORMAT( function, ... ) \
+	static int function( char *buffer, size_t size, bool reference ) \
+	{ \
+		return reference ? snprintf( buffer, size, __VA_ARGS__ ) : snprintf_( buffer, size, __VA_ARGS__ ); \
+	}
+
+BENCH_FORMAT( FormatInt, "%d", g_int )
+BENCH_FORMAT( FormatLongLong, "%llu", g_longLong )
+BENCH_FORMAT( FormatHex, "0x%08x", g_hex )
+BENCH_FORMAT( FormatFloat, "%.3f", g_double )
+BENCH_FORMAT( FormatExponent, "%.4e", g_exponent )
+BENCH_FORMAT( FormatPadding, "[%-8d|%8d|%08.2f]", g_int % 1000, g_int % 100, g_double )
+BENCH_FORMAT( FormatString, "%s", g_string )
+BENCH_FORMAT( FormatLogLine, "%s: %5d mV, %6.2f C, %s", g_string, g_int % 4096, g_double * 10.0, "ok" )
+
+static const benchCase_t _cases[] = {
+	{ "%d", FormatInt },
+	{ "%llu", FormatLongLong },
+	{ "0x%08x", FormatHex },
+	{ "%.3f (_ftoa)", FormatFloat },
+	{ "%.4e (_etoa)", FormatExponent },
+	{ "padding", FormatPadding },
+	{ "%s", FormatString },
+	{ "log line", FormatLogLine },
+};
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void StackCase( void )
+{
+	g_stackCase->format( g_buffer, sizeof(g_buffer), g_stackReference );
+}
+
+/**
+ * @brief Runs one call on a painted stack.
+ * @return The bytes of the stack used by the call.
+ */
+static size_t StackHighWater( const benchCase_t *benchCase, bool reference )
+{
+	size_t untouched = 0U;
+
+	memset( g_stack, BENCH_STACK_PAINT, sizeof(g_stack) );
+	g_stackCase = benchCase;
+	g_stackReference = reference;
+
+	getcontext( &g_caseContext );
+	g_caseContext.uc_stack.ss_sp = g_stack;
+	g_caseContext.uc_stack.ss_size = sizeof(g_stack);
+	g_caseContext.uc_link = &g_mainContext;
+	makecontext( &g_caseContext, StackCase, 0 );
+	swapcontext( &g_mainContext, &g_caseContext );
+
+	while ( ( untouched < sizeof(g_stack) ) && ( g_stack[untouched] == BENCH_STACK_PAINT ) )
+	{
+		++untouched;
+	}
+	return sizeof(g_stack) - untouched;
+}
+
+/**
+ * @brief Times one case.
+ * @return The best time per call in ns.
+ */
+static double TimePerCall( const benchCase_t *benchCase, bool reference )
+{
+	double best = 1e300;
+
+	for ( unsigned r = 0; r < BENCH_REPEAT; ++r )
+	{
+		const double start = HostBench_Ns();
+
+		for ( unsigned i = 0; i < BENCH_CALLS; ++i )
+		{
+			benchCase->format( g_buffer, sizeof(g_buffer), reference );
+		}
+
+		const double ns = ( HostBench_Ns() - start ) / BENCH_CALLS;
+
+		best = ( ns < best ) ? ns : best;
+	}
+	return best;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	char expected[BENCH_BUFFER_SIZE];
+	char name[64];
+
+	HostBench_Open( argc, argv, "bench_printf" );
+
+	for ( size_t c = 0; c < sizeof(_cases) / sizeof(_cases[0]); ++c )
+	{
+		const benchCase_t *benchCase = &_cases[c];
+
+		benchCase->format( expected, sizeof(expected), true );
+		benchCase->format( g_buffer, sizeof(g_buffer), false );
+
+		snprintf( name, sizeof(name), "snprintf_ %s", benchCase->name );
+		HostBench_Report( name, "time per call", TimePerCall( benchCase, false ), "ns" );
+		HostBench_Report( name, "stack high-water", (double)StackHighWater( benchCase, false ), "bytes" );
+		HostBench_Report( name, "same output as glibc", strcmp( expected, g_buffer ) == 0, "bool" );
+
+		snprintf( name, sizeof(name), "glibc %s", benchCase->name );
+		HostBench_Report( name, "time per call", TimePerCall( benchCase, true ), "ns" );
+		HostBench_Report( name, "stack high-water", (double)StackHighWater( benchCase, true ), "bytes" );
+	}
+
+	return HostBench_Close();
+}
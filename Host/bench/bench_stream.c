@@ -0,0 +1,169 @@
+/***************************************************************************************
+ * @file        bench_stream.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the byte and block callbacks of the stream layer.
+ * @remarks     The stream writes to and reads from a 32 byte ring, the size of the
+ *              UART0 rings, that a device drains or fills whenever the stream finds
+ *              it full or empty. Reports the indirect calls and the host CPU cycles
+ *              per KiB of Stream_WriteBlocking and Stream_ReadBlocking.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/stream/stream.h>
+
+#include "host_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_RING_SIZE 32U
+#define BENCH_KIB 64U
+#define BENCH_REPEAT 20U
+
+static uint8_t g_ring[BENCH_RING_SIZE];
+static size_t g_ringCount;
+static uint64_t g_calls;
+static uint8_t g_data[BENCH_KIB * 1024U];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static size_t SinkGetAvailToWrite( void )
+{
+	++g_calls;
+	if ( g_ringCount == BENCH_RING_SIZE )
+	{
+		g_ringCount = 0U; /* The device sent the ring */
+	}
+	return BENCH_RING_SIZE - g_ringCount;
+}
+
+/**********************************************************************************/
+static void SinkWrite( const uint8_t data )
+{
+	++g_calls;
+	g_ring[g_ringCount++] = data;
+}
+
+/**********************************************************************************/
+static size_t SinkWriteBlock( const uint8_t *data, size_t length )
+{
+	++g_calls;
+	if ( g_ringCount == BENCH_RING_SIZE )
+	{
+		g_ringCount = 0U;
+	}
+	if ( length > BENCH_RING_SIZE - g_ringCount )
+	{
+		length = BENCH_RING_SIZE - g_ringCount;
+	}
+	memcpy( &g_ring[g_ringCount], data, length );
+	g_ringCount += length;
+	return length;
+}
+
+/**********************************************************************************/
+static size_t SourceGetBytesToRead( void )
+{
+	++g_calls;
+	if ( g_ringCount == 0U )
+	{
+		g_ringCount = BENCH_RING_SIZE; /* The device received a ring */
+	}
+	return g_ringCount;
+}
+
+/**********************************************************************************/
+static uint8_t SourceRead( void )
+{
+	++g_calls;
+	return g_ring[BENCH_RING_SIZE - g_ringCount--];
+}
+
+/**********************************************************************************/
+static size_t SourceReadBlock( uint8_t *data, size_t length )
+{
+	++g_calls;
+	if ( g_ringCount == 0U )
+	{
+		g_ringCount = BENCH_RING_SIZE;
+	}
+	if ( length > g_ringCount )
+	{
+		length = g_ringCount;
+	}
+	memcpy( data, &g_ring[BENCH_RING_SIZE - g_ringCount], length );
+	g_ringCount -= length;
+	return length;
+}
+
+/**
+ * @brief Runs one direction of the stream and reports it.
+ */
+static void BenchCase( streamHandle_t stream, const char *name, bool write )
+{
+	uint64_t best = UINT64_MAX;
+
+	for ( unsigned r = 0; r < BENCH_REPEAT; ++r )
+	{
+		g_ringCount = write ? 0U : BENCH_RING_SIZE;
+		g_calls = 0U;
+
+		const uint64_t start = HostBench_Tsc();
+
+		if ( write )
+		{
+			Stream_WriteBlocking( stream, g_data, sizeof(g_data) );
+		}
+		else
+		{
+			Stream_ReadBlocking( stream, g_data, sizeof(g_data) );
+		}
+
+		const uint64_t cycles = HostBench_Tsc() - start;
+
+		best = ( cycles < best ) ? cycles : best;
+	}
+	HostBench_Report( name, "indirect calls per KiB", (double)g_calls / BENCH_KIB, "calls" );
+	HostBench_Report( name, "host cycles per KiB", (double)best / BENCH_KIB, "cycles" );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	/* The stream layer keeps a single static configuration */
+	streamConfig_t *config = Stream_CreateConfig();
+	streamHandle_t stream;
+
+	HostBench_Open( argc, argv, "bench_stream" );
+	memset( g_data, 0x55, sizeof(g_data) );
+
+	config->GetAvailToWrite = SinkGetAvailToWrite;
+	config->Write = SinkWrite;
+	config->GetBytesToRead = SourceGetBytesToRead;
+	config->Read = SourceRead;
+	config->newLine = (const unsigned char*)"\n";
+	stream = Stream_Init( config );
+
+	BenchCase( stream, "WriteBlocking, byte callbacks", true );
+	BenchCase( stream, "ReadBlocking, byte callbacks", false );
+
+	config->WriteBlock = SinkWriteBlock;
+	config->ReadBlock = SourceReadBlock;
+
+	BenchCase( stream, "WriteBlocking, block callbacks", true );
+	BenchCase( stream, "ReadBlocking, block callbacks", false );
+
+	return HostBench_Close();
+}
@@ -0,0 +1,190 @@
+/***************************************************************************************
+ * @file        bench_ugui.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Benchmark of the bus traffic of the uGUI updates on the display HAL,
+ *              with the uGUI pixel callback only and with the acceleration drivers
+ *              of ugui_display.h.
+ * @remarks     Built with USE_UGUI. The display is the ILI9320 of the TFT LCD model
+ *              of host_devices.h on the 8-bit bus. A window with a title, two
+ *              buttons and a textbox is shown on a black screen by UG_Update, its
+ *              textbox text is changed, then UG_Update runs with nothing to draw.
+ *              The window drawn by both ways is compared pixel by pixel and written
+ *              as bench/bench_ugui.ppm, next to the JSON report. The bus bytes,
+ *              window commands, pixels and bus time of each UG_Update are reported.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/display/display.h>
+#include <Libraries/display/drivers/display_ili9320.h>
+#include <Libraries/ili9320/ili9320.h>
+#include <Libraries/ugui/ugui_display.h>
+
+#include "host_devices.h"
+#include "host_bench.h"
+
+#ifndef USE_UGUI
+#error "bench_ugui is built with USE_UGUI"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Bus pins of the boards: data and DC, CS on PTA, data, WR and RD on PTB. */
+#define BENCH_PTA_PINS ( ( 1UL << 0 ) | ( 1UL << 8 ) | ( 1UL << 10 ) | ( 1UL << 11 ) | ( 1UL << 12 ) )
+#define BENCH_PTB_PINS ( ( 1UL << 5 ) | ( 1UL << 6 ) | ( 1UL << 7 ) | ( 1UL << 8 ) | ( 1UL << 9 ) | \
+		( 1UL << 10 ) | ( 1UL << 11 ) )
+
+#define BENCH_OBJECTS 3U
+
+static hostTftLcd_t g_lcd;
+static displayHandle_t g_display;
+
+static UG_GUI g_gui;
+static UG_WINDOW g_window;
+static UG_OBJECT g_objects[BENCH_OBJECTS];
+static UG_BUTTON g_buttons[2];
+static UG_TEXTBOX g_textbox;
+
+/*!< The window drawn with the pixel callback only, to which the drivers are compared. */
+static uint16_t g_expected[HOSTTFTLCD_GRAM_HEIGHT][HOSTTFTLCD_GRAM_WIDTH];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief The window callback: the bench has no touch events.
+ */
+static void WindowCallback( UG_MESSAGE *msg )
+{
+	(void)msg;
+}
+
+/**
+ * @brief Creates the window and its objects.
+ */
+static void CreateWindow( void )
+{
+	UG_WindowCreate( &g_window, g_objects, BENCH_OBJECTS, WindowCallback );
+	UG_WindowResize( &g_window, 10, 10, 309, 229 );
+	UG_WindowSetTitleText( &g_window, "Pump control" );
+	UG_WindowSetTitleTextFont( &g_window, &FONT_8X12 );
+
+	UG_ButtonCreate( &g_window, &g_buttons[0], BTN_ID_0, 10, 10, 130, 60 );
+	UG_ButtonSetFont( &g_window, BTN_ID_0, &FONT_8X12 );
+	UG_ButtonSetText( &g_window, BTN_ID_0, "Start" );
+	UG_ButtonCreate( &g_window, &g_buttons[1], BTN_ID_1, 150, 10, 280, 60 );
+	UG_ButtonSetFont( &g_window, BTN_ID_1, &FONT_8X12 );
+	UG_ButtonSetText( &g_window, BTN_ID_1, "Stop" );
+
+	UG_TextboxCreate( &g_window, &g_textbox, TXB_ID_0, 10, 80, 280, 170 );
+	UG_TextboxSetFont( &g_window, TXB_ID_0, &FONT_12X16 );
+	UG_TextboxSetForeColor( &g_window, TXB_ID_0, C_YELLOW );
+	UG_TextboxSetBackColor( &g_window, TXB_ID_0, C_NAVY );
+	UG_TextboxSetAlignment( &g_window, TXB_ID_0, ALIGN_CENTER );
+	UG_TextboxSetText( &g_window, TXB_ID_0, "Flow 12.5 l/min" );
+}
+
+/**
+ * @brief Runs UG_Update and reports its bus traffic.
+ */
+static void BenchCase( const char *name )
+{
+	g_lcd.stats = (hostTftLcdStats_t){ 0 };
+
+	const uint64_t cycles = HostSim_GetCycles();
+
+	UG_Update();
+
+	const double seconds = (double)( HostSim_GetCycles() - cycles ) / DEFAULT_SYSTEM_CLOCK;
+
+	if ( g_lcd.stats.violations != 0U )
+	{
+		HostSim_Fatal( "%s: %llu bus timing violations", name, (unsigned long long)g_lcd.stats.violations );
+	}
+
+	HostBench_Report( name, "bus bytes", (double)g_lcd.stats.bytes, "bytes" );
+	HostBench_Report( name, "window commands", (double)g_lcd.stats.windowCommands, "commands" );
+	HostBench_Report( name, "pixels", (double)g_lcd.stats.pixels, "pixels" );
+	HostBench_Report( name, "bus time", seconds * 1e3, "ms" );
+}
+
+/**
+ * @brief Shows the window on a black screen.
+ */
+static void ShowWindow( const char *name, bool drivers )
+{
+	memset( g_lcd.gram, 0, sizeof(g_lcd.gram) );
+	if ( drivers )
+	{
+		UG_DriverEnable( DRIVER_FILL_FRAME );
+		UG_DriverEnable( DRIVER_DRAW_LINE );
+	}
+	else
+	{
+		UG_DriverDisable( DRIVER_FILL_FRAME );
+		UG_DriverDisable( DRIVER_DRAW_LINE );
+	}
+
+	UG_WindowShow( &g_window );
+	BenchCase( name );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( int argc, char **argv )
+{
+	char image[256] = "bench_ugui.ppm";
+
+	HostBench_Open( argc, argv, "bench_ugui" );
+	/* The image goes next to the report */
+	if ( ( argc > 1 ) && ( strlen( argv[1] ) < sizeof(image) ) && ( strrchr( argv[1], '.' ) != NULL ) )
+	{
+		strcpy( image, argv[1] );
+		strcpy( strrchr( image, '.' ), ".ppm" );
+	}
+
+	HostSim_Init();
+	Delay_Init();
+	HostTftLcd_AttachGpio( &g_lcd );
+
+	/* The pins are outputs and the control lines idle, as the application configures them */
+	GPIOA->PSOR = ( 1UL << 0 ) | ( 1UL << 8 );
+	GPIOB->PSOR = ( 1UL << 8 ) | ( 1UL << 9 );
+	GPIOA->PDDR |= BENCH_PTA_PINS;
+	GPIOB->PDDR |= BENCH_PTB_PINS;
+	HostTftLcd_Init( &g_lcd, HOSTTFTLCD_ILI9320 );
+	ili9320_Init();
+
+	g_display = Display_Init( &g_displayIli9320Driver );
+	UGUI_DisplayInit( &g_gui, g_display );
+	UG_FontSelect( &FONT_8X12 );
+	CreateWindow();
+
+	ShowWindow( "show window, pixel callback", false );
+	memcpy( g_expected, g_lcd.gram, sizeof(g_expected) );
+	ShowWindow( "show window, HAL drivers", true );
+	if ( memcmp( g_expected, g_lcd.gram, sizeof(g_expected) ) != 0 )
+	{
+		HostSim_Fatal( "the window drawn by the HAL drivers differs from the pixel callback one" );
+	}
+	if ( !HostTftLcd_WritePpm( &g_lcd, image ) )
+	{
+		HostSim_Fatal( "%s could not be written", image );
+	}
+	printf( "  window image: %s\n", image );
+
+	UG_TextboxSetText( &g_window, TXB_ID_0, "Flow 13.0 l/min" );
+	BenchCase( "textbox text, HAL drivers" );
+	BenchCase( "nothing to draw, HAL drivers" );
+
+	return HostBench_Close();
+}
@@ -0,0 +1,104 @@
+/***************************************************************************************
+ * @file        host_bench.h
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Report helpers of the host benchmarks.
+ * @remarks     A benchmark prints its results as a table and, when the program gets
+ *              a path as its first argument (the bench target passes one), also
+ *              writes them there as JSON:
+ *              {"benchmark": name, "results": [{"case", "metric", "value", "unit"}]}
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef HOST_BENCH_H_
+#define HOST_BENCH_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "host_sim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< JSON report of the program, NULL if it only prints. */
+static FILE *g_hostBenchJson;
+/*!< Results written to the JSON report. */
+static unsigned g_hostBenchResults;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**
+ * @brief Starts the report of a benchmark program.
+ */
+static inline void HostBench_Open( int argc, char **argv, const char *name )
+{
+	if ( argc > 1 )
+	{
+		g_hostBenchJson = fopen( argv[1], "w" );
+		if ( g_hostBenchJson == NULL )
+		{
+			perror( argv[1] );
+			exit( EXIT_FAILURE );
+		}
+		fprintf( g_hostBenchJson, "{\n  \"benchmark\": \"%s\",\n  \"results\": [", name );
+	}
+	printf( "%s\n", name );
+	printf( "  %-36s %-28s %14s\n", "case", "metric", "value" );
+}
+
+/**
+ * @brief Adds a result to the report.
+ */
+static inline void HostBench_Report( const char *testCase, const char *metric, double value, const char *unit )
+{
+	printf( "  %-36s %-28s %14.2f %s\n", testCase, metric, value, unit );
+	if ( g_hostBenchJson != NULL )
+	{
+		fprintf( g_hostBenchJson, "%s\n    {\"case\": \"%s\", \"metric\": \"%s\", \"value\": %.6g, \"unit\": \"%s\"}",
+				( g_hostBenchResults++ == 0U ) ? "" : ",", testCase, metric, value, unit );
+	}
+}
+
+/**
+ * @brief Ends the report.
+ * @return The exit status of the program.
+ */
+static inline int HostBench_Close( void )
+{
+	if ( g_hostBenchJson != NULL )
+	{
+		fprintf( g_hostBenchJson, "\n  ]\n}\n" );
+		fclose( g_hostBenchJson );
+	}
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Reads the time stamp counter of the host CPU.
+ * @note The builtins are used because <x86intrin.h> clashes with the CMSIS
+ *       macros (__I, __O, ...) of the device header.
+ */
+static inline uint64_t HostBench_Tsc( void )
+{
+	__builtin_ia32_lfence();
+	return __builtin_ia32_rdtsc();
+}
+
+/**
+ * @brief Reads a monotonic host clock in nanoseconds.
+ */
+static inline double HostBench_Ns( void )
+{
+	struct timespec now;
+
+	clock_gettime( CLOCK_MONOTONIC, &now );
+	return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+#endif /* HOST_BENCH_H_ */
@@ -0,0 +1,22 @@
+/***************************************************************************************
+ * @file        heap_host.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       FreeRTOS heap of the host build: heap_1 with a larger pool.
+ * @remarks     The kernel objects have 64-bit pointers on the host, so the TCBs and
+ *              queues take about twice their target size. The allocator is the one of
+ *              the target, built with a pool HOST_HEAP_SCALE times configTOTAL_HEAP_SIZE.
+ *              xPortGetFreeHeapSize is therefore not comparable with the target.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "FreeRTOS.h"
+
+/*!< Pool size factor over the target configTOTAL_HEAP_SIZE. */
+#define HOST_HEAP_SCALE 4U
+
+enum { hostTargetHeapSize = configTOTAL_HEAP_SIZE };
+#undef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE ( ( size_t ) hostTargetHeapSize * HOST_HEAP_SCALE )
+
+#include "heap_1.c"
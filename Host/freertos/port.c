@@ -0,0 +1,284 @@
+/***************************************************************************************
+ * @file        port.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       FreeRTOS port of the host build, on top of the simulated Cortex-M0+.
+ * @remarks     It follows Freertos/port.c: SysTick gives the tick, a yield pends
+ *              PendSV and the context switch is done in the PendSV handler. A task
+ *              runs on its own host stack (ucontext); the FreeRTOS stack of the task
+ *              only keeps the pointer to that context. Differences with the target:
+ *               - PendSV has the lowest priority, so a switch never happens with
+ *                 another handler active on the host stack of the task.
+ *               - The idle task sleeps with WFI instead of spinning, the simulated
+ *                 time only advances on register accesses and events.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "host_sim.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Size of the host stack of a task. The host code needs far more stack than the
+ *   configured target stack depth: libc, the simulator fault handler, 64-bit frames. */
+#define portHOST_STACK_SIZE ( 256U * 1024U )
+
+/*!< Number of StackType_t words holding the context pointer on the task stack. */
+#define portCONTEXT_WORDS ( sizeof(void*) / sizeof(StackType_t) )
+
+#define portNVIC_SYSTICK_CTRL		( ( volatile uint32_t * ) 0xe000e010 )
+#define portNVIC_SYSTICK_LOAD		( ( volatile uint32_t * ) 0xe000e014 )
+#define portNVIC_SYSTICK_CURRENT	( ( volatile uint32_t * ) 0xe000e018 )
+#define portNVIC_INT_CTRL			( ( volatile uint32_t * ) 0xe000ed04 )
+#define portNVIC_SYSPRI3			( ( volatile uint32_t * ) 0xe000ed20 )
+#define portNVIC_SYSTICK_CLK		0x00000004
+#define portNVIC_SYSTICK_INT		0x00000002
+#define portNVIC_SYSTICK_ENABLE		0x00000001
+#define portNVIC_PENDSVCLR			0x08000000
+#define portNVIC_PENDSTCLR			0x02000000
+#define portMIN_INTERRUPT_PRIORITY	( 255UL )
+#define portNVIC_PENDSV_PRI			( portMIN_INTERRUPT_PRIORITY << 16UL )
+#define portNVIC_SYSTICK_PRI		( ( ( uint32_t ) configKERNEL_INTERRUPT_PRIORITY ) << 24UL )
+
+#ifndef configKERNEL_INTERRUPT_PRIORITY
+	#define configKERNEL_INTERRUPT_PRIORITY 0
+#endif
+
+/*!
+ * @brief Host context of a task.
+ */
+typedef struct
+{
+	ucontext_t context;
+	TaskFunction_t code;
+	void *parameters;
+	UBaseType_t criticalNesting;
+} hostTask_t;
+
+/*!< The FreeRTOS current TCB, its first member is the task top of stack. */
+extern void * volatile pxCurrentTCB;
+
+/* Each task maintains its own interrupt status in the critical nesting variable. */
+static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
+
+/*!< Context of xPortStartScheduler, resumed by vPortEndScheduler. */
+static ucontext_t g_schedulerContext;
+
+void xPortPendSVHandler( void );
+void xPortSysTickHandler( void );
+void vPortSVCHandler( void );
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Gets the host context of the current task.
+ */
+static hostTask_t *prvGetCurrentTask( void )
+{
+	const StackType_t *pxTopOfStack = *( StackType_t * const * )pxCurrentTCB;
+	hostTask_t *pxTask;
+
+	memcpy( &pxTask, pxTopOfStack, sizeof( pxTask ) );
+	return pxTask;
+}
+
+/**
+ * @brief Entry point of the host context of every task.
+ */
+static void prvTaskEntry( void )
+{
+	hostTask_t *pxTask = prvGetCurrentTask();
+
+	/* A task started by the PendSV handler returns from it first */
+	if( HostSim_GetIpsr() != 0U )
+	{
+		HostSim_ExceptionReturn();
+	}
+	uxCriticalNesting = pxTask->criticalNesting;
+	portENABLE_INTERRUPTS();
+
+	if( strcmp( pcTaskGetName( NULL ), "IDLE" ) == 0 )
+	{
+		/* The idle task only sleeps: with no idle hook and no deleted task to
+		clean (heap_1), its loop would just spin without advancing the time. */
+		for( ;; )
+		{
+			HostSim_WaitForInterrupt();
+		}
+	}
+
+	pxTask->code( pxTask->parameters );
+
+	HostSim_Fatal( "task %s returned from its function", pcTaskGetName( NULL ) );
+}
+
+/**
+ * @brief Switches from the current host context to the one of pxCurrentTCB.
+ */
+static void prvSwitchTo( hostTask_t *pxFrom )
+{
+	hostTask_t *pxTo = prvGetCurrentTask();
+
+	if( pxTo != pxFrom )
+	{
+		pxFrom->criticalNesting = uxCriticalNesting;
+		swapcontext( &pxFrom->context, &pxTo->context );
+		uxCriticalNesting = pxFrom->criticalNesting;
+	}
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+	hostTask_t *pxTask = calloc( 1, sizeof( hostTask_t ) );
+	void *pvStack = malloc( portHOST_STACK_SIZE );
+
+	if( ( pxTask == NULL ) || ( pvStack == NULL ) )
+	{
+		HostSim_Fatal( "out of memory for a task context" );
+	}
+	getcontext( &pxTask->context );
+	pxTask->context.uc_stack.ss_sp = pvStack;
+	pxTask->context.uc_stack.ss_size = portHOST_STACK_SIZE;
+	pxTask->context.uc_link = NULL;
+	makecontext( &pxTask->context, prvTaskEntry, 0 );
+	pxTask->code = pxCode;
+	pxTask->parameters = pvParameters;
+	pxTask->criticalNesting = 0;
+
+	/* The task top of stack points to the context pointer */
+	pxTopOfStack -= portCONTEXT_WORDS;
+	memcpy( pxTopOfStack, &pxTask, sizeof( pxTask ) );
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSVCHandler( void )
+{
+	/* Not used, as in the target port. */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+	/* PendSV at the lowest priority, SysTick at the kernel priority. */
+	*( portNVIC_SYSPRI3 ) |= portNVIC_PENDSV_PRI;
+	*( portNVIC_SYSPRI3 ) |= portNVIC_SYSTICK_PRI;
+
+	/* Start the timer that generates the tick ISR.  Interrupts are disabled
+	here already. */
+	*( portNVIC_SYSTICK_CTRL ) = 0UL;
+	*( portNVIC_SYSTICK_CURRENT ) = 0UL;
+	*( portNVIC_SYSTICK_LOAD ) = ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) - 1UL;
+	*( portNVIC_SYSTICK_CTRL ) = portNVIC_SYSTICK_CLK | portNVIC_SYSTICK_INT | portNVIC_SYSTICK_ENABLE;
+
+	/* Initialise the critical nesting count ready for the first task. */
+	uxCriticalNesting = 0;
+
+	/* Start the first task, vPortEndScheduler comes back here. */
+	swapcontext( &g_schedulerContext, &prvGetCurrentTask()->context );
+
+	*( portNVIC_SYSTICK_CTRL ) = 0UL;
+	*( portNVIC_INT_CTRL ) = portNVIC_PENDSVCLR | portNVIC_PENDSTCLR;
+	uxCriticalNesting = 0;
+	portENABLE_INTERRUPTS();
+
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	hostTask_t *pxTask = prvGetCurrentTask();
+
+	/* The host contexts of the tasks are not freed: as with heap_1, the tasks
+	are not deleted. */
+	swapcontext( &pxTask->context, &g_schedulerContext );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	/* Set a PendSV to request a context switch. */
+	*( portNVIC_INT_CTRL ) = portNVIC_PENDSVSET_BIT;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	portDISABLE_INTERRUPTS();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+	if( uxCriticalNesting == 0 )
+	{
+		portENABLE_INTERRUPTS();
+	}
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulSetInterruptMaskFromISR( void )
+{
+	const uint32_t ulMask = HostSim_GetPrimask();
+
+	HostSim_SetPrimask( 1U );
+	return ulMask;
+}
+/*-----------------------------------------------------------*/
+
+void vClearInterruptMaskFromISR( uint32_t ulMask )
+{
+	HostSim_SetPrimask( ulMask );
+}
+/*-----------------------------------------------------------*/
+
+void xPortPendSVHandler( void )
+{
+	hostTask_t *pxTask = prvGetCurrentTask();
+
+	portDISABLE_INTERRUPTS();
+	vTaskSwitchContext();
+	portENABLE_INTERRUPTS();
+
+	prvSwitchTo( pxTask );
+}
+/*-----------------------------------------------------------*/
+
+void xPortSysTickHandler( void )
+{
+	uint32_t ulPreviousMask;
+
+	ulPreviousMask = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Increment the RTOS tick. */
+		if( xTaskIncrementTick() != pdFALSE )
+		{
+			/* Pend a context switch. */
+			*( portNVIC_INT_CTRL ) = portNVIC_PENDSVSET_BIT;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( ulPreviousMask );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,77 @@
+/***************************************************************************************
+ * @file        core_cmFunc.h
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Host replacement of the CMSIS Core Function Access header.
+ * @remarks     It is found before Includes/core_cmFunc.h in the host build include
+ *              path. PRIMASK and IPSR are kept by the simulated core.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef __CORE_CMFUNC_H
+#define __CORE_CMFUNC_H
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup host
+ * @{
+ */
+
+/*******************************************************************************
+ * Simulator entry points
+ ******************************************************************************/
+
+uint32_t HostSim_GetPrimask( void );
+void HostSim_SetPrimask( uint32_t primask );
+uint32_t HostSim_GetIpsr( void );
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+static inline void __enable_irq( void )
+{
+	HostSim_SetPrimask( 0U );
+}
+
+/**********************************************************************************/
+static inline void __disable_irq( void )
+{
+	HostSim_SetPrimask( 1U );
+}
+
+/**********************************************************************************/
+static inline uint32_t __get_PRIMASK( void )
+{
+	return HostSim_GetPrimask();
+}
+
+/**********************************************************************************/
+static inline void __set_PRIMASK( uint32_t priMask )
+{
+	HostSim_SetPrimask( priMask & 1U );
+}
+
+/**********************************************************************************/
+static inline uint32_t __get_IPSR( void )
+{
+	return HostSim_GetIpsr();
+}
+
+/**********************************************************************************/
+static inline uint32_t __get_CONTROL( void )
+{
+	return 0U;
+}
+
+/**********************************************************************************/
+static inline void __set_CONTROL( uint32_t control )
+{
+	(void)control;
+}
+
+/*! @}*/
+
+#endif /* __CORE_CMFUNC_H */
@@ -0,0 +1,121 @@
+/***************************************************************************************
+ * @file        core_cmInstr.h
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Host replacement of the CMSIS Core Instruction Access header.
+ * @remarks     It is found before Includes/core_cmInstr.h in the host build include
+ *              path. The hint instructions advance the simulated clock and the data
+ *              instructions are plain C.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef __CORE_CMINSTR_H
+#define __CORE_CMINSTR_H
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup host
+ * @{
+ */
+
+/*******************************************************************************
+ * Simulator entry points
+ ******************************************************************************/
+
+void HostSim_Nop( void );
+void HostSim_WaitForInterrupt( void );
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+static inline void __NOP( void )
+{
+	HostSim_Nop();
+}
+
+/**********************************************************************************/
+static inline void __WFI( void )
+{
+	HostSim_WaitForInterrupt();
+}
+
+/**********************************************************************************/
+static inline void __WFE( void )
+{
+	HostSim_WaitForInterrupt();
+}
+
+/**********************************************************************************/
+static inline void __SEV( void )
+{
+}
+
+/**********************************************************************************/
+static inline void __ISB( void )
+{
+	__asm volatile ( "" ::: "memory" );
+}
+
+/**********************************************************************************/
+static inline void __DSB( void )
+{
+	__asm volatile ( "" ::: "memory" );
+}
+
+/**********************************************************************************/
+static inline void __DMB( void )
+{
+	__asm volatile ( "" ::: "memory" );
+}
+
+/**********************************************************************************/
+static inline uint32_t __REV( uint32_t value )
+{
+	return __builtin_bswap32( value );
+}
+
+/**********************************************************************************/
+static inline uint32_t __REV16( uint32_t value )
+{
+	return ( ( value & 0xFF00FF00U ) >> 8 ) | ( ( value & 0x00FF00FFU ) << 8 );
+}
+
+/**********************************************************************************/
+static inline int32_t __REVSH( int32_t value )
+{
+	return (int16_t)__builtin_bswap16( (uint16_t)value );
+}
+
+/**********************************************************************************/
+static inline uint32_t __ROR( uint32_t op1, uint32_t op2 )
+{
+	op2 &= 31U;
+	return ( op2 == 0U ) ? op1 : ( op1 >> op2 ) | ( op1 << ( 32U - op2 ) );
+}
+
+/**********************************************************************************/
+static inline uint32_t __RBIT( uint32_t value )
+{
+	uint32_t result = 0U;
+
+	for ( int i = 0; i < 32; ++i )
+	{
+		result = ( result << 1 ) | ( ( value >> i ) & 1U );
+	}
+	return result;
+}
+
+/**********************************************************************************/
+static inline uint8_t __CLZ( uint32_t value )
+{
+	return ( value == 0U ) ? 32U : (uint8_t)__builtin_clz( value );
+}
+
+#define __BKPT( value ) __builtin_trap()
+
+/*! @}*/
+
+#endif /* __CORE_CMINSTR_H */
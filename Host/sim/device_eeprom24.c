@@ -0,0 +1,124 @@
+/***************************************************************************************
+ * @file        device_eeprom24.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of a 24Cxx serial EEPROM on the I2C0 bus.
+ * @remarks     The written bytes go to the array as they arrive and the write cycle
+ *              starts at the STOP. A write interrupted by a repeated START is kept,
+ *              without a write cycle, where the real device would drop it.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_devices.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static bool HostEeprom24_Start( hostI2cSlave_t *slave, bool read )
+{
+	hostEeprom24_t *eeprom = slave->context;
+
+	if ( HostEeprom24_IsBusy( eeprom ) )
+	{
+		++eeprom->stats.naks;
+		return false;
+	}
+	++eeprom->stats.starts;
+	eeprom->addressCount = read ? eeprom->addressBytes : 0U;
+	eeprom->written = false;
+	return true;
+}
+
+/**********************************************************************************/
+static bool HostEeprom24_Write( hostI2cSlave_t *slave, uint8_t data )
+{
+	hostEeprom24_t *eeprom = slave->context;
+
+	++eeprom->stats.bytesWritten;
+	if ( eeprom->addressCount < eeprom->addressBytes )
+	{
+		/* The address comes most significant byte first */
+		eeprom->pointer = ( eeprom->addressCount == 0U ) ? 0U : ( eeprom->pointer << 8 );
+		eeprom->pointer = ( eeprom->pointer | data ) & ( eeprom->size - 1U );
+		++eeprom->addressCount;
+	}
+	else
+	{
+		const uint32_t page = eeprom->pointer & ~(uint32_t)( eeprom->pageSize - 1U );
+
+		eeprom->memory[eeprom->pointer] = data;
+		eeprom->pointer = page | ( ( eeprom->pointer + 1U ) & ( eeprom->pageSize - 1U ) );
+		eeprom->written = true;
+	}
+	return true;
+}
+
+/**********************************************************************************/
+static uint8_t HostEeprom24_Read( hostI2cSlave_t *slave, bool ack )
+{
+	hostEeprom24_t *eeprom = slave->context;
+	const uint8_t value = eeprom->memory[eeprom->pointer];
+
+	(void)ack;
+	++eeprom->stats.bytesRead;
+	/* Sequential reads roll over the whole array */
+	eeprom->pointer = ( eeprom->pointer + 1U ) & ( eeprom->size - 1U );
+	return value;
+}
+
+/**********************************************************************************/
+static void HostEeprom24_Stop( hostI2cSlave_t *slave )
+{
+	hostEeprom24_t *eeprom = slave->context;
+
+	++eeprom->stats.stops;
+	if ( eeprom->written )
+	{
+		++eeprom->pageWrites;
+		eeprom->busyUntil = HostSim_GetCycles() + HostSim_UsToCycles( HOSTEEPROM24_WRITE_CYCLE_US );
+		eeprom->written = false;
+	}
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostEeprom24_Init( hostEeprom24_t *eeprom, uint8_t address, uint8_t *memory, uint32_t size,
+		uint16_t pageSize )
+{
+	if ( ( ( size & ( size - 1U ) ) != 0U ) || ( ( pageSize & ( pageSize - 1U ) ) != 0U ) || ( pageSize > size ) )
+	{
+		HostSim_Fatal( "24Cxx: size %u and page size %u must be powers of 2", size, pageSize );
+	}
+	if ( ( size > 256U ) && ( size < 4096U ) )
+	{
+		HostSim_Fatal( "24Cxx: the 24C04 to 24C16 block addressing is not modeled" );
+	}
+
+	*eeprom = (hostEeprom24_t){
+		.slave = {
+			.address = address, .Start = HostEeprom24_Start, .Write = HostEeprom24_Write,
+			.Read = HostEeprom24_Read, .Stop = HostEeprom24_Stop, .context = eeprom
+		},
+		.memory = memory, .size = size, .pageSize = pageSize,
+		.addressBytes = ( size > 256U ) ? 2U : 1U
+	};
+	HostI2c_AddSlave( &eeprom->slave );
+}
+
+/**********************************************************************************/
+bool HostEeprom24_IsBusy( const hostEeprom24_t *eeprom )
+{
+	return HostSim_GetCycles() < eeprom->busyUntil;
+}
+
+/*! @}*/
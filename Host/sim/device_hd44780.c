@@ -0,0 +1,354 @@
+/***************************************************************************************
+ * @file        device_hd44780.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the HD44780 character LCD controller.
+ * @remarks     Models the bus interface, the address counter, DDRAM, CGRAM and the
+ *              execution times. The display shift, the cursor and the font are not
+ *              modeled: the tests read the characters from DDRAM.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include "host_devices.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Instruction codes, by their highest set bit. */
+#define HOSTHD44780_CLEAR        0x01U
+#define HOSTHD44780_HOME         0x02U
+#define HOSTHD44780_ENTRY_MODE   0x04U
+#define HOSTHD44780_CONTROL      0x08U
+#define HOSTHD44780_SHIFT        0x10U
+#define HOSTHD44780_FUNCTION_SET 0x20U
+#define HOSTHD44780_CGRAM        0x40U
+#define HOSTHD44780_DDRAM        0x80U
+
+/*!< PCF8574 backpack wiring. */
+#define HOSTHD44780_PCF_RS 0x01U
+#define HOSTHD44780_PCF_RW 0x02U
+#define HOSTHD44780_PCF_E  0x04U
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void HostHd44780_Advance( hostHd44780_t *lcd, bool increment )
+{
+	if ( lcd->cgramSelected )
+	{
+		lcd->address = (uint8_t)( lcd->address + ( increment ? 1U : 0x3FU ) ) & 0x3FU;
+	}
+	else if ( lcd->twoLines )
+	{
+		/* 0x00..0x27, then 0x40..0x67 */
+		if ( increment )
+		{
+			lcd->address = ( lcd->address == 0x27U ) ? 0x40U : ( lcd->address == 0x67U ) ? 0x00U : lcd->address + 1U;
+		}
+		else
+		{
+			lcd->address = ( lcd->address == 0x40U ) ? 0x27U : ( lcd->address == 0x00U ) ? 0x67U : lcd->address - 1U;
+		}
+	}
+	else
+	{
+		lcd->address = (uint8_t)( ( lcd->address + ( increment ? 1U : 0x4FU ) ) % 0x50U );
+	}
+}
+
+/**********************************************************************************/
+static void HostHd44780_SetBusy( hostHd44780_t *lcd, uint32_t us )
+{
+	lcd->busyUntil = HostSim_GetCycles() + HostSim_UsToCycles( us );
+}
+
+/**********************************************************************************/
+static void HostHd44780_Instruction( hostHd44780_t *lcd, uint8_t value )
+{
+	uint32_t us = lcd->executionUs;
+
+	if ( value & HOSTHD44780_DDRAM )
+	{
+		lcd->address = value & 0x7FU;
+		lcd->cgramSelected = false;
+	}
+	else if ( value & HOSTHD44780_CGRAM )
+	{
+		lcd->address = value & 0x3FU;
+		lcd->cgramSelected = true;
+	}
+	else if ( value & HOSTHD44780_FUNCTION_SET )
+	{
+		lcd->fourBit = !( value & 0x10U );
+		lcd->twoLines = ( value & 0x08U ) != 0U;
+		lcd->lowNibbleNext = false;
+	}
+	else if ( value & HOSTHD44780_SHIFT )
+	{
+		/* Only the cursor moves are modeled, not the display shift */
+		if ( !( value & 0x08U ) )
+		{
+			HostHd44780_Advance( lcd, ( value & 0x04U ) != 0U );
+		}
+	}
+	else if ( value & HOSTHD44780_CONTROL )
+	{
+		/* Display, cursor and blink: nothing to model */
+	}
+	else if ( value & HOSTHD44780_ENTRY_MODE )
+	{
+		lcd->increment = ( value & 0x02U ) != 0U;
+	}
+	else if ( value & HOSTHD44780_HOME )
+	{
+		lcd->address = 0U;
+		lcd->cgramSelected = false;
+		us = lcd->clearUs;
+	}
+	else if ( value & HOSTHD44780_CLEAR )
+	{
+		memset( lcd->ddram, ' ', sizeof(lcd->ddram) );
+		lcd->address = 0U;
+		lcd->cgramSelected = false;
+		lcd->increment = true;
+		us = lcd->clearUs;
+	}
+	else
+	{
+		/* 0x00 is no instruction */
+		return;
+	}
+	++lcd->stats.instructions;
+	HostHd44780_SetBusy( lcd, us );
+}
+
+/**********************************************************************************/
+static void HostHd44780_Execute( hostHd44780_t *lcd, uint8_t value )
+{
+	if ( HostHd44780_IsBusy( lcd ) )
+	{
+		++lcd->stats.ignored;
+		return;
+	}
+
+	if ( !lcd->rs )
+	{
+		HostHd44780_Instruction( lcd, value );
+		return;
+	}
+
+	if ( lcd->cgramSelected )
+	{
+		lcd->cgram[lcd->address] = value;
+		++lcd->stats.cgramWrites;
+	}
+	else
+	{
+		lcd->ddram[lcd->address] = value;
+	}
+	++lcd->stats.dataWrites;
+	HostHd44780_Advance( lcd, lcd->increment );
+	HostHd44780_SetBusy( lcd, lcd->executionUs );
+}
+
+/**********************************************************************************/
+static void HostHd44780_Read( hostHd44780_t *lcd )
+{
+	uint8_t value;
+
+	if ( !lcd->rs )
+	{
+		value = ( HostHd44780_IsBusy( lcd ) ? 0x80U : 0x00U ) | ( lcd->address & 0x7FU );
+		if ( !lcd->lowNibbleNext )
+		{
+			++lcd->stats.busyReads;
+		}
+	}
+	else
+	{
+		value = lcd->cgramSelected ? lcd->cgram[lcd->address] : lcd->ddram[lcd->address];
+	}
+	lcd->output = ( lcd->fourBit && lcd->lowNibbleNext ) ? (uint8_t)( value << 4 ) : value;
+}
+
+/**********************************************************************************/
+static void HostHd44780_PcfListener( hostPcf8574_t *expander, uint8_t previous, void *context )
+{
+	hostHd44780_t *lcd = context;
+	const uint8_t out = expander->output;
+
+	(void)previous;
+	HostHd44780_SetLines( lcd, ( out & HOSTHD44780_PCF_RS ) != 0U, ( out & HOSTHD44780_PCF_RW ) != 0U,
+			( out & HOSTHD44780_PCF_E ) != 0U, out & 0xF0U );
+	/* During a read the controller drives DB4..DB7, the other pins stay pulled up */
+	expander->input = ( lcd->rw && lcd->enable ) ? ( ( lcd->output & 0xF0U ) | 0x0FU ) : 0xFFU;
+}
+
+/**********************************************************************************/
+static bool HostHd44780_GetPin( const uint32_t pins[HOSTSIM_PORT_COUNT], uint8_t pin )
+{
+	return ( pin != HOSTHD44780_NOT_WIRED ) && ( ( pins[pin >> 5] >> ( pin & 31U ) ) & 1U );
+}
+
+/**********************************************************************************/
+static void HostHd44780_GpioListener( uint32_t port, uint32_t portPins, uint32_t changed, void *context )
+{
+	hostHd44780_t *lcd = context;
+	const hostHd44780Wiring_t *wiring = lcd->wiring;
+	const uint8_t shift = ( wiring->dataCount == 4U ) ? 4U : 0U;
+	uint32_t pins[HOSTSIM_PORT_COUNT];
+	uint32_t dataMask[HOSTSIM_PORT_COUNT] = { 0U };
+	uint32_t levels[HOSTSIM_PORT_COUNT] = { 0U };
+	uint8_t data = 0U;
+
+	(void)port;
+	(void)portPins;
+	(void)changed;
+	for ( uint32_t p = 0; p < HOSTSIM_PORT_COUNT; ++p )
+	{
+		pins[p] = HostGpio_GetPins( p );
+	}
+	for ( uint8_t i = 0; i < wiring->dataCount; ++i )
+	{
+		data |= ( HostHd44780_GetPin( pins, wiring->data[i] ) ? 1U : 0U ) << ( i + shift );
+	}
+
+	HostHd44780_SetLines( lcd, HostHd44780_GetPin( pins, wiring->rs ), HostHd44780_GetPin( pins, wiring->rw ),
+			HostHd44780_GetPin( pins, wiring->enable ), data );
+
+	/* During a read the controller drives the data pins, they float otherwise */
+	for ( uint8_t i = 0; i < wiring->dataCount; ++i )
+	{
+		const uint8_t pin = wiring->data[i];
+
+		dataMask[pin >> 5] |= 1UL << ( pin & 31U );
+		if ( lcd->rw && lcd->enable )
+		{
+			levels[pin >> 5] |= (uint32_t)( ( lcd->output >> ( i + shift ) ) & 1U ) << ( pin & 31U );
+		}
+	}
+	for ( uint32_t p = 0; p < HOSTSIM_PORT_COUNT; ++p )
+	{
+		if ( dataMask[p] != 0U )
+		{
+			HostGpio_SetInputs( p, dataMask[p], levels[p] );
+		}
+	}
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostHd44780_Init( hostHd44780_t *lcd )
+{
+	memset( lcd, 0, sizeof(*lcd) );
+	memset( lcd->ddram, ' ', sizeof(lcd->ddram) );
+	lcd->increment = true;
+	lcd->executionUs = HOSTHD44780_EXECUTION_US;
+	lcd->clearUs = HOSTHD44780_CLEAR_US;
+}
+
+/**********************************************************************************/
+void HostHd44780_SetLines( hostHd44780_t *lcd, bool rs, bool rw, bool enable, uint8_t data )
+{
+	const bool rising = enable && !lcd->enable;
+	const bool falling = !enable && lcd->enable;
+
+	lcd->rs = rs;
+	lcd->rw = rw;
+	lcd->enable = enable;
+
+	if ( rising && rw )
+	{
+		HostHd44780_Read( lcd );
+	}
+	if ( !falling )
+	{
+		return;
+	}
+
+	++lcd->stats.enablePulses;
+	if ( lcd->fourBit && !lcd->lowNibbleNext )
+	{
+		/* High nibble: the byte completes with the next transfer */
+		lcd->highNibble = data & 0xF0U;
+		lcd->lowNibbleNext = true;
+		return;
+	}
+
+	const uint8_t value = lcd->fourBit ? (uint8_t)( lcd->highNibble | ( data >> 4 ) ) : data;
+
+	lcd->lowNibbleNext = false;
+	if ( !rw )
+	{
+		HostHd44780_Execute( lcd, value );
+	}
+	else if ( rs )
+	{
+		/* A data read moves the address counter as a write does */
+		HostHd44780_Advance( lcd, lcd->increment );
+	}
+}
+
+/**********************************************************************************/
+bool HostHd44780_IsBusy( const hostHd44780_t *lcd )
+{
+	return HostSim_GetCycles() < lcd->busyUntil;
+}
+
+/**********************************************************************************/
+void HostHd44780_AttachPcf8574( hostHd44780_t *lcd, hostPcf8574_t *expander )
+{
+	expander->listener = HostHd44780_PcfListener;
+	expander->context = lcd;
+}
+
+/**********************************************************************************/
+void HostHd44780_AttachGpio( hostHd44780_t *lcd, const hostHd44780Wiring_t *wiring )
+{
+	uint32_t ports = 0U;
+
+	lcd->wiring = wiring;
+	ports |= 1UL << ( wiring->rs >> 5 );
+	ports |= 1UL << ( wiring->enable >> 5 );
+	if ( wiring->rw != HOSTHD44780_NOT_WIRED )
+	{
+		ports |= 1UL << ( wiring->rw >> 5 );
+	}
+	for ( uint8_t i = 0; i < wiring->dataCount; ++i )
+	{
+		ports |= 1UL << ( wiring->data[i] >> 5 );
+	}
+	for ( uint32_t p = 0; p < HOSTSIM_PORT_COUNT; ++p )
+	{
+		if ( ports & ( 1UL << p ) )
+		{
+			HostGpio_AddListener( p, HostHd44780_GpioListener, lcd );
+		}
+	}
+}
+
+/**********************************************************************************/
+void HostHd44780_GetScreen( const hostHd44780_t *lcd, uint8_t cols, uint8_t lines, char *screen )
+{
+	const uint8_t offsets[4] = { 0x00U, 0x40U, cols, (uint8_t)( 0x40U + cols ) };
+
+	for ( uint8_t line = 0; line < lines; ++line )
+	{
+		memcpy( &screen[line * cols], &lcd->ddram[offsets[line & 3U]], cols );
+	}
+}
+
+/*! @}*/
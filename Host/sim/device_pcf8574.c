@@ -0,0 +1,82 @@
+/***************************************************************************************
+ * @file        device_pcf8574.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the PCF8574 I/O expander on the I2C0 bus.
+ * @remarks     The outputs change at the acknowledge of each written byte, when the
+ *              listener is called. The interrupt output is not modeled.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_devices.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static bool HostPcf8574_Start( hostI2cSlave_t *slave, bool read )
+{
+	hostPcf8574_t *expander = slave->context;
+
+	(void)read;
+	++expander->stats.starts;
+	return true;
+}
+
+/**********************************************************************************/
+static bool HostPcf8574_Write( hostI2cSlave_t *slave, uint8_t data )
+{
+	hostPcf8574_t *expander = slave->context;
+	const uint8_t previous = expander->output;
+
+	++expander->stats.bytesWritten;
+	expander->output = data;
+	if ( expander->listener != NULL )
+	{
+		expander->listener( expander, previous, expander->context );
+	}
+	return true;
+}
+
+/**********************************************************************************/
+static uint8_t HostPcf8574_Read( hostI2cSlave_t *slave, bool ack )
+{
+	hostPcf8574_t *expander = slave->context;
+
+	(void)ack;
+	++expander->stats.bytesRead;
+	return expander->output & expander->input;
+}
+
+/**********************************************************************************/
+static void HostPcf8574_Stop( hostI2cSlave_t *slave )
+{
+	hostPcf8574_t *expander = slave->context;
+
+	++expander->stats.stops;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostPcf8574_Init( hostPcf8574_t *expander, uint8_t address )
+{
+	*expander = (hostPcf8574_t){
+		.slave = {
+			.address = address, .Start = HostPcf8574_Start, .Write = HostPcf8574_Write,
+			.Read = HostPcf8574_Read, .Stop = HostPcf8574_Stop, .context = expander
+		},
+		.output = 0xFFU, .input = 0xFFU
+	};
+	HostI2c_AddSlave( &expander->slave );
+}
+
+/*! @}*/
@@ -0,0 +1,88 @@
+/***************************************************************************************
+ * @file        device_register_file.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of a generic register-file sensor on the I2C0 bus.
+ * @remarks     The tests play the sensor by writing its registers directly.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include "host_devices.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static bool HostRegisterFile_Start( hostI2cSlave_t *slave, bool read )
+{
+	hostRegisterFile_t *file = slave->context;
+
+	++file->stats.starts;
+	file->pointerNext = !read;
+	return true;
+}
+
+/**********************************************************************************/
+static bool HostRegisterFile_Write( hostI2cSlave_t *slave, uint8_t data )
+{
+	hostRegisterFile_t *file = slave->context;
+
+	++file->stats.bytesWritten;
+	if ( file->pointerNext )
+	{
+		file->pointer = data;
+		file->pointerNext = false;
+	}
+	else
+	{
+		file->registers[file->pointer] = data;
+		file->pointer += file->autoIncrement ? 1U : 0U;
+	}
+	return true;
+}
+
+/**********************************************************************************/
+static uint8_t HostRegisterFile_Read( hostI2cSlave_t *slave, bool ack )
+{
+	hostRegisterFile_t *file = slave->context;
+	const uint8_t value = file->registers[file->pointer];
+
+	(void)ack;
+	++file->stats.bytesRead;
+	file->pointer += file->autoIncrement ? 1U : 0U;
+	return value;
+}
+
+/**********************************************************************************/
+static void HostRegisterFile_Stop( hostI2cSlave_t *slave )
+{
+	hostRegisterFile_t *file = slave->context;
+
+	++file->stats.stops;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostRegisterFile_Init( hostRegisterFile_t *file, uint8_t address )
+{
+	memset( file, 0, sizeof(*file) );
+	file->slave = (hostI2cSlave_t){
+		.address = address, .Start = HostRegisterFile_Start, .Write = HostRegisterFile_Write,
+		.Read = HostRegisterFile_Read, .Stop = HostRegisterFile_Stop, .context = file
+	};
+	file->autoIncrement = true;
+	HostI2c_AddSlave( &file->slave );
+}
+
+/*! @}*/
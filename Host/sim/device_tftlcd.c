@@ -0,0 +1,401 @@
+/***************************************************************************************
+ * @file        device_tftlcd.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the ILI9320 and ILI9341 TFT LCD controllers on the 8-bit
+ *              8080 bus of the boards.
+ * @remarks     Models the bus interface with its write timing, the registers of the
+ *              GRAM address, write window and entry mode, and the GRAM. The display
+ *              timing, the power registers, the scrolling and the reads are not
+ *              modeled: the tests read the pixels from GRAM.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "host_devices.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Data pins of each port, and the data bits on them. */
+#define HOSTTFTLCD_PTA_DATA ( ( 1UL << 10 ) | ( 1UL << 11 ) | ( 1UL << 12 ) )
+#define HOSTTFTLCD_PTB_DATA ( ( 1UL << 5 ) | ( 1UL << 6 ) | ( 1UL << 7 ) | ( 1UL << 10 ) | ( 1UL << 11 ) )
+
+/*!< Control pins. */
+#define HOSTTFTLCD_CS ( 1UL << 0 )  /*!< PTA0 */
+#define HOSTTFTLCD_DC ( 1UL << 8 )  /*!< PTA8 */
+#define HOSTTFTLCD_WR ( 1UL << 9 )  /*!< PTB9 */
+
+/*!< ILI9320 registers. */
+#define HOSTILI9320_ENTRY_MODE 0x03U
+#define HOSTILI9320_GRAM_H     0x20U
+#define HOSTILI9320_GRAM_V     0x21U
+#define HOSTILI9320_GRAM_WRITE 0x22U
+#define HOSTILI9320_WINDOW     0x50U /*!< R50h..R53h: HSA, HEA, VSA, VEA. */
+/*!< ILI9320 entry mode bits. */
+#define HOSTILI9320_AM         0x0008U
+#define HOSTILI9320_ID0        0x0010U
+#define HOSTILI9320_ID1        0x0020U
+/*!< ILI9320 write cycle: WR low and high times. */
+#define HOSTILI9320_WR_LOW_NS  50U
+#define HOSTILI9320_WR_HIGH_NS 50U
+
+/*!< ILI9341 commands. */
+#define HOSTILI9341_CASET      0x2AU
+#define HOSTILI9341_PASET      0x2BU
+#define HOSTILI9341_RAMWR      0x2CU
+#define HOSTILI9341_MADCTL     0x36U
+/*!< ILI9341 memory access control: row/column exchange. */
+#define HOSTILI9341_MV         0x20U
+/*!< ILI9341 write cycle: WR low and high times. */
+#define HOSTILI9341_WR_LOW_NS  15U
+#define HOSTILI9341_WR_HIGH_NS 15U
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Decodes the byte on the data pins.
+ */
+static uint8_t HostTftLcd_DataOf( uint32_t pta, uint32_t ptb )
+{
+	return (uint8_t)( ( ( ptb >> 10 ) & 1U ) | ( ( ( ptb >> 11 ) & 1U ) << 1 ) | ( ( ( pta >> 11 ) & 1U ) << 2 ) |
+			( ( ( ptb >> 5 ) & 1U ) << 3 ) | ( ( ( pta >> 10 ) & 1U ) << 4 ) | ( ( ( pta >> 12 ) & 1U ) << 5 ) |
+			( ( ( ptb >> 6 ) & 1U ) << 6 ) | ( ( ( ptb >> 7 ) & 1U ) << 7 ) );
+}
+
+/**
+ * @brief Converts core cycles to nanoseconds.
+ */
+static uint64_t HostTftLcd_Ns( uint64_t cycles )
+{
+	return cycles * 1000000000ULL / DEFAULT_SYSTEM_CLOCK;
+}
+
+/**
+ * @brief Steps an address inside its window, and tells if it wrapped around.
+ */
+static bool HostTftLcd_Step( uint16_t *address, uint16_t first, uint16_t last, bool increment )
+{
+	if ( increment ? ( *address >= last ) : ( *address <= first ) )
+	{
+		*address = increment ? first : last;
+		return true;
+	}
+	*address = increment ? (uint16_t)( *address + 1U ) : (uint16_t)( *address - 1U );
+	return false;
+}
+
+/**
+ * @brief Writes a pixel at the GRAM address and moves the address.
+ */
+static void HostTftLcd_WritePixel( hostTftLcd_t *lcd, uint16_t color )
+{
+	++lcd->stats.pixels;
+	if ( lcd->controller == HOSTTFTLCD_ILI9320 )
+	{
+		const uint16_t entry = lcd->registers[HOSTILI9320_ENTRY_MODE];
+		const bool hInc = ( entry & HOSTILI9320_ID0 ) != 0U;
+		const bool vInc = ( entry & HOSTILI9320_ID1 ) != 0U;
+
+		if ( ( lcd->row < HOSTTFTLCD_GRAM_HEIGHT ) && ( lcd->column < HOSTTFTLCD_GRAM_WIDTH ) )
+		{
+			lcd->gram[lcd->row][lcd->column] = color;
+		}
+		/* AM selects the address updated first, the other one moves when it wraps */
+		if ( entry & HOSTILI9320_AM )
+		{
+			if ( HostTftLcd_Step( &lcd->row, lcd->window[2], lcd->window[3], vInc ) )
+			{
+				(void)HostTftLcd_Step( &lcd->column, lcd->window[0], lcd->window[1], hInc );
+			}
+		}
+		else if ( HostTftLcd_Step( &lcd->column, lcd->window[0], lcd->window[1], hInc ) )
+		{
+			(void)HostTftLcd_Step( &lcd->row, lcd->window[2], lcd->window[3], vInc );
+		}
+		return;
+	}
+
+	/* ILI9341: the column, then the page. With MV the columns are the GRAM rows */
+	const bool mv = ( lcd->madctl & HOSTILI9341_MV ) != 0U;
+	const uint16_t gramRow = mv ? lcd->column : lcd->row;
+	const uint16_t gramColumn = mv ? lcd->row : lcd->column;
+
+	if ( ( gramRow < HOSTTFTLCD_GRAM_HEIGHT ) && ( gramColumn < HOSTTFTLCD_GRAM_WIDTH ) )
+	{
+		lcd->gram[gramRow][gramColumn] = color;
+	}
+	if ( HostTftLcd_Step( &lcd->column, lcd->window[0], lcd->window[1], true ) )
+	{
+		(void)HostTftLcd_Step( &lcd->row, lcd->window[2], lcd->window[3], true );
+	}
+}
+
+/**
+ * @brief Executes a 16-bit ILI9320 transfer.
+ */
+static void HostTftLcd_Ili9320Word( hostTftLcd_t *lcd, bool dc, uint16_t value )
+{
+	if ( !dc )
+	{
+		/* The index is 16-bit, the registers fit in its low byte */
+		lcd->command = (uint8_t)value;
+		++lcd->stats.commands;
+		if ( lcd->command == HOSTILI9320_GRAM_WRITE )
+		{
+			++lcd->stats.memoryWrites;
+		}
+		else if ( ( lcd->command == HOSTILI9320_GRAM_H ) || ( lcd->command == HOSTILI9320_GRAM_V ) ||
+				( ( lcd->command >= HOSTILI9320_WINDOW ) && ( lcd->command < HOSTILI9320_WINDOW + 4U ) ) )
+		{
+			++lcd->stats.windowCommands;
+		}
+		return;
+	}
+
+	switch ( lcd->command )
+	{
+	case HOSTILI9320_GRAM_WRITE:
+		HostTftLcd_WritePixel( lcd, value );
+		return;
+	case HOSTILI9320_GRAM_H:
+		lcd->column = value & 0xFFU;
+		break;
+	case HOSTILI9320_GRAM_V:
+		lcd->row = value & 0x1FFU;
+		break;
+	case HOSTILI9320_WINDOW:
+	case HOSTILI9320_WINDOW + 1U:
+		lcd->window[lcd->command - HOSTILI9320_WINDOW] = value & 0xFFU;
+		break;
+	case HOSTILI9320_WINDOW + 2U:
+	case HOSTILI9320_WINDOW + 3U:
+		lcd->window[lcd->command - HOSTILI9320_WINDOW] = value & 0x1FFU;
+		break;
+	default:
+		break;
+	}
+	lcd->registers[lcd->command] = value;
+}
+
+/**
+ * @brief Executes an ILI9341 byte.
+ */
+static void HostTftLcd_Ili9341Byte( hostTftLcd_t *lcd, bool dc, uint8_t value )
+{
+	if ( !dc )
+	{
+		lcd->command = value;
+		lcd->paramCount = 0U;
+		++lcd->stats.commands;
+		if ( value == HOSTILI9341_RAMWR )
+		{
+			++lcd->stats.memoryWrites;
+			/* The write starts at the window start */
+			lcd->column = lcd->window[0];
+			lcd->row = lcd->window[2];
+		}
+		else if ( ( value == HOSTILI9341_CASET ) || ( value == HOSTILI9341_PASET ) )
+		{
+			++lcd->stats.windowCommands;
+		}
+		return;
+	}
+
+	const uint32_t index = lcd->paramCount++;
+
+	if ( lcd->command == HOSTILI9341_RAMWR )
+	{
+		if ( ( index & 1U ) == 0U )
+		{
+			lcd->highByte = value;
+		}
+		else
+		{
+			HostTftLcd_WritePixel( lcd, (uint16_t)( ( lcd->highByte << 8 ) | value ) );
+		}
+		return;
+	}
+	if ( index < sizeof(lcd->params) )
+	{
+		lcd->params[index] = value;
+	}
+	if ( ( ( lcd->command == HOSTILI9341_CASET ) || ( lcd->command == HOSTILI9341_PASET ) ) && ( index == 3U ) )
+	{
+		uint16_t *window = &lcd->window[( lcd->command == HOSTILI9341_CASET ) ? 0U : 2U];
+
+		window[0] = (uint16_t)( ( lcd->params[0] << 8 ) | lcd->params[1] );
+		window[1] = (uint16_t)( ( lcd->params[2] << 8 ) | lcd->params[3] );
+	}
+	else if ( ( lcd->command == HOSTILI9341_MADCTL ) && ( index == 0U ) )
+	{
+		lcd->madctl = value;
+	}
+}
+
+/**
+ * @brief Latches the byte on the data pins.
+ */
+static void HostTftLcd_Latch( hostTftLcd_t *lcd, bool dc, uint8_t value )
+{
+	++lcd->stats.bytes;
+	if ( lcd->controller == HOSTTFTLCD_ILI9341 )
+	{
+		HostTftLcd_Ili9341Byte( lcd, dc, value );
+	}
+	else if ( ( dc != lcd->lastDc ) || ( lcd->paramCount == 0U ) )
+	{
+		/* The first byte of a transfer, or a byte after a DC change, restarts the transfer */
+		lcd->highByte = value;
+		lcd->paramCount = 1U;
+	}
+	else
+	{
+		lcd->paramCount = 0U;
+		HostTftLcd_Ili9320Word( lcd, dc, (uint16_t)( ( lcd->highByte << 8 ) | value ) );
+	}
+	lcd->lastByte = value;
+	lcd->lastDc = dc;
+}
+
+/**********************************************************************************/
+static void HostTftLcd_GpioListener( uint32_t port, uint32_t pins, uint32_t changed, void *context )
+{
+	hostTftLcd_t *lcd = context;
+	const uint32_t pta = ( port == HOSTSIM_PORT_A ) ? pins : HostGpio_GetPins( HOSTSIM_PORT_A );
+	const uint32_t ptb = ( port == HOSTSIM_PORT_B ) ? pins : HostGpio_GetPins( HOSTSIM_PORT_B );
+	const bool wr = ( ptb & HOSTTFTLCD_WR ) != 0U;
+	const uint64_t now = HostSim_GetCycles();
+
+	if ( pta & HOSTTFTLCD_CS )
+	{
+		lcd->wr = wr;
+		return;
+	}
+
+	if ( !lcd->wr )
+	{
+		/* The data and DC must hold while WR is low */
+		const uint32_t held = ( port == HOSTSIM_PORT_A ) ? ( HOSTTFTLCD_PTA_DATA | HOSTTFTLCD_DC ) : HOSTTFTLCD_PTB_DATA;
+
+		if ( changed & held )
+		{
+			++lcd->stats.violations;
+		}
+	}
+	if ( wr == lcd->wr )
+	{
+		return;
+	}
+
+	/* A simulator reset restarts the cycle count */
+	if ( ( now >= lcd->wrEdge ) && ( HostTftLcd_Ns( now - lcd->wrEdge ) < ( wr ? lcd->wrLowNs : lcd->wrHighNs ) ) )
+	{
+		++lcd->stats.violations;
+	}
+	lcd->wr = wr;
+	lcd->wrEdge = now;
+	if ( wr )
+	{
+		HostTftLcd_Latch( lcd, ( pta & HOSTTFTLCD_DC ) != 0U, HostTftLcd_DataOf( pta, ptb ) );
+	}
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostTftLcd_Init( hostTftLcd_t *lcd, uint8_t controller )
+{
+	memset( lcd, 0, sizeof(*lcd) );
+	lcd->controller = controller;
+	lcd->wr = ( HostGpio_GetPins( HOSTSIM_PORT_B ) & HOSTTFTLCD_WR ) != 0U;
+	lcd->lastDc = true;
+	if ( controller == HOSTTFTLCD_ILI9320 )
+	{
+		lcd->window[1] = HOSTTFTLCD_GRAM_WIDTH - 1U;
+		lcd->window[3] = HOSTTFTLCD_GRAM_HEIGHT - 1U;
+		lcd->registers[HOSTILI9320_ENTRY_MODE] = HOSTILI9320_ID0 | HOSTILI9320_ID1;
+		lcd->registers[HOSTILI9320_WINDOW + 1U] = lcd->window[1];
+		lcd->registers[HOSTILI9320_WINDOW + 3U] = lcd->window[3];
+		lcd->wrLowNs = HOSTILI9320_WR_LOW_NS;
+		lcd->wrHighNs = HOSTILI9320_WR_HIGH_NS;
+	}
+	else
+	{
+		lcd->window[1] = HOSTTFTLCD_GRAM_WIDTH - 1U;
+		lcd->window[3] = HOSTTFTLCD_GRAM_HEIGHT - 1U;
+		lcd->wrLowNs = HOSTILI9341_WR_LOW_NS;
+		lcd->wrHighNs = HOSTILI9341_WR_HIGH_NS;
+	}
+}
+
+/**********************************************************************************/
+void HostTftLcd_AttachGpio( hostTftLcd_t *lcd )
+{
+	HostGpio_AddListener( HOSTSIM_PORT_A, HostTftLcd_GpioListener, lcd );
+	HostGpio_AddListener( HOSTSIM_PORT_B, HostTftLcd_GpioListener, lcd );
+}
+
+/**********************************************************************************/
+void HostTftLcd_GetSize( const hostTftLcd_t *lcd, uint16_t *width, uint16_t *height )
+{
+	const bool landscape = ( lcd->controller == HOSTTFTLCD_ILI9320 ) || ( lcd->madctl & HOSTILI9341_MV );
+
+	*width = landscape ? HOSTTFTLCD_GRAM_HEIGHT : HOSTTFTLCD_GRAM_WIDTH;
+	*height = landscape ? HOSTTFTLCD_GRAM_WIDTH : HOSTTFTLCD_GRAM_HEIGHT;
+}
+
+/**********************************************************************************/
+uint16_t HostTftLcd_GetPixel( const hostTftLcd_t *lcd, uint16_t x, uint16_t y )
+{
+	if ( lcd->controller == HOSTTFTLCD_ILI9320 )
+	{
+		/* As ili9320_SetCursor: the horizontal address is y, the vertical one 319 - x */
+		return lcd->gram[HOSTTFTLCD_GRAM_HEIGHT - 1U - x][y];
+	}
+	return ( lcd->madctl & HOSTILI9341_MV ) ? lcd->gram[x][y] : lcd->gram[y][x];
+}
+
+/**********************************************************************************/
+bool HostTftLcd_WritePpm( const hostTftLcd_t *lcd, const char *path )
+{
+	FILE *file = fopen( path, "wb" );
+	uint16_t width, height;
+
+	if ( file == NULL )
+	{
+		return false;
+	}
+	HostTftLcd_GetSize( lcd, &width, &height );
+	fprintf( file, "P6\n%u %u\n255\n", width, height );
+	for ( uint16_t y = 0; y < height; ++y )
+	{
+		for ( uint16_t x = 0; x < width; ++x )
+		{
+			/* RGB565 to 8 bits per channel, the high bits repeated in the low ones */
+			const uint16_t color = HostTftLcd_GetPixel( lcd, x, y );
+			const uint8_t r = (uint8_t)( ( color >> 11 ) & 0x1FU ), g = (uint8_t)( ( color >> 5 ) & 0x3FU );
+			const uint8_t b = (uint8_t)( color & 0x1FU );
+			const uint8_t rgb[3] = {
+				(uint8_t)( ( r << 3 ) | ( r >> 2 ) ), (uint8_t)( ( g << 2 ) | ( g >> 4 ) ), (uint8_t)( ( b << 3 ) | ( b >> 2 ) )
+			};
+
+			fwrite( rgb, 1U, sizeof(rgb), file );
+		}
+	}
+	return fclose( file ) == 0;
+}
+
+/*! @}*/
@@ -0,0 +1,49 @@
+/***************************************************************************************
+ * @file        host_delay.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Host backend of Libraries/delay, replacing delay.c in the host build.
+ * @remarks     delay.c counts the cycles with Cortex-M NOP loops written in assembly.
+ *              Here the same waits advance the simulated time, with the interrupts
+ *              and events that happen meanwhile, as the busy loops do on the target.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "delay.h"
+
+#include "host_sim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+uint32_t g_mcuCoreFrequency;
+uint32_t g_mcuCyclesForUs, g_mcuCyclesForMs;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void Delay_Init(void)
+{
+	g_mcuCoreFrequency = DELAY_CLOCK_FREQUENCY;
+	g_mcuCyclesForMs = (g_mcuCoreFrequency/1000);
+	g_mcuCyclesForUs = (g_mcuCoreFrequency/1000)/1000;
+}
+
+/**********************************************************************************/
+void Delay_WaitCycles(uint32_t cycles)
+{
+	HostSim_Advance(cycles);
+}
+
+/**********************************************************************************/
+void Delay_Waitms(uint16_t ms)
+{
+	while (ms > 0)
+	{
+		Delay_WaitCycles(g_mcuCyclesForMs);
+		--ms;
+	}
+}
@@ -0,0 +1,335 @@
+/***************************************************************************************
+ * @file        host_devices.h
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Behavioural models of the devices wired to the simulated KL05.
+ * @remarks     The devices plug into the peripheral models of host_models.h: the I2C
+ *              slaves are connected to the bus of I2C0 with HostI2c_AddSlave. Each
+ *              device counts its own traffic, the bus counters (SCL cycles, START/STOP
+ *              conditions, bytes) are given by HostI2c_GetStats.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef HOST_DEVICES_H_
+#define HOST_DEVICES_H_
+
+#include "host_models.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Write cycle time of the 24Cxx EEPROM, in microseconds. */
+#define HOSTEEPROM24_WRITE_CYCLE_US 5000U
+
+/*!< Execution time of the HD44780 instructions and data writes, in microseconds (fosc = 270 kHz). */
+#define HOSTHD44780_EXECUTION_US 37U
+/*!< Execution time of the HD44780 clear display and return home instructions, in microseconds. */
+#define HOSTHD44780_CLEAR_US 1520U
+/*!< A GPIO pin of a HD44780 wiring: HOSTSIM_PORT_A or HOSTSIM_PORT_B, and the pin number. */
+#define HOSTHD44780_PIN(port, pin) ( (uint8_t)( ( (port) << 5 ) | (pin) ) )
+/*!< A HD44780 line that is not wired to the GPIO, as R/W tied to ground. */
+#define HOSTHD44780_NOT_WIRED 0xFFU
+
+/*!< Controllers of the TFT LCD model. */
+#define HOSTTFTLCD_ILI9320 0U
+#define HOSTTFTLCD_ILI9341 1U
+/*!< GRAM size of the TFT LCD controllers, in pixels. */
+#define HOSTTFTLCD_GRAM_WIDTH 240U
+#define HOSTTFTLCD_GRAM_HEIGHT 320U
+
+/*!
+ * @brief Traffic counters of an I2C slave device.
+ */
+typedef struct
+{
+	uint64_t starts;       /*!< Times the device was addressed, by a START or a repeated START. */
+	uint64_t stops;        /*!< STOP conditions ending a transaction with the device. */
+	uint64_t bytesWritten; /*!< Data bytes received from the master. */
+	uint64_t bytesRead;    /*!< Data bytes sent to the master. */
+	uint64_t naks;         /*!< Addressings not acknowledged (busy device). */
+} hostDeviceStats_t;
+
+typedef struct hostPcf8574_s hostPcf8574_t;
+
+/*!
+ * @brief Called when the master writes the output latch of a PCF8574.
+ *
+ * @param expander - the expander, its output field has the new value.
+ * @param previous - the value before the write.
+ */
+typedef void (*hostPcf8574Listener_t)( hostPcf8574_t *expander, uint8_t previous, void *context );
+
+/*!
+ * @brief PCF8574 8-bit quasi-bidirectional I/O expander, as on the HD44780 LCD backpacks.
+ *
+ * Each written byte sets the output latch, each read byte gives the pin levels:
+ * a pin latched high is a weak pull-up that the outside can pull low.
+ */
+struct hostPcf8574_s
+{
+	hostI2cSlave_t slave;
+	uint8_t output;                 /*!< Output latch, 0xFF at power up. */
+	uint8_t input;                  /*!< Levels driven from outside, 0xFF if nothing pulls low. */
+	hostPcf8574Listener_t listener; /*!< Called on each write, or NULL. */
+	void *context;                  /*!< Argument of the listener. */
+	hostDeviceStats_t stats;
+};
+
+/*!
+ * @brief 24Cxx serial EEPROM.
+ *
+ * One address byte up to 256 bytes (24C01/24C02) and two from 4 KiB (24C32 and
+ * up). The 24C04 to 24C16, which take the upper address bits in the slave
+ * address, are not modeled. A write wraps around in its page, and the page is
+ * programmed at the STOP: during the write cycle the device does not acknowledge
+ * its address (acknowledge polling).
+ */
+typedef struct
+{
+	hostI2cSlave_t slave;
+	uint8_t *memory;       /*!< The array, given by the test. */
+	uint32_t size;         /*!< Size of the array in bytes, a power of 2. */
+	uint16_t pageSize;     /*!< Page size in bytes, a power of 2. */
+	uint32_t pointer;      /*!< Current address. */
+	uint8_t addressBytes;  /*!< Address bytes of a write: 1 or 2. */
+	uint8_t addressCount;  /*!< Address bytes received in the current write. */
+	bool written;          /*!< The current write has data bytes. */
+	uint64_t busyUntil;    /*!< End of the write cycle, in core cycles. */
+	uint64_t pageWrites;   /*!< Write cycles. */
+	hostDeviceStats_t stats;
+} hostEeprom24_t;
+
+/*!
+ * @brief Generic register-file sensor: 256 registers of 1 byte.
+ *
+ * The first byte of a write selects the register, the following ones are written
+ * from there. Reads start at the selected register. The register pointer is
+ * incremented after each access when autoIncrement is set.
+ */
+typedef struct
+{
+	hostI2cSlave_t slave;
+	uint8_t registers[256];
+	uint8_t pointer;       /*!< Selected register. */
+	bool autoIncrement;    /*!< Burst accesses, set by HostRegisterFile_Init. */
+	bool pointerNext;      /*!< The next written byte selects the register. */
+	hostDeviceStats_t stats;
+} hostRegisterFile_t;
+
+/*!
+ * @brief Traffic counters of a HD44780.
+ */
+typedef struct
+{
+	uint64_t instructions; /*!< Executed instructions. */
+	uint64_t dataWrites;   /*!< Executed DDRAM/CGRAM writes. */
+	uint64_t ignored;      /*!< Instructions and data writes lost because the controller was busy. */
+	uint64_t cgramWrites;  /*!< Executed CGRAM writes, included in dataWrites. */
+	uint64_t busyReads;    /*!< Reads of the busy flag and address counter. */
+	uint64_t enablePulses; /*!< Falling edges of E. */
+} hostHd44780Stats_t;
+
+/*!
+ * @brief Wiring of a HD44780 to GPIO pins, given with HOSTHD44780_PIN.
+ *
+ * With 4 data pins, data[0] to data[3] are DB4 to DB7 and DB0 to DB3 are not
+ * wired. With 8, data[0] to data[7] are DB0 to DB7. The pins can be spread
+ * over both ports.
+ */
+typedef struct
+{
+	uint8_t rs;
+	uint8_t rw;        /*!< HOSTHD44780_NOT_WIRED when tied to ground. */
+	uint8_t enable;
+	uint8_t data[8];
+	uint8_t dataCount; /*!< 4 or 8. */
+} hostHd44780Wiring_t;
+
+/*!
+ * @brief HD44780 character LCD controller, with the data bus wired in 4 or 8 bits.
+ *
+ * The controller latches on the falling edge of E and is busy for the execution
+ * time afterwards: what it latches meanwhile is ignored and counted. It powers up
+ * in 8-bit mode and switches to 4 bits with the function set instruction.
+ */
+typedef struct
+{
+	uint8_t ddram[128];
+	uint8_t cgram[64];
+	uint8_t address;       /*!< Address counter. */
+	bool cgramSelected;    /*!< The address counter points to CGRAM. */
+	bool increment;        /*!< Entry mode I/D. */
+	bool twoLines;         /*!< Function set N: the DDRAM has two lines of 40 characters. */
+	bool fourBit;          /*!< 4-bit interface: two transfers per byte. */
+	bool lowNibbleNext;    /*!< In 4-bit mode, the next transfer is the low nibble. */
+	uint8_t highNibble;    /*!< The high nibble of the byte being transferred. */
+	bool enable;           /*!< Level of E. */
+	bool rs;               /*!< Level of RS. */
+	bool rw;               /*!< Level of R/W. */
+	uint8_t output;        /*!< Level driven on DB7..DB0 during a read. */
+	uint64_t busyUntil;    /*!< End of the execution, in core cycles. */
+	uint32_t executionUs;  /*!< Execution time, HOSTHD44780_EXECUTION_US by default. */
+	uint32_t clearUs;      /*!< Clear and home execution time, HOSTHD44780_CLEAR_US by default. */
+	const hostHd44780Wiring_t *wiring; /*!< GPIO wiring, or NULL. */
+	hostHd44780Stats_t stats;
+} hostHd44780_t;
+
+/*!
+ * @brief Traffic counters of a TFT LCD controller.
+ */
+typedef struct
+{
+	uint64_t bytes;          /*!< Bytes latched on the rising edges of WR, with CS low. */
+	uint64_t commands;       /*!< Register indexes (ILI9320) or commands (ILI9341). */
+	uint64_t windowCommands; /*!< Commands of the write window and address: R20h, R21h and R50h..R53h, or 2Ah and 2Bh. */
+	uint64_t memoryWrites;   /*!< GRAM write commands: R22h or 2Ch. */
+	uint64_t pixels;         /*!< Pixels written to GRAM. */
+	uint64_t violations;     /*!< WR pulses shorter than the datasheet minimum, and DC or data changes while WR is low. */
+} hostTftLcdStats_t;
+
+/*!
+ * @brief ILI9320 or ILI9341 TFT LCD controller on the 8-bit 8080 bus of the
+ *        boards: D0 = PTB10, D1 = PTB11, D2 = PTA11, D3 = PTB5, D4 = PTA10,
+ *        D5 = PTA12, D6 = PTB6, D7 = PTB7, WR = PTB9, RD = PTB8, DC = PTA8 and
+ *        CS = PTA0.
+ *
+ * The controller latches a byte on the rising edge of WR. The ILI9320 takes
+ * 16-bit register indexes and values, high byte first, and writes the GRAM
+ * through R22h with the entry mode of R03h inside the window of R50h..R53h. The
+ * ILI9341 takes 8-bit commands and writes the GRAM through 2Ch inside the
+ * columns of 2Ah and the pages of 2Bh. Reads are not modeled.
+ */
+typedef struct
+{
+	uint8_t controller;    /*!< HOSTTFTLCD_ILI9320 or HOSTTFTLCD_ILI9341. */
+	uint16_t gram[HOSTTFTLCD_GRAM_HEIGHT][HOSTTFTLCD_GRAM_WIDTH];
+	uint16_t registers[256]; /*!< ILI9320 registers. */
+	uint8_t command;       /*!< Last register index or command. */
+	uint8_t params[6];     /*!< ILI9341 parameters of the command. */
+	uint32_t paramCount;   /*!< Bytes received since the register index or command. */
+	uint16_t column;       /*!< GRAM address: column (ILI9320 horizontal address). */
+	uint16_t row;          /*!< GRAM address: row (ILI9320 vertical address, ILI9341 page). */
+	uint16_t window[4];    /*!< First and last column, first and last row of the write window. */
+	uint8_t madctl;        /*!< ILI9341 memory access control. */
+	uint8_t highByte;      /*!< The first byte of a 16-bit transfer. */
+	uint8_t lastByte;      /*!< The last byte latched. */
+	bool lastDc;           /*!< DC level of the last byte latched: false for a command. */
+	bool wr;               /*!< Level of WR. */
+	uint64_t wrEdge;       /*!< Core cycle of the last edge of WR. */
+	uint32_t wrLowNs;      /*!< Minimum WR low and high times, in nanoseconds. */
+	uint32_t wrHighNs;
+	hostTftLcdStats_t stats;
+} hostTftLcd_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Initializes a PCF8574 and connects it to the I2C0 bus.
+ */
+void HostPcf8574_Init( hostPcf8574_t *expander, uint8_t address );
+
+/**
+ * @brief Initializes a 24Cxx EEPROM on a memory array and connects it to the I2C0 bus.
+ */
+void HostEeprom24_Init( hostEeprom24_t *eeprom, uint8_t address, uint8_t *memory, uint32_t size,
+		uint16_t pageSize );
+
+/**
+ * @brief Tells if the EEPROM is in a write cycle.
+ */
+bool HostEeprom24_IsBusy( const hostEeprom24_t *eeprom );
+
+/**
+ * @brief Initializes a register file, with its registers cleared, and connects it
+ *        to the I2C0 bus.
+ */
+void HostRegisterFile_Init( hostRegisterFile_t *file, uint8_t address );
+
+/**
+ * @brief Initializes a HD44780 in its power up state, with the display cleared.
+ */
+void HostHd44780_Init( hostHd44780_t *lcd );
+
+/**
+ * @brief Applies the levels of the bus lines.
+ *
+ * @param data - the levels of DB7..DB0. With a 4-bit wiring DB3..DB0 are 0.
+ */
+void HostHd44780_SetLines( hostHd44780_t *lcd, bool rs, bool rw, bool enable, uint8_t data );
+
+/**
+ * @brief Tells if the controller is executing an instruction.
+ */
+bool HostHd44780_IsBusy( const hostHd44780_t *lcd );
+
+/**
+ * @brief Wires a HD44780 to a PCF8574 as on the common backpacks: P0 = RS,
+ *        P1 = R/W, P2 = E, P3 = backlight and P4..P7 = DB4..DB7.
+ */
+void HostHd44780_AttachPcf8574( hostHd44780_t *lcd, hostPcf8574_t *expander );
+
+/**
+ * @brief Wires a HD44780 to GPIO pins. During a read, the controller drives the
+ *        data pins, which the firmware sees in PDIR once they are inputs.
+ *
+ * @param wiring - kept by the model, it must stay valid.
+ */
+void HostHd44780_AttachGpio( hostHd44780_t *lcd, const hostHd44780Wiring_t *wiring );
+
+/**
+ * @brief Copies the characters shown on a display of cols x lines, line after
+ *        line, with the DDRAM layout of the 1, 2 and 4 line modules.
+ */
+void HostHd44780_GetScreen( const hostHd44780_t *lcd, uint8_t cols, uint8_t lines, char *screen );
+
+/**
+ * @brief Initializes a TFT LCD controller in its reset state, with the GRAM black
+ *        and the window on the whole GRAM.
+ *
+ * @param controller - HOSTTFTLCD_ILI9320 or HOSTTFTLCD_ILI9341.
+ */
+void HostTftLcd_Init( hostTftLcd_t *lcd, uint8_t controller );
+
+/**
+ * @brief Wires a TFT LCD controller to the GPIO pins of the boards. Done once per
+ *        program: the GPIO listeners survive the simulator resets.
+ */
+void HostTftLcd_AttachGpio( hostTftLcd_t *lcd );
+
+/**
+ * @brief Gets a pixel in the coordinates of the firmware driver: x to the right
+ *        of the ILI9320 landscape (320x240), or the column of the ILI9341.
+ */
+uint16_t HostTftLcd_GetPixel( const hostTftLcd_t *lcd, uint16_t x, uint16_t y );
+
+/**
+ * @brief Gets the screen size in the coordinates of HostTftLcd_GetPixel.
+ */
+void HostTftLcd_GetSize( const hostTftLcd_t *lcd, uint16_t *width, uint16_t *height );
+
+/**
+ * @brief Writes the screen as a binary PPM image.
+ *
+ * @return false if the file could not be written.
+ */
+bool HostTftLcd_WritePpm( const hostTftLcd_t *lcd, const char *path );
+
+/*! @}*/
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* HOST_DEVICES_H_ */
@@ -0,0 +1,192 @@
+/***************************************************************************************
+ * @file        host_models.h
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Test side interface of the KL05 peripheral models of the host simulator.
+ * @remarks     The firmware talks to the models through the registers only. The tests
+ *              use these functions to play the part of the outside world: UART line,
+ *              pin levels, analog inputs and I2C slaves.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef HOST_MODELS_H_
+#define HOST_MODELS_H_
+
+#include "host_sim.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< GPIO/PORT instance numbers. */
+#define HOSTSIM_PORT_A 0U
+#define HOSTSIM_PORT_B 1U
+#define HOSTSIM_PORT_COUNT 2U
+
+/*!< Maximum number of listeners of each GPIO port. */
+#define HOSTGPIO_MAX_LISTENERS 4U
+
+/*!
+ * @brief Called when the level of output pins of a port changes.
+ *
+ * @param port - the port instance.
+ * @param pins - the level of all the pins of the port.
+ * @param changed - the pins whose level changed.
+ */
+typedef void (*hostGpioListener_t)( uint32_t port, uint32_t pins, uint32_t changed, void *context );
+
+/*!
+ * @brief Gives the analog level of an ADC input channel.
+ *
+ * @return The level as a 16-bit fraction of VREFH. The model keeps the bits of
+ *         the configured resolution.
+ */
+typedef uint16_t (*hostAdcInput_t)( uint32_t channel, void *context );
+
+typedef struct hostI2cSlave_s hostI2cSlave_t;
+
+/*!
+ * @brief An I2C slave device on the bus of I2C0.
+ *
+ * The bus calls the slave at the 9th SCL clock of each byte. A NULL callback
+ * acknowledges everything and reads as 0xFF.
+ */
+struct hostI2cSlave_s
+{
+	uint8_t address; /*!< 7-bit address. */
+	/*! Addressed after a START or repeated START. Returns the ACK of the address. */
+	bool (*Start)( hostI2cSlave_t *slave, bool read );
+	/*! Receives a data byte. Returns the ACK. */
+	bool (*Write)( hostI2cSlave_t *slave, uint8_t data );
+	/*! Sends a data byte. ack is the master answer to it. */
+	uint8_t (*Read)( hostI2cSlave_t *slave, bool ack );
+	/*! The STOP condition, or a START addressing another slave. */
+	void (*Stop)( hostI2cSlave_t *slave );
+	void *context;   /*!< Model specific data. */
+	hostI2cSlave_t *next;
+};
+
+/*!
+ * @brief Bus counters of I2C0.
+ */
+typedef struct
+{
+	uint64_t sclCycles;      /*!< SCL clock periods, 9 per byte plus 1 per START and STOP. */
+	uint64_t starts;         /*!< START conditions. */
+	uint64_t repeatedStarts; /*!< Repeated START conditions. */
+	uint64_t stops;          /*!< STOP conditions. */
+	uint64_t bytes;          /*!< Bytes, address bytes included. */
+	uint64_t naks;           /*!< Bytes not acknowledged. */
+} hostI2cStats_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Adds a listener of the output pins of a GPIO port.
+ */
+void HostGpio_AddListener( uint32_t port, hostGpioListener_t listener, void *context );
+
+/**
+ * @brief Sets the level driven from outside on pins of a port. It is read in
+ *        PDIR for the pins configured as inputs.
+ */
+void HostGpio_SetInputs( uint32_t port, uint32_t mask, uint32_t levels );
+
+/**
+ * @brief Gets the level of all the pins of a port.
+ */
+uint32_t HostGpio_GetPins( uint32_t port );
+
+/**
+ * @brief Gets the firmware register writes to a GPIO port, fast GPIO included.
+ */
+uint64_t HostGpio_GetWriteCount( uint32_t port );
+
+/**
+ * @brief Notifies the PORT model of a pin level change, for the pin interrupts.
+ */
+void HostPort_PinChanged( uint32_t port, uint32_t pin, bool level );
+
+/**
+ * @brief Makes bytes arrive on the UART0 receiver, one frame time apart.
+ */
+void HostUart0_Inject( const uint8_t *data, size_t length );
+
+/**
+ * @brief Gets the bytes sent by the UART0 transmitter since the last clear.
+ */
+const uint8_t *HostUart0_GetTxData( void );
+size_t HostUart0_GetTxCount( void );
+void HostUart0_ClearTx( void );
+
+/**
+ * @brief Gets the number of received bytes lost by a receiver overrun.
+ */
+uint32_t HostUart0_GetOverrunCount( void );
+
+/**
+ * @brief Gets the duration of one UART0 frame in core cycles.
+ */
+uint64_t HostUart0_GetFrameCycles( void );
+
+/**
+ * @brief Sets the analog input of the ADC0 channels. By default they read 0.
+ */
+void HostAdc_SetInput( hostAdcInput_t input, void *context );
+
+/**
+ * @brief Gets the number of finished ADC0 conversions.
+ */
+uint64_t HostAdc_GetConversionCount( void );
+
+/**
+ * @brief Connects a slave to the I2C0 bus.
+ */
+void HostI2c_AddSlave( hostI2cSlave_t *slave );
+
+/**
+ * @brief Disconnects all the slaves.
+ */
+void HostI2c_RemoveSlaves( void );
+
+/**
+ * @brief Gets and clears the bus counters.
+ */
+const hostI2cStats_t *HostI2c_GetStats( void );
+void HostI2c_ClearStats( void );
+
+/**
+ * @brief Gets the SCL period in core cycles for the current I2C0 settings.
+ */
+uint64_t HostI2c_GetSclCycles( void );
+
+/**
+ * @brief Gets the number of TPM counter overflows.
+ * @param instance - 0 for TPM0, 1 for TPM1.
+ */
+uint64_t HostTpm_GetOverflowCount( uint32_t instance );
+
+/**
+ * @brief Gets the number of elements (bytes, halfwords or words) moved by a
+ *        DMA channel.
+ */
+uint64_t HostDma_GetElementCount( uint32_t channel );
+
+/*! @}*/
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* HOST_MODELS_H_ */
@@ -0,0 +1,24 @@
+/***************************************************************************************
+ * @file        host_putchar.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Host output of printf_() from Libraries/printf.
+ * @remarks     On the target the application implements _putchar, usually on UART0.
+ *              Here it goes to the standard output of the process. A program that
+ *              defines its own _putchar replaces this one.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <stdio.h>
+
+#include <Libraries/printf/printf.h>
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void _putchar( char character )
+{
+	putchar( character );
+}
@@ -0,0 +1,1253 @@
+/***************************************************************************************
+ * @file        host_sim.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Core of the KL05 register level simulator for the Linux host build.
+ * @remarks     Only x86-64 Linux is supported: the register accesses are decoded from
+ *              the faulting instruction and emulated from the SIGSEGV handler.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Maximum number of scheduled events. */
+#define HOSTSIM_MAX_EVENTS 64U
+
+/*!< Arithmetic flags of RFLAGS: CF, PF, AF, ZF, SF and OF. */
+#define HOSTSIM_FLAGS_MASK 0x8D5ULL
+
+/*!
+ * @brief A range of the KL05 address space reserved in the host process.
+ */
+typedef struct
+{
+	uint32_t base;
+	uint32_t size;
+	uint8_t *store; /*!< Register storage of the range. */
+} hostSimRegion_t;
+
+/*!
+ * @brief A scheduled event.
+ */
+typedef struct
+{
+	uint64_t time;
+	uint64_t sequence;
+	hostSimEventCallback_t callback;
+	void *context;
+} hostSimEvent_t;
+
+/*!
+ * @brief A decoded memory operand access.
+ */
+typedef struct
+{
+	uint32_t address;
+	uint32_t width;  /*!< Operand width in bytes: 1, 2, 4 or 8. */
+	bool rex;        /*!< A REX prefix is present, selects SPL..DIL instead of AH..BH. */
+} hostSimOperand_t;
+
+static uint8_t g_peripheralStore[0x100000];
+static uint8_t g_privateStore[0x10000];
+static uint8_t g_systemStore[0x4000];
+static uint8_t g_fgpioStore[0x1000];
+
+static hostSimRegion_t g_regions[] = {
+	{ 0x40000000UL, sizeof(g_peripheralStore), g_peripheralStore }, /* AIPS and GPIO */
+	{ 0xE0000000UL, sizeof(g_privateStore), g_privateStore },       /* Private peripheral bus */
+	{ 0xF0000000UL, sizeof(g_systemStore), g_systemStore },         /* MTB, MCM and ROM table */
+	{ 0xF80FF000UL, sizeof(g_fgpioStore), g_fgpioStore },           /* Fast GPIO */
+};
+
+/*!< Registers of the general purpose register numbers, in the ucontext order. */
+static const int _gregs[16] = {
+	REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+	REG_R8, REG_R9, REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15
+};
+
+hostSimNvic_t g_hostSimNvic;
+
+static bool g_initialized;
+static hostSimDevice_t *g_devices;
+static hostSimHandler_t g_handlers[HOSTSIM_EXCEPTION_COUNT];
+
+static uint64_t g_cycles, g_idleCycles, g_accesses, g_exceptions;
+static hostSimEvent_t g_events[HOSTSIM_MAX_EVENTS];
+static uint32_t g_eventCount;
+static uint64_t g_eventSequence;
+
+static uint64_t g_pollRip;
+static uint32_t g_pollAddress, g_pollValue, g_pollCount;
+
+/*!< The CMSIS handlers, if the firmware objects linked in the program define them. */
+extern void NMI_Handler( void ) __attribute__((weak));
+extern void SVC_Handler( void ) __attribute__((weak));
+extern void PendSV_Handler( void ) __attribute__((weak));
+extern void SysTick_Handler( void ) __attribute__((weak));
+extern void DMA0_IRQHandler( void ) __attribute__((weak));
+extern void DMA1_IRQHandler( void ) __attribute__((weak));
+extern void DMA2_IRQHandler( void ) __attribute__((weak));
+extern void DMA3_IRQHandler( void ) __attribute__((weak));
+extern void FTFA_IRQHandler( void ) __attribute__((weak));
+extern void LVD_LVW_IRQHandler( void ) __attribute__((weak));
+extern void LLWU_IRQHandler( void ) __attribute__((weak));
+extern void I2C0_IRQHandler( void ) __attribute__((weak));
+extern void SPI0_IRQHandler( void ) __attribute__((weak));
+extern void UART0_IRQHandler( void ) __attribute__((weak));
+extern void ADC0_IRQHandler( void ) __attribute__((weak));
+extern void CMP0_IRQHandler( void ) __attribute__((weak));
+extern void TPM0_IRQHandler( void ) __attribute__((weak));
+extern void TPM1_IRQHandler( void ) __attribute__((weak));
+extern void RTC_IRQHandler( void ) __attribute__((weak));
+extern void RTC_Seconds_IRQHandler( void ) __attribute__((weak));
+extern void PIT_IRQHandler( void ) __attribute__((weak));
+extern void DAC0_IRQHandler( void ) __attribute__((weak));
+extern void TSI0_IRQHandler( void ) __attribute__((weak));
+extern void MCG_IRQHandler( void ) __attribute__((weak));
+extern void LPTimer_IRQHandler( void ) __attribute__((weak));
+extern void PORTA_IRQHandler( void ) __attribute__((weak));
+extern void PORTB_IRQHandler( void ) __attribute__((weak));
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Loads the default vector table.
+ */
+static void HostSim_LoadVectors( void )
+{
+	memset( g_handlers, 0, sizeof(g_handlers) );
+	g_handlers[HOSTSIM_EXCEPTION_NMI] = NMI_Handler;
+	g_handlers[HOSTSIM_EXCEPTION_SVCALL] = SVC_Handler;
+	g_handlers[HOSTSIM_EXCEPTION_PENDSV] = PendSV_Handler;
+	g_handlers[HOSTSIM_EXCEPTION_SYSTICK] = SysTick_Handler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(DMA0_IRQn)] = DMA0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(DMA1_IRQn)] = DMA1_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(DMA2_IRQn)] = DMA2_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(DMA3_IRQn)] = DMA3_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(FTFA_IRQn)] = FTFA_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(LVD_LVW_IRQn)] = LVD_LVW_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(LLWU_IRQn)] = LLWU_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(I2C0_IRQn)] = I2C0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(SPI0_IRQn)] = SPI0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(UART0_IRQn)] = UART0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(ADC0_IRQn)] = ADC0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(CMP0_IRQn)] = CMP0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(TPM0_IRQn)] = TPM0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(TPM1_IRQn)] = TPM1_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(RTC_IRQn)] = RTC_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(RTC_Seconds_IRQn)] = RTC_Seconds_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(PIT_IRQn)] = PIT_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(DAC0_IRQn)] = DAC0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(TSI0_IRQn)] = TSI0_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(MCG_IRQn)] = MCG_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(LPTMR0_IRQn)] = LPTimer_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(PORTA_IRQn)] = PORTA_IRQHandler;
+	g_handlers[HOSTSIM_IRQ_EXCEPTION(PORTB_IRQn)] = PORTB_IRQHandler;
+}
+
+/**
+ * @brief Finds the region of an address.
+ * @return The region, or NULL if the address is not simulated.
+ */
+static hostSimRegion_t *HostSim_FindRegion( uint64_t address )
+{
+	for ( size_t i = 0; i < sizeof(g_regions) / sizeof(g_regions[0]); ++i )
+	{
+		if ( ( address >= g_regions[i].base ) && ( address - g_regions[i].base < g_regions[i].size ) )
+		{
+			return &g_regions[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Finds the device model of an address.
+ */
+static hostSimDevice_t *HostSim_DeviceAt( uint32_t address )
+{
+	for ( hostSimDevice_t *dev = g_devices; dev != NULL; dev = dev->next )
+	{
+		if ( ( address >= dev->base ) && ( address - dev->base < dev->size ) )
+		{
+			return dev;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Runs the events that are due at the current time.
+ */
+static void HostSim_RunDueEvents( void )
+{
+	while ( ( g_eventCount != 0U ) && ( g_events[0].time <= g_cycles ) )
+	{
+		const hostSimEvent_t event = g_events[0];
+
+		memmove( &g_events[0], &g_events[1], ( --g_eventCount ) * sizeof(g_events[0]) );
+		event.callback( event.context );
+	}
+}
+
+/**
+ * @brief Moves the time to the next event and runs it.
+ * @param idle - if the core sleeps meanwhile, instead of being busy.
+ * @return false if there is no event.
+ */
+static bool HostSim_RunNextEvent( bool idle )
+{
+	if ( g_eventCount == 0U )
+	{
+		return false;
+	}
+	if ( g_events[0].time > g_cycles )
+	{
+		if ( idle )
+		{
+			g_idleCycles += g_events[0].time - g_cycles;
+		}
+		g_cycles = g_events[0].time;
+	}
+	HostSim_RunDueEvents();
+	return true;
+}
+
+/**
+ * @brief Gets the execution priority: the one of the running exceptions,
+ *        or of the thread mode.
+ */
+static uint32_t HostSim_GetExecutionPriority( void )
+{
+	uint32_t priority = HOSTSIM_THREAD_PRIORITY;
+
+	for ( uint32_t i = 0; i < g_hostSimNvic.activeDepth; ++i )
+	{
+		const uint32_t exception = g_hostSimNvic.active[i];
+		const uint32_t p = ( exception == HOSTSIM_EXCEPTION_NMI ) ? 0U : g_hostSimNvic.priority[exception];
+
+		if ( p < priority )
+		{
+			priority = p;
+		}
+	}
+	return priority;
+}
+
+/**
+ * @brief Gets the most urgent pending and enabled exception.
+ * @param priority - receives its priority.
+ * @return The exception number, or 0 if there is none.
+ */
+static uint32_t HostSim_GetPendingException( uint32_t *priority )
+{
+	const uint32_t irqs = HostSim_GetIrqPending() & g_hostSimNvic.irqEnabled;
+	uint32_t best = 0U;
+	uint32_t bestPriority = HOSTSIM_THREAD_PRIORITY;
+
+	for ( uint32_t exception = 1U; exception < HOSTSIM_EXCEPTION_COUNT; ++exception )
+	{
+		const bool pending = ( exception < 16U ) ?
+				( ( g_hostSimNvic.systemPending >> exception ) & 1U ) :
+				( ( irqs >> ( exception - 16U ) ) & 1U );
+
+		/* On equal priorities the lowest exception number wins */
+		if ( pending && ( g_hostSimNvic.priority[exception] < bestPriority ) )
+		{
+			best = exception;
+			bestPriority = g_hostSimNvic.priority[exception];
+		}
+	}
+	*priority = ( best == HOSTSIM_EXCEPTION_NMI ) ? 0U : bestPriority;
+	return best;
+}
+
+/**
+ * @brief Takes an exception: runs its handler and returns from it.
+ */
+static void HostSim_TakeException( uint32_t exception )
+{
+	hostSimHandler_t handler = g_handlers[exception];
+
+	if ( exception < 16U )
+	{
+		g_hostSimNvic.systemPending &= ~( 1UL << exception );
+	}
+	else
+	{
+		g_hostSimNvic.irqPending &= ~( 1UL << ( exception - 16U ) );
+	}
+	if ( handler == NULL )
+	{
+		HostSim_Fatal( "exception %u taken without a handler (Default_Handler)", exception );
+	}
+	if ( g_hostSimNvic.activeDepth == HOSTSIM_EXCEPTION_COUNT )
+	{
+		HostSim_Fatal( "exception stack overflow" );
+	}
+
+	g_hostSimNvic.active[g_hostSimNvic.activeDepth++] = (uint8_t)exception;
+	g_cycles += HOSTSIM_EXCEPTION_ENTRY_CYCLES;
+	++g_exceptions;
+
+	handler();
+
+	HostSim_ExceptionReturn();
+}
+
+/**
+ * @brief Reports a register access the simulator does not handle.
+ */
+static void HostSim_Unsupported( const uint8_t *rip, uint32_t address )
+{
+	HostSim_Fatal( "unsupported instruction %02x %02x %02x %02x %02x %02x %02x %02x at %p accessing 0x%08x",
+			rip[0], rip[1], rip[2], rip[3], rip[4], rip[5], rip[6], rip[7], (const void*)rip, address );
+}
+
+/**
+ * @brief Stops the program on an access to a device with its clock gate disabled.
+ */
+static void HostSim_CheckGate( const hostSimDevice_t *dev, uint32_t address, const char *access )
+{
+	if ( ( dev != NULL ) && dev->gateMask && !( *dev->gateRegister & dev->gateMask ) )
+	{
+		HostSim_Fatal( "%s %s at 0x%08x with its clock gate disabled", dev->name, access, address );
+	}
+}
+
+/**
+ * @brief Reads a device register through its model.
+ */
+static uint32_t HostSim_ModelRead( hostSimDevice_t *dev, uint32_t address, uint32_t width )
+{
+	uint32_t value;
+
+	if ( ( dev == NULL ) || ( dev->Read == NULL ) )
+	{
+		return HostSim_RawRead( address, width );
+	}
+	/* The storage keeps the last value read, used by the polling detection */
+	value = dev->Read( dev, address - dev->base, width );
+	HostSim_RawWrite( address, value, width );
+	return value;
+}
+
+/**
+ * @brief Writes a device register through its model.
+ */
+static void HostSim_ModelWrite( hostSimDevice_t *dev, uint32_t address, uint32_t value, uint32_t width )
+{
+	if ( ( dev == NULL ) || ( dev->Write == NULL ) )
+	{
+		HostSim_RawWrite( address, value, width );
+	}
+	else
+	{
+		dev->Write( dev, address - dev->base, value, width );
+	}
+}
+
+/**
+ * @brief Performs a firmware read of a device register.
+ */
+static uint32_t HostSim_DeviceRead( uint32_t address, uint32_t width )
+{
+	hostSimDevice_t *dev = HostSim_DeviceAt( address );
+	uint32_t value;
+
+	HostSim_CheckGate( dev, address, "read" );
+	++g_accesses;
+	if ( dev != NULL )
+	{
+		++dev->reads;
+	}
+	value = HostSim_ModelRead( dev, address, width );
+	g_cycles += HOSTSIM_ACCESS_CYCLES;
+
+	return value;
+}
+
+/**
+ * @brief Performs a firmware write of a device register.
+ */
+static void HostSim_DeviceWrite( uint32_t address, uint32_t value, uint32_t width )
+{
+	hostSimDevice_t *dev = HostSim_DeviceAt( address );
+
+	HostSim_CheckGate( dev, address, "written" );
+	++g_accesses;
+	g_pollCount = 0U;
+	if ( dev != NULL )
+	{
+		++dev->writes;
+	}
+	HostSim_ModelWrite( dev, address, value, width );
+	g_cycles += HOSTSIM_ACCESS_CYCLES;
+}
+
+/**
+ * @brief Reads a memory operand, splitting 64-bit accesses.
+ */
+static uint64_t HostSim_ReadOperand( const hostSimOperand_t *op, uint64_t rip )
+{
+	if ( op->width == 8U )
+	{
+		const uint64_t low = HostSim_DeviceRead( op->address, 4U );
+
+		return low | ( (uint64_t)HostSim_DeviceRead( op->address + 4U, 4U ) << 32 );
+	}
+
+	/* A read of the same register by the same instruction, with nothing in between,
+	 * is a polling loop: the value can only change with the next event. */
+	if ( ( rip == g_pollRip ) && ( op->address == g_pollAddress ) &&
+		 ( HostSim_RawRead( op->address, op->width ) == g_pollValue ) && ( g_pollCount != 0U ) )
+	{
+		if ( !HostSim_RunNextEvent( false ) && ( ++g_pollCount > HOSTSIM_POLL_LIMIT ) )
+		{
+			HostSim_Fatal( "polling 0x%08x at %p forever: no event can change it",
+					op->address, (const void*)rip );
+		}
+		HostSim_DispatchInterrupts();
+	}
+
+	const uint32_t value = HostSim_DeviceRead( op->address, op->width );
+
+	if ( ( rip == g_pollRip ) && ( op->address == g_pollAddress ) && ( value == g_pollValue ) )
+	{
+		if ( g_pollCount == 0U )
+		{
+			g_pollCount = 1U;
+		}
+	}
+	else
+	{
+		g_pollRip = rip;
+		g_pollAddress = op->address;
+		g_pollCount = 0U;
+	}
+	g_pollValue = HostSim_RawRead( op->address, op->width );
+
+	return value;
+}
+
+/**
+ * @brief Writes a memory operand, splitting 64-bit accesses.
+ */
+static void HostSim_WriteOperand( const hostSimOperand_t *op, uint64_t value )
+{
+	if ( op->width == 8U )
+	{
+		HostSim_DeviceWrite( op->address, (uint32_t)value, 4U );
+		HostSim_DeviceWrite( op->address + 4U, (uint32_t)( value >> 32 ), 4U );
+	}
+	else
+	{
+		HostSim_DeviceWrite( op->address, (uint32_t)value, op->width );
+	}
+}
+
+/**
+ * @brief Mask of an operand width.
+ */
+static inline uint64_t HostSim_WidthMask( uint32_t width )
+{
+	return ( width == 8U ) ? ~0ULL : ( ( 1ULL << ( width * 8U ) ) - 1U );
+}
+
+/**
+ * @brief Sign extends a value of an operand width.
+ */
+static inline uint64_t HostSim_SignExtend( uint64_t value, uint32_t width )
+{
+	const uint32_t shift = 64U - width * 8U;
+
+	return (uint64_t)( (int64_t)( value << shift ) >> shift );
+}
+
+/**
+ * @brief Reads a general purpose register with an operand width.
+ */
+static uint64_t HostSim_GetRegister( const ucontext_t *uc, uint32_t reg, uint32_t width, bool rex )
+{
+	if ( ( width == 1U ) && !rex && ( reg >= 4U ) && ( reg < 8U ) )
+	{
+		/* AH, CH, DH and BH */
+		return ( (uint64_t)uc->uc_mcontext.gregs[_gregs[reg - 4U]] >> 8 ) & 0xFFU;
+	}
+	return (uint64_t)uc->uc_mcontext.gregs[_gregs[reg]] & HostSim_WidthMask( width );
+}
+
+/**
+ * @brief Writes a general purpose register with an operand width,
+ *        with the x86-64 rules for the upper bits.
+ */
+static void HostSim_SetRegister( ucontext_t *uc, uint32_t reg, uint32_t width, bool rex, uint64_t value )
+{
+	if ( ( width == 1U ) && !rex && ( reg >= 4U ) && ( reg < 8U ) )
+	{
+		greg_t *r = &uc->uc_mcontext.gregs[_gregs[reg - 4U]];
+
+		*r = (greg_t)( ( (uint64_t)*r & ~0xFF00ULL ) | ( ( value & 0xFFU ) << 8 ) );
+		return;
+	}
+
+	greg_t *r = &uc->uc_mcontext.gregs[_gregs[reg]];
+
+	switch ( width )
+	{
+	case 1U:
+		*r = (greg_t)( ( (uint64_t)*r & ~0xFFULL ) | ( value & 0xFFU ) );
+		break;
+	case 2U:
+		*r = (greg_t)( ( (uint64_t)*r & ~0xFFFFULL ) | ( value & 0xFFFFU ) );
+		break;
+	case 4U:
+		*r = (greg_t)( value & 0xFFFFFFFFULL ); /* 32-bit writes zero the upper half */
+		break;
+	default:
+		*r = (greg_t)value;
+		break;
+	}
+}
+
+/**
+ * @brief Computes an ALU operation and its arithmetic flags.
+ *
+ * @param op - 0 ADD, 1 OR, 2 ADC, 3 SBB, 4 AND, 5 SUB, 6 XOR, 7 CMP.
+ * @param flags - RFLAGS, updated.
+ * @return The result.
+ */
+static uint64_t HostSim_Alu( uint32_t op, uint64_t a, uint64_t b, uint32_t width, greg_t *flags )
+{
+	const uint64_t mask = HostSim_WidthMask( width );
+	const uint64_t sign = 1ULL << ( width * 8U - 1U );
+	const uint64_t carryIn = (uint64_t)*flags & 1U;
+	uint64_t result;
+	uint64_t newFlags = 0U;
+	bool carry = false, overflow = false;
+
+	a &= mask;
+	b &= mask;
+	switch ( op )
+	{
+	case 0U: /* ADD */
+	case 2U: /* ADC */
+		{
+			const uint64_t c = ( op == 2U ) ? carryIn : 0U;
+
+			result = ( a + b + c ) & mask;
+			carry = c ? ( result <= a ) : ( result < a );
+			overflow = ( ~( a ^ b ) & ( a ^ result ) & sign ) != 0U;
+		}
+		break;
+	case 3U: /* SBB */
+	case 5U: /* SUB */
+	case 7U: /* CMP */
+		{
+			const uint64_t c = ( op == 3U ) ? carryIn : 0U;
+
+			result = ( a - b - c ) & mask;
+			carry = c ? ( a <= b ) : ( a < b );
+			overflow = ( ( a ^ b ) & ( a ^ result ) & sign ) != 0U;
+		}
+		break;
+	case 1U:
+		result = a | b;
+		break;
+	case 4U:
+		result = a & b;
+		break;
+	default:
+		result = a ^ b;
+		break;
+	}
+
+	newFlags |= carry ? 0x1U : 0U;
+	newFlags |= __builtin_parity( (unsigned)( result & 0xFFU ) ) ? 0U : 0x4U;
+	newFlags |= ( ( a ^ b ^ result ) & 0x10U ) && ( op != 1U ) && ( op != 4U ) && ( op != 6U ) ? 0x10U : 0U;
+	newFlags |= ( result == 0U ) ? 0x40U : 0U;
+	newFlags |= ( result & sign ) ? 0x80U : 0U;
+	newFlags |= overflow ? 0x800U : 0U;
+	*flags = (greg_t)( ( (uint64_t)*flags & ~HOSTSIM_FLAGS_MASK ) | newFlags );
+
+	return result;
+}
+
+/**
+ * @brief Emulates the instruction that faulted on a simulated register and
+ *        moves the program counter after it.
+ */
+static void HostSim_Emulate( ucontext_t *uc, uint32_t address )
+{
+	const uint8_t *const start = (const uint8_t*)uc->uc_mcontext.gregs[REG_RIP];
+	const uint8_t *p = start;
+	greg_t *flags = &uc->uc_mcontext.gregs[REG_EFL];
+	bool opsize16 = false;
+	uint8_t rex = 0U;
+	uint32_t opcode;
+
+	while ( ( *p == 0x66U ) || ( *p == 0x3EU ) || ( *p == 0x2EU ) )
+	{
+		opsize16 |= ( *p++ == 0x66U );
+	}
+	if ( ( *p & 0xF0U ) == 0x40U )
+	{
+		rex = *p++;
+	}
+	opcode = *p++;
+	if ( opcode == 0x0FU )
+	{
+		opcode = 0x0F00U | *p++;
+	}
+
+	/* ModRM, SIB and displacement; the address itself comes from the fault. */
+	const uint8_t modrm = *p++;
+	const uint32_t mod = modrm >> 6;
+	const uint32_t reg = ( ( modrm >> 3 ) & 7U ) | ( ( rex & 0x4U ) ? 8U : 0U );
+	const uint32_t group = ( modrm >> 3 ) & 7U;
+
+	if ( mod == 3U )
+	{
+		HostSim_Unsupported( start, address );
+	}
+	if ( ( modrm & 7U ) == 4U )
+	{
+		const uint8_t sib = *p++;
+
+		if ( ( mod == 0U ) && ( ( sib & 7U ) == 5U ) )
+		{
+			p += 4;
+		}
+	}
+	else if ( ( mod == 0U ) && ( ( modrm & 7U ) == 5U ) )
+	{
+		p += 4;
+	}
+	p += ( mod == 1U ) ? 1 : ( mod == 2U ) ? 4 : 0;
+
+	hostSimOperand_t op = { .address = address, .rex = ( rex != 0U ) };
+	const uint32_t fullWidth = ( rex & 0x8U ) ? 8U : opsize16 ? 2U : 4U;
+	uint64_t value;
+
+	switch ( opcode )
+	{
+	case 0x88U: /* MOV r/m8, r8 */
+	case 0x89U: /* MOV r/m, r */
+		op.width = ( opcode == 0x88U ) ? 1U : fullWidth;
+		HostSim_WriteOperand( &op, HostSim_GetRegister( uc, reg, op.width, op.rex ) );
+		break;
+
+	case 0x8AU: /* MOV r8, r/m8 */
+	case 0x8BU: /* MOV r, r/m */
+		op.width = ( opcode == 0x8AU ) ? 1U : fullWidth;
+		HostSim_SetRegister( uc, reg, op.width, op.rex, HostSim_ReadOperand( &op, (uint64_t)start ) );
+		break;
+
+	case 0xC6U: /* MOV r/m8, imm8 */
+	case 0xC7U: /* MOV r/m, imm16/32 */
+		if ( group != 0U )
+		{
+			HostSim_Unsupported( start, address );
+		}
+		op.width = ( opcode == 0xC6U ) ? 1U : fullWidth;
+		if ( op.width == 1U )
+		{
+			value = *p++;
+		}
+		else if ( op.width == 2U )
+		{
+			value = (uint64_t)p[0] | ( (uint64_t)p[1] << 8 );
+			p += 2;
+		}
+		else
+		{
+			int32_t imm;
+
+			memcpy( &imm, p, sizeof(imm) );
+			value = (uint64_t)(int64_t)imm;
+			p += 4;
+		}
+		HostSim_WriteOperand( &op, value );
+		break;
+
+	case 0x0FB6U: /* MOVZX r, r/m8 */
+	case 0x0FB7U: /* MOVZX r, r/m16 */
+	case 0x0FBEU: /* MOVSX r, r/m8 */
+	case 0x0FBFU: /* MOVSX r, r/m16 */
+		op.width = ( opcode & 1U ) ? 2U : 1U;
+		value = HostSim_ReadOperand( &op, (uint64_t)start );
+		if ( opcode >= 0x0FBEU )
+		{
+			value = HostSim_SignExtend( value, op.width );
+		}
+		HostSim_SetRegister( uc, reg, fullWidth, op.rex, value );
+		break;
+
+	case 0x63U: /* MOVSXD r, r/m32 */
+		op.width = 4U;
+		value = HostSim_SignExtend( HostSim_ReadOperand( &op, (uint64_t)start ), 4U );
+		HostSim_SetRegister( uc, reg, fullWidth, op.rex, value );
+		break;
+
+	case 0x84U: /* TEST r/m8, r8 */
+	case 0x85U: /* TEST r/m, r */
+		op.width = ( opcode == 0x84U ) ? 1U : fullWidth;
+		value = HostSim_ReadOperand( &op, (uint64_t)start );
+		(void)HostSim_Alu( 4U, value, HostSim_GetRegister( uc, reg, op.width, op.rex ), op.width, flags );
+		break;
+
+	case 0x80U: /* ALU r/m8, imm8 */
+	case 0x81U: /* ALU r/m, imm16/32 */
+	case 0x83U: /* ALU r/m, imm8 sign extended */
+		{
+			uint64_t imm;
+
+			op.width = ( opcode == 0x80U ) ? 1U : fullWidth;
+			if ( ( opcode == 0x81U ) && ( op.width == 2U ) )
+			{
+				imm = (uint64_t)p[0] | ( (uint64_t)p[1] << 8 );
+				p += 2;
+			}
+			else if ( opcode == 0x81U )
+			{
+				int32_t imm32;
+
+				memcpy( &imm32, p, sizeof(imm32) );
+				imm = (uint64_t)(int64_t)imm32;
+				p += 4;
+			}
+			else
+			{
+				imm = (uint64_t)(int64_t)(int8_t)*p++;
+			}
+			value = HostSim_Alu( group, HostSim_ReadOperand( &op, (uint64_t)start ), imm, op.width, flags );
+			if ( group != 7U )
+			{
+				HostSim_WriteOperand( &op, value );
+			}
+		}
+		break;
+
+	case 0xF6U: /* TEST r/m8, imm8 */
+	case 0xF7U: /* TEST r/m, imm16/32 */
+		{
+			uint64_t imm;
+
+			if ( group != 0U )
+			{
+				HostSim_Unsupported( start, address );
+			}
+			op.width = ( opcode == 0xF6U ) ? 1U : fullWidth;
+			if ( op.width == 1U )
+			{
+				imm = *p++;
+			}
+			else if ( op.width == 2U )
+			{
+				imm = (uint64_t)p[0] | ( (uint64_t)p[1] << 8 );
+				p += 2;
+			}
+			else
+			{
+				int32_t imm32;
+
+				memcpy( &imm32, p, sizeof(imm32) );
+				imm = (uint64_t)(int64_t)imm32;
+				p += 4;
+			}
+			(void)HostSim_Alu( 4U, HostSim_ReadOperand( &op, (uint64_t)start ), imm, op.width, flags );
+		}
+		break;
+
+	case 0xFEU: /* INC/DEC r/m8 */
+	case 0xFFU: /* INC/DEC r/m */
+		{
+			const greg_t carry = *flags & 1;
+
+			if ( group > 1U )
+			{
+				HostSim_Unsupported( start, address );
+			}
+			op.width = ( opcode == 0xFEU ) ? 1U : fullWidth;
+			value = HostSim_Alu( ( group == 0U ) ? 0U : 5U, HostSim_ReadOperand( &op, (uint64_t)start ),
+					1U, op.width, flags );
+			*flags = ( *flags & ~(greg_t)1 ) | carry; /* INC and DEC keep CF */
+			HostSim_WriteOperand( &op, value );
+		}
+		break;
+
+	default:
+		if ( ( opcode < 0x40U ) && ( ( opcode & 7U ) < 4U ) )
+		{
+			/* ADD, OR, ADC, SBB, AND, SUB, XOR and CMP between a register and memory */
+			const uint32_t alu = opcode >> 3;
+			const bool toRegister = ( opcode & 2U ) != 0U;
+
+			op.width = ( opcode & 1U ) ? fullWidth : 1U;
+			const uint64_t mem = HostSim_ReadOperand( &op, (uint64_t)start );
+			const uint64_t r = HostSim_GetRegister( uc, reg, op.width, op.rex );
+
+			value = toRegister ? HostSim_Alu( alu, r, mem, op.width, flags ) :
+					HostSim_Alu( alu, mem, r, op.width, flags );
+			if ( alu != 7U )
+			{
+				if ( toRegister )
+				{
+					HostSim_SetRegister( uc, reg, op.width, op.rex, value );
+				}
+				else
+				{
+					HostSim_WriteOperand( &op, value );
+				}
+			}
+			break;
+		}
+		HostSim_Unsupported( start, address );
+	}
+
+	uc->uc_mcontext.gregs[REG_RIP] = (greg_t)p;
+}
+
+/**
+ * @brief SIGSEGV handler: emulates the accesses to the simulated registers.
+ */
+static void HostSim_FaultHandler( int signal, siginfo_t *info, void *context )
+{
+	const uint64_t address = (uint64_t)(uintptr_t)info->si_addr;
+	const int savedErrno = errno;
+
+	(void)signal;
+	if ( HostSim_FindRegion( address ) == NULL )
+	{
+		/* A real crash: let it happen again with the default action */
+		struct sigaction action = { .sa_handler = SIG_DFL };
+
+		sigaction( SIGSEGV, &action, NULL );
+		return;
+	}
+
+	/* The events due before the access happen first */
+	HostSim_RunDueEvents();
+	HostSim_DispatchInterrupts();
+
+	HostSim_Emulate( (ucontext_t*)context, (uint32_t)address );
+
+	HostSim_RunDueEvents();
+	HostSim_DispatchInterrupts();
+	errno = savedErrno;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostSim_Init( void )
+{
+	if ( !g_initialized )
+	{
+		struct sigaction action;
+
+		for ( size_t i = 0; i < sizeof(g_regions) / sizeof(g_regions[0]); ++i )
+		{
+			void *map = mmap( (void*)(uintptr_t)g_regions[i].base, g_regions[i].size, PROT_NONE,
+					MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0 );
+
+			if ( map != (void*)(uintptr_t)g_regions[i].base )
+			{
+				HostSim_Fatal( "can not reserve the addresses 0x%08x..0x%08x: %s", g_regions[i].base,
+						g_regions[i].base + g_regions[i].size - 1U, strerror( errno ) );
+			}
+		}
+
+		memset( &action, 0, sizeof(action) );
+		action.sa_sigaction = HostSim_FaultHandler;
+		action.sa_flags = SA_SIGINFO | SA_NODEFER;
+		sigemptyset( &action.sa_mask );
+		sigaction( SIGSEGV, &action, NULL );
+
+		HostScs_Register();
+		HostSimModule_Register();
+		HostPort_Register();
+		HostGpio_Register();
+		HostUart0_Register();
+		HostI2c_Register();
+		HostAdc_Register();
+		HostTpm_Register();
+		HostDma_Register();
+		g_initialized = true;
+	}
+	HostSim_Reset();
+}
+
+/**********************************************************************************/
+void HostSim_Reset( void )
+{
+	g_cycles = g_idleCycles = g_accesses = g_exceptions = 0U;
+	g_eventCount = 0U;
+	g_pollCount = 0U;
+	g_pollRip = 0U;
+	memset( &g_hostSimNvic, 0, sizeof(g_hostSimNvic) );
+	HostSim_LoadVectors();
+
+	for ( size_t i = 0; i < sizeof(g_regions) / sizeof(g_regions[0]); ++i )
+	{
+		memset( g_regions[i].store, 0, g_regions[i].size );
+	}
+	/* The SIM model goes first: the other models read its clock gates */
+	for ( hostSimDevice_t *dev = g_devices; dev != NULL; dev = dev->next )
+	{
+		dev->reads = dev->writes = 0U;
+		if ( dev->Reset != NULL )
+		{
+			dev->Reset( dev );
+		}
+	}
+}
+
+/**********************************************************************************/
+void HostSim_AddDevice( hostSimDevice_t *dev )
+{
+	hostSimDevice_t **last = &g_devices;
+
+	if ( ( HostSim_FindRegion( dev->base ) == NULL ) ||
+		 ( HostSim_FindRegion( dev->base ) != HostSim_FindRegion( dev->base + dev->size - 1U ) ) )
+	{
+		HostSim_Fatal( "%s is outside the simulated address space", dev->name );
+	}
+	while ( *last != NULL )
+	{
+		last = &( *last )->next;
+	}
+	dev->next = NULL;
+	*last = dev;
+}
+
+/**********************************************************************************/
+hostSimDevice_t *HostSim_FindDevice( uint32_t base )
+{
+	for ( hostSimDevice_t *dev = g_devices; dev != NULL; dev = dev->next )
+	{
+		if ( dev->base == base )
+		{
+			return dev;
+		}
+	}
+	return NULL;
+}
+
+/**********************************************************************************/
+void *HostSim_Store( uint32_t address )
+{
+	hostSimRegion_t *region = HostSim_FindRegion( address );
+
+	if ( region == NULL )
+	{
+		HostSim_Fatal( "0x%08x is not a simulated address", address );
+	}
+	return &region->store[address - region->base];
+}
+
+/**********************************************************************************/
+uint32_t HostSim_RawRead( uint32_t address, uint32_t width )
+{
+	uint32_t value = 0U;
+
+	memcpy( &value, HostSim_Store( address ), width );
+	return value;
+}
+
+/**********************************************************************************/
+void HostSim_RawWrite( uint32_t address, uint32_t value, uint32_t width )
+{
+	memcpy( HostSim_Store( address ), &value, width );
+}
+
+/**********************************************************************************/
+uint32_t HostSim_BusRead( uint32_t address, uint32_t width )
+{
+	hostSimDevice_t *dev;
+	uint32_t value = 0U;
+
+	if ( HostSim_FindRegion( address ) == NULL )
+	{
+		memcpy( &value, (const void*)(uintptr_t)address, width );
+		return value;
+	}
+	dev = HostSim_DeviceAt( address );
+	HostSim_CheckGate( dev, address, "read by a bus master" );
+	return HostSim_ModelRead( dev, address, width );
+}
+
+/**********************************************************************************/
+void HostSim_BusWrite( uint32_t address, uint32_t value, uint32_t width )
+{
+	hostSimDevice_t *dev;
+
+	if ( HostSim_FindRegion( address ) == NULL )
+	{
+		memcpy( (void*)(uintptr_t)address, &value, width );
+		return;
+	}
+	dev = HostSim_DeviceAt( address );
+	HostSim_CheckGate( dev, address, "written by a bus master" );
+	HostSim_ModelWrite( dev, address, value, width );
+}
+
+/**********************************************************************************/
+uint64_t HostSim_GetCycles( void )
+{
+	return g_cycles;
+}
+
+/**********************************************************************************/
+uint64_t HostSim_GetIdleCycles( void )
+{
+	return g_idleCycles;
+}
+
+/**********************************************************************************/
+uint64_t HostSim_GetAccessCount( void )
+{
+	return g_accesses;
+}
+
+/**********************************************************************************/
+uint64_t HostSim_GetExceptionCount( void )
+{
+	return g_exceptions;
+}
+
+/**********************************************************************************/
+double HostSim_GetSeconds( void )
+{
+	return (double)g_cycles / (double)SystemCoreClock;
+}
+
+/**********************************************************************************/
+uint64_t HostSim_UsToCycles( double us )
+{
+	return (uint64_t)( us * (double)SystemCoreClock / 1e6 + 0.5 );
+}
+
+/**********************************************************************************/
+void HostSim_Advance( uint64_t cycles )
+{
+	const uint64_t end = g_cycles + cycles;
+
+	HostSim_RunDueEvents();
+	HostSim_DispatchInterrupts();
+	while ( ( g_eventCount != 0U ) && ( g_events[0].time <= end ) )
+	{
+		HostSim_RunNextEvent( false );
+		HostSim_DispatchInterrupts();
+	}
+	if ( g_cycles < end )
+	{
+		g_cycles = end;
+	}
+}
+
+/**********************************************************************************/
+void HostSim_Nop( void )
+{
+	HostSim_Advance( 1U );
+}
+
+/**********************************************************************************/
+void HostSim_WaitForInterrupt( void )
+{
+	uint32_t priority;
+
+	HostSim_RunDueEvents();
+	/* WFI wakes up on a pending interrupt that would preempt, even with PRIMASK set */
+	while ( ( HostSim_GetPendingException( &priority ) == 0U ) ||
+			( priority >= HostSim_GetExecutionPriority() ) )
+	{
+		if ( !HostSim_RunNextEvent( true ) )
+		{
+			HostSim_Fatal( "WFI with no event left to wake the core up" );
+		}
+	}
+	g_cycles += 2U;
+	HostSim_DispatchInterrupts();
+}
+
+/**********************************************************************************/
+void HostSim_Schedule( uint64_t delay, hostSimEventCallback_t callback, void *context )
+{
+	const hostSimEvent_t event = {
+		.time = g_cycles + delay, .sequence = g_eventSequence++, .callback = callback, .context = context
+	};
+	uint32_t i = g_eventCount;
+
+	if ( g_eventCount == HOSTSIM_MAX_EVENTS )
+	{
+		HostSim_Fatal( "too many scheduled events" );
+	}
+	while ( ( i > 0U ) && ( g_events[i - 1U].time > event.time ) )
+	{
+		g_events[i] = g_events[i - 1U];
+		--i;
+	}
+	g_events[i] = event;
+	++g_eventCount;
+}
+
+/**********************************************************************************/
+void HostSim_Cancel( hostSimEventCallback_t callback, void *context )
+{
+	uint32_t n = 0U;
+
+	for ( uint32_t i = 0; i < g_eventCount; ++i )
+	{
+		if ( ( g_events[i].callback != callback ) || ( g_events[i].context != context ) )
+		{
+			g_events[n++] = g_events[i];
+		}
+	}
+	g_eventCount = n;
+}
+
+/**********************************************************************************/
+bool HostSim_IsScheduled( hostSimEventCallback_t callback, void *context )
+{
+	for ( uint32_t i = 0; i < g_eventCount; ++i )
+	{
+		if ( ( g_events[i].callback == callback ) && ( g_events[i].context == context ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**********************************************************************************/
+void HostSim_SetIrqLine( IRQn_Type irq, bool asserted )
+{
+	const uint32_t bit = 1UL << (uint32_t)irq;
+
+	if ( asserted && !( g_hostSimNvic.irqLines & bit ) )
+	{
+		g_hostSimNvic.irqLines |= bit;
+		/* The NVIC latches the pending state on the request */
+		if ( HostSim_GetIrqPending() & bit )
+		{
+			g_hostSimNvic.irqPending |= bit;
+		}
+	}
+	else if ( !asserted )
+	{
+		g_hostSimNvic.irqLines &= ~bit;
+	}
+}
+
+/**********************************************************************************/
+void HostSim_PendException( uint32_t exception )
+{
+	if ( exception < 16U )
+	{
+		g_hostSimNvic.systemPending |= 1UL << exception;
+	}
+	else
+	{
+		g_hostSimNvic.irqPending |= 1UL << ( exception - 16U );
+	}
+}
+
+/**********************************************************************************/
+void HostSim_SetHandler( uint32_t exception, hostSimHandler_t handler )
+{
+	g_handlers[exception] = handler;
+}
+
+/**********************************************************************************/
+void HostSim_DispatchInterrupts( void )
+{
+	uint32_t priority;
+	uint32_t exception;
+
+	while ( !g_hostSimNvic.primask &&
+			( ( exception = HostSim_GetPendingException( &priority ) ) != 0U ) &&
+			( priority < HostSim_GetExecutionPriority() ) )
+	{
+		HostSim_TakeException( exception );
+	}
+}
+
+/**********************************************************************************/
+void HostSim_ExceptionReturn( void )
+{
+	uint32_t exception;
+
+	if ( g_hostSimNvic.activeDepth == 0U )
+	{
+		HostSim_Fatal( "exception return in thread mode" );
+	}
+	exception = g_hostSimNvic.active[--g_hostSimNvic.activeDepth];
+	g_cycles += HOSTSIM_EXCEPTION_EXIT_CYCLES;
+
+	/* A request line still asserted pends the interrupt again */
+	if ( ( exception >= 16U ) && ( g_hostSimNvic.irqLines & ( 1UL << ( exception - 16U ) ) ) )
+	{
+		g_hostSimNvic.irqPending |= 1UL << ( exception - 16U );
+	}
+}
+
+/**********************************************************************************/
+uint32_t HostSim_GetPrimask( void )
+{
+	return g_hostSimNvic.primask;
+}
+
+/**********************************************************************************/
+void HostSim_SetPrimask( uint32_t primask )
+{
+	g_hostSimNvic.primask = primask & 1U;
+	if ( !g_hostSimNvic.primask )
+	{
+		HostSim_DispatchInterrupts();
+	}
+}
+
+/**********************************************************************************/
+uint32_t HostSim_GetIpsr( void )
+{
+	return ( g_hostSimNvic.activeDepth != 0U ) ? g_hostSimNvic.active[g_hostSimNvic.activeDepth - 1U] : 0U;
+}
+
+/**********************************************************************************/
+void HostSim_Fatal( const char *format, ... )
+{
+	va_list args;
+
+	fflush( stdout );
+	fprintf( stderr, "host simulator: " );
+	va_start( args, format );
+	vfprintf( stderr, format, args );
+	va_end( args );
+	fprintf( stderr, " (cycle %llu)\n", (unsigned long long)g_cycles );
+	abort();
+}
+
+/*! @}*/
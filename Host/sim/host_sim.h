@@ -0,0 +1,252 @@
+/***************************************************************************************
+ * @file        host_sim.h
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Register level simulator of the KL05 peripherals for the Linux host build.
+ * @remarks     The peripheral address ranges of MKL05Z4.h are reserved in the host
+ *              process without access rights, so every register access of the
+ *              unmodified drivers faults. The fault handler decodes the x86-64
+ *              load/store, runs it against the device models and resumes after it.
+ *              The time is a simulated core cycle counter: register accesses,
+ *              exception entries, delays and peripheral events advance it. The code
+ *              between register accesses costs nothing, so the cycle counts are a
+ *              bus level model of the target, not an instruction level one.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef HOST_SIM_H_
+#define HOST_SIM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <MKL05Z4.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Core cycles charged for each peripheral register access. An AIPS access takes
+ *   2 or 3 cycles on the Cortex-M0+, the rest accounts for the address and mask
+ *   instructions around it. */
+#define HOSTSIM_ACCESS_CYCLES 4U
+/*!< Core cycles charged for an exception entry (stacking and vector fetch). */
+#define HOSTSIM_EXCEPTION_ENTRY_CYCLES 15U
+/*!< Core cycles charged for an exception return (unstacking). */
+#define HOSTSIM_EXCEPTION_EXIT_CYCLES 15U
+/*!< Consecutive reads of an unchanged register, with no event left to change it,
+ *   after which the simulator reports a dead polling loop and aborts. */
+#define HOSTSIM_POLL_LIMIT 1000000U
+/*!< The number of exceptions: 16 system exceptions and 32 interrupts. */
+#define HOSTSIM_EXCEPTION_COUNT 48U
+/*!< Exception number of an interrupt request line. */
+#define HOSTSIM_IRQ_EXCEPTION(irq) ( 16U + (uint32_t)(irq) )
+
+typedef struct hostSimDevice_s hostSimDevice_t;
+
+/*!
+ * @brief A device model mapped in the peripheral address space.
+ *
+ * The registers are stored in a RAM block that mirrors the device address range.
+ * With NULL callbacks the device behaves as plain memory. The models read and
+ * write their own registers with HostSim_RawRead/HostSim_RawWrite, which are not
+ * trapped and cost no time.
+ */
+struct hostSimDevice_s
+{
+	const char *name;  /*!< Name printed in the diagnostics. */
+	uint32_t base;     /*!< Base address of the register block. */
+	uint32_t size;     /*!< Size of the register block in bytes. */
+	uint32_t gateMask; /*!< Clock gate bit in gateRegister, or 0 if always clocked. */
+	volatile uint32_t *gateRegister; /*!< SIM_SCGCx register of the clock gate. */
+	/*! Called on a firmware read, returns the value read. */
+	uint32_t (*Read)( hostSimDevice_t *dev, uint32_t offset, uint32_t width );
+	/*! Called on a firmware write, must store the value if it is kept. */
+	void (*Write)( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width );
+	/*! Called by HostSim_Reset, after the registers were cleared. */
+	void (*Reset)( hostSimDevice_t *dev );
+	void *context;     /*!< Model specific data. */
+	uint64_t reads;    /*!< Firmware reads of the device registers. */
+	uint64_t writes;   /*!< Firmware writes of the device registers. */
+	hostSimDevice_t *next;
+};
+
+/*! @brief Callback of a scheduled event. */
+typedef void (*hostSimEventCallback_t)( void *context );
+
+/*! @brief A handler of the vector table. */
+typedef void (*hostSimHandler_t)( void );
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Maps the peripheral address space and registers the device models.
+ *        Calling it again only resets the simulator.
+ * @note Call it before the first register access, usually first thing in main.
+ */
+void HostSim_Init( void );
+
+/**
+ * @brief Resets the time, the events, the exception state, the handlers and every
+ *        device model to their reset values. The statistics are also cleared.
+ */
+void HostSim_Reset( void );
+
+/**
+ * @brief Adds a device model. The range must be inside one of the mapped regions.
+ */
+void HostSim_AddDevice( hostSimDevice_t *dev );
+
+/**
+ * @brief Finds the device model registered at a base address.
+ * @return The device, or NULL.
+ */
+hostSimDevice_t *HostSim_FindDevice( uint32_t base );
+
+/**
+ * @brief Reads the stored value of a register, without side effects or time.
+ * @param width - the access width in bytes: 1, 2 or 4.
+ */
+uint32_t HostSim_RawRead( uint32_t address, uint32_t width );
+
+/**
+ * @brief Stores the value of a register, without side effects or time.
+ * @param width - the access width in bytes: 1, 2 or 4.
+ */
+void HostSim_RawWrite( uint32_t address, uint32_t value, uint32_t width );
+
+/**
+ * @brief Gets the simulated core cycles since the last reset.
+ */
+uint64_t HostSim_GetCycles( void );
+
+/**
+ * @brief Gets the cycles the core spent sleeping in WFI since the last reset.
+ */
+uint64_t HostSim_GetIdleCycles( void );
+
+/**
+ * @brief Gets the number of trapped register accesses since the last reset.
+ */
+uint64_t HostSim_GetAccessCount( void );
+
+/**
+ * @brief Gets the number of exceptions taken since the last reset.
+ */
+uint64_t HostSim_GetExceptionCount( void );
+
+/**
+ * @brief Gets the simulated time since the last reset in seconds.
+ */
+double HostSim_GetSeconds( void );
+
+/**
+ * @brief Converts a time in microseconds to core cycles.
+ */
+uint64_t HostSim_UsToCycles( double us );
+
+/**
+ * @brief Keeps the core busy for a number of cycles, running the events and
+ *        interrupts that happen meanwhile.
+ */
+void HostSim_Advance( uint64_t cycles );
+
+/**
+ * @brief A NOP instruction, one busy cycle.
+ */
+void HostSim_Nop( void );
+
+/**
+ * @brief The WFI instruction: sleeps until an interrupt is pending, then takes it
+ *        if PRIMASK and the current priority allow it.
+ */
+void HostSim_WaitForInterrupt( void );
+
+/**
+ * @brief Sleeps until a condition, updated by interrupts, is true. The firmware
+ *        idle loops do it with WFI, this is the same loop for the host tests.
+ */
+#define HostSim_WaitUntil( condition ) \
+	do { while ( !( condition ) ) { HostSim_WaitForInterrupt(); } } while ( 0 )
+
+/**
+ * @brief Schedules an event after a number of cycles. Events with the same time
+ *        run in the scheduling order.
+ */
+void HostSim_Schedule( uint64_t delay, hostSimEventCallback_t callback, void *context );
+
+/**
+ * @brief Cancels the scheduled events with this callback and context.
+ */
+void HostSim_Cancel( hostSimEventCallback_t callback, void *context );
+
+/**
+ * @brief Checks if there is an event with this callback and context.
+ */
+bool HostSim_IsScheduled( hostSimEventCallback_t callback, void *context );
+
+/**
+ * @brief Sets the level of a peripheral interrupt request line.
+ *        The line pends the interrupt while it is asserted.
+ */
+void HostSim_SetIrqLine( IRQn_Type irq, bool asserted );
+
+/**
+ * @brief Pends an exception, as the ICSR and ISPR registers do.
+ * @param exception - the exception number (HOSTSIM_IRQ_EXCEPTION for interrupts).
+ */
+void HostSim_PendException( uint32_t exception );
+
+/**
+ * @brief Replaces the handler of an exception. By default the handlers are the
+ *        CMSIS names (SysTick_Handler, UART0_IRQHandler, ...) defined by the
+ *        firmware objects linked in the program, restored by HostSim_Reset.
+ */
+void HostSim_SetHandler( uint32_t exception, hostSimHandler_t handler );
+
+/**
+ * @brief Takes the pending interrupts allowed by PRIMASK and the priorities.
+ */
+void HostSim_DispatchInterrupts( void );
+
+/**
+ * @brief Returns from the running exception without going back to the code that
+ *        was interrupted. Used by the RTOS port when a task starts from PendSV.
+ */
+void HostSim_ExceptionReturn( void );
+
+/**
+ * @brief PRIMASK access, used by the CMSIS intrinsics.
+ */
+uint32_t HostSim_GetPrimask( void );
+void HostSim_SetPrimask( uint32_t primask );
+
+/**
+ * @brief IPSR: the number of the running exception, 0 in thread mode.
+ */
+uint32_t HostSim_GetIpsr( void );
+
+/**
+ * @brief Prints a diagnostic and aborts the program.
+ */
+void HostSim_Fatal( const char *format, ... ) __attribute__((noreturn, format(printf, 1, 2)));
+
+/*! @}*/
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* HOST_SIM_H_ */
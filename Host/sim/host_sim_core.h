@@ -0,0 +1,114 @@
+/***************************************************************************************
+ * @file        host_sim_core.h
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Private interface between the simulator core and the device models.
+ * @remarks     Not to be included by the firmware or by the tests.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef HOST_SIM_CORE_H_
+#define HOST_SIM_CORE_H_
+
+#include "host_sim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Exception numbers of the system exceptions. */
+#define HOSTSIM_EXCEPTION_NMI     2U
+#define HOSTSIM_EXCEPTION_SVCALL  11U
+#define HOSTSIM_EXCEPTION_PENDSV  14U
+#define HOSTSIM_EXCEPTION_SYSTICK 15U
+
+/*!< Execution priority of the thread mode, lower than any exception. */
+#define HOSTSIM_THREAD_PRIORITY 256U
+
+/*!
+ * @brief Exception state of the core, shared by the dispatcher and the SCS model.
+ */
+typedef struct
+{
+	uint32_t irqEnabled;    /*!< NVIC_ISER: enabled interrupt lines. */
+	uint32_t irqPending;    /*!< NVIC_ISPR: latched pending interrupts. */
+	uint32_t irqLines;      /*!< Asserted peripheral request lines. */
+	uint32_t systemPending; /*!< Pending system exceptions, bit n for exception n. */
+	uint8_t priority[HOSTSIM_EXCEPTION_COUNT]; /*!< Programmed priorities. */
+	uint8_t active[HOSTSIM_EXCEPTION_COUNT];   /*!< Stack of the running exceptions. */
+	uint32_t activeDepth;   /*!< Number of nested exceptions. */
+	uint32_t primask;       /*!< PRIMASK bit. */
+} hostSimNvic_t;
+
+extern hostSimNvic_t g_hostSimNvic;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Pointer to the register storage of an address, for the models.
+ */
+void *HostSim_Store( uint32_t address );
+
+/**
+ * @brief Access of a bus master other than the core (the DMA). The simulated
+ *        addresses go through the device models without taking core time, the
+ *        others are host memory: 32-bit addresses of the program data.
+ */
+uint32_t HostSim_BusRead( uint32_t address, uint32_t width );
+void HostSim_BusWrite( uint32_t address, uint32_t value, uint32_t width );
+
+/**
+ * @brief Sets the state of a DMA request source of the DMAMUX.
+ * @param source - the DMAMUX source number, as the CHCFG[SOURCE] field.
+ */
+void HostDma_SetRequest( uint32_t source, bool asserted );
+
+/**
+ * @brief Registration functions of the models, called by HostSim_Init.
+ */
+void HostScs_Register( void );
+void HostSimModule_Register( void );
+void HostPort_Register( void );
+void HostGpio_Register( void );
+void HostUart0_Register( void );
+void HostI2c_Register( void );
+void HostAdc_Register( void );
+void HostTpm_Register( void );
+void HostDma_Register( void );
+
+/**
+ * @brief Clock gate register SIM_SCGCn, n from 4 to 7.
+ */
+volatile uint32_t *HostSimModule_GetGate( uint32_t index );
+
+/**
+ * @brief Bus clock in [Hz]: the core clock divided by SIM_CLKDIV1[OUTDIV4].
+ */
+uint32_t HostSimModule_GetBusClock( void );
+
+/**
+ * @brief Clock of the UART0/TPM selection fields of SIM_SOPT2 in [Hz].
+ * @param select - the UART0SRC or TPMSRC field value.
+ */
+uint32_t HostSimModule_GetAsyncClock( uint32_t select );
+
+/**
+ * @brief Gets the effective pending state of an interrupt, latched or by its line.
+ */
+static inline uint32_t HostSim_GetIrqPending( void )
+{
+	uint32_t activeIrqs = 0U;
+
+	for ( uint32_t i = 0; i < g_hostSimNvic.activeDepth; ++i )
+	{
+		if ( g_hostSimNvic.active[i] >= 16U )
+		{
+			activeIrqs |= 1UL << ( g_hostSimNvic.active[i] - 16U );
+		}
+	}
+	return g_hostSimNvic.irqPending | ( g_hostSimNvic.irqLines & ~activeIrqs );
+}
+
+#endif /* HOST_SIM_CORE_H_ */
@@ -0,0 +1,301 @@
+/***************************************************************************************
+ * @file        model_adc.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the ADC0 software triggered conversions and calibration.
+ * @remarks     A conversion takes 5 bus clocks plus 3 ADCK plus, for each averaged
+ *              sample, 20 ADCK and the long sample extension. The hardware trigger,
+ *              the compare function and the channel B are not modeled.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+#include "host_models.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Register offsets. */
+#define HOSTADC_SC1A 0x00U
+#define HOSTADC_CFG1 0x08U
+#define HOSTADC_CFG2 0x0CU
+#define HOSTADC_RA   0x10U
+#define HOSTADC_SC2  0x20U
+#define HOSTADC_SC3  0x24U
+
+/*!< DMAMUX source of the conversion complete request. */
+#define HOSTADC_DMA_SOURCE 40U
+
+/*!< Frequency of the ADC asynchronous clock (ADACK), typical value of the datasheet. */
+#define HOSTADC_ADACK_HZ 4000000U
+/*!< Duration of the calibration in ADCK periods. */
+#define HOSTADC_CALIBRATION_ADCK 3500U
+
+/*!< Long sample extra ADCK of the ADLSTS values. */
+static const uint8_t _longSampleAdck[4] = { 20U, 12U, 6U, 2U };
+
+/*!< Result bits of the MODE values: 8, 12 and 10 bits. */
+static const uint8_t _resultBits[4] = { 8U, 12U, 10U, 12U };
+
+/*!
+ * @brief State of the ADC0 model.
+ */
+typedef struct
+{
+	hostAdcInput_t input;
+	void *context;
+	bool calibrating;
+	uint64_t conversions;
+} hostAdc_t;
+
+static hostAdc_t g_adc;
+static hostSimDevice_t g_adcDevice;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Reads a register from the storage.
+ */
+static inline uint32_t HostAdc_Reg( uint32_t offset )
+{
+	return HostSim_RawRead( ADC0_BASE + offset, 4U );
+}
+
+/**
+ * @brief Stores a register.
+ */
+static inline void HostAdc_SetReg( uint32_t offset, uint32_t value )
+{
+	HostSim_RawWrite( ADC0_BASE + offset, value, 4U );
+}
+
+/**
+ * @brief Updates the interrupt request line and the DMA request (SC2[DMAEN]).
+ */
+static void HostAdc_UpdateIrq( void )
+{
+	const uint32_t sc1 = HostAdc_Reg( HOSTADC_SC1A );
+
+	HostSim_SetIrqLine( ADC0_IRQn, ( sc1 & ADC_SC1_AIEN_MASK ) && ( sc1 & ADC_SC1_COCO_MASK ) );
+	HostDma_SetRequest( HOSTADC_DMA_SOURCE,
+			( HostAdc_Reg( HOSTADC_SC2 ) & ADC_SC2_DMAEN_MASK ) && ( sc1 & ADC_SC1_COCO_MASK ) );
+}
+
+/**
+ * @brief Gets the ADCK period in core cycles.
+ */
+static uint64_t HostAdc_AdckPeriod( void )
+{
+	const uint32_t cfg1 = HostAdc_Reg( HOSTADC_CFG1 );
+	uint32_t clock;
+
+	switch ( ( cfg1 & ADC_CFG1_ADICLK_MASK ) >> ADC_CFG1_ADICLK_SHIFT )
+	{
+	case 0U:
+		clock = HostSimModule_GetBusClock();
+		break;
+	case 1U:
+		clock = HostSimModule_GetBusClock() / 2U;
+		break;
+	case 2U:
+		clock = CPU_XTAL_CLK_HZ;
+		break;
+	default:
+		clock = HOSTADC_ADACK_HZ;
+		break;
+	}
+	clock >>= ( cfg1 & ADC_CFG1_ADIV_MASK ) >> ADC_CFG1_ADIV_SHIFT;
+
+	return ( (uint64_t)SystemCoreClock + clock - 1U ) / clock;
+}
+
+/**
+ * @brief Gets the duration of a conversion in core cycles.
+ */
+static uint64_t HostAdc_ConversionCycles( void )
+{
+	const uint32_t cfg1 = HostAdc_Reg( HOSTADC_CFG1 );
+	const uint32_t sc3 = HostAdc_Reg( HOSTADC_SC3 );
+	const uint32_t samples = ( sc3 & ADC_SC3_AVGE_MASK ) ? ( 4U << ( sc3 & ADC_SC3_AVGS_MASK ) ) : 1U;
+	uint32_t adck = 20U;
+
+	if ( cfg1 & ADC_CFG1_ADLSMP_MASK )
+	{
+		adck += _longSampleAdck[HostAdc_Reg( HOSTADC_CFG2 ) & ADC_CFG2_ADLSTS_MASK];
+	}
+	adck = 3U + samples * adck;
+
+	return 5U * ( SystemCoreClock / HostSimModule_GetBusClock() ) + adck * HostAdc_AdckPeriod();
+}
+
+/**
+ * @brief End of a conversion or of the calibration.
+ */
+static void HostAdc_ConversionDone( void *context )
+{
+	uint32_t sc1 = HostAdc_Reg( HOSTADC_SC1A );
+
+	(void)context;
+	if ( g_adc.calibrating )
+	{
+		g_adc.calibrating = false;
+		HostAdc_SetReg( HOSTADC_SC3, HostAdc_Reg( HOSTADC_SC3 ) & ~( ADC_SC3_CAL_MASK | ADC_SC3_CALF_MASK ) );
+	}
+	else
+	{
+		const uint32_t channel = sc1 & ADC_SC1_ADCH_MASK;
+		const uint32_t bits = _resultBits[( HostAdc_Reg( HOSTADC_CFG1 ) & ADC_CFG1_MODE_MASK ) >> ADC_CFG1_MODE_SHIFT];
+		const uint16_t level = ( g_adc.input != NULL ) ? g_adc.input( channel, g_adc.context ) : 0U;
+
+		HostAdc_SetReg( HOSTADC_RA, (uint32_t)level >> ( 16U - bits ) );
+		++g_adc.conversions;
+	}
+	HostAdc_SetReg( HOSTADC_SC1A, sc1 | ADC_SC1_COCO_MASK );
+
+	/* The continuous mode starts the next conversion right away */
+	if ( ( HostAdc_Reg( HOSTADC_SC3 ) & ADC_SC3_ADCO_MASK ) && ( ( sc1 & ADC_SC1_ADCH_MASK ) != ADC_SC1_ADCH_MASK ) )
+	{
+		HostSim_Schedule( HostAdc_ConversionCycles(), HostAdc_ConversionDone, NULL );
+	}
+	else
+	{
+		HostAdc_SetReg( HOSTADC_SC2, HostAdc_Reg( HOSTADC_SC2 ) & ~ADC_SC2_ADACT_MASK );
+	}
+	HostAdc_UpdateIrq();
+}
+
+/**
+ * @brief Aborts the conversion in progress.
+ */
+static void HostAdc_Abort( void )
+{
+	HostSim_Cancel( HostAdc_ConversionDone, NULL );
+	g_adc.calibrating = false;
+	HostAdc_SetReg( HOSTADC_SC2, HostAdc_Reg( HOSTADC_SC2 ) & ~ADC_SC2_ADACT_MASK );
+}
+
+/**********************************************************************************/
+static uint32_t HostAdc_Read( hostSimDevice_t *dev, uint32_t offset, uint32_t width )
+{
+	const uint32_t value = HostSim_RawRead( dev->base + offset, width );
+
+	/* Reading the result clears the conversion complete flag */
+	if ( ( offset & ~3U ) == HOSTADC_RA )
+	{
+		HostAdc_SetReg( HOSTADC_SC1A, HostAdc_Reg( HOSTADC_SC1A ) & ~ADC_SC1_COCO_MASK );
+		HostAdc_UpdateIrq();
+	}
+	return value;
+}
+
+/**********************************************************************************/
+static void HostAdc_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	if ( width != 4U )
+	{
+		HostSim_Fatal( "%s register 0x%02x written with a %u byte access", dev->name, offset, width );
+	}
+
+	switch ( offset )
+	{
+	case HOSTADC_SC1A:
+		HostAdc_Abort();
+		HostAdc_SetReg( offset, value & ( ADC_SC1_AIEN_MASK | ADC_SC1_ADCH_MASK ) );
+		if ( ( ( value & ADC_SC1_ADCH_MASK ) != ADC_SC1_ADCH_MASK ) && !( HostAdc_Reg( HOSTADC_SC2 ) & ADC_SC2_ADTRG_MASK ) )
+		{
+			HostAdc_SetReg( HOSTADC_SC2, HostAdc_Reg( HOSTADC_SC2 ) | ADC_SC2_ADACT_MASK );
+			HostSim_Schedule( HostAdc_ConversionCycles(), HostAdc_ConversionDone, NULL );
+		}
+		HostAdc_UpdateIrq();
+		break;
+
+	case HOSTADC_RA:
+	case HOSTADC_RA + 4U:
+		break; /* Read-only */
+
+	case HOSTADC_SC2:
+		HostAdc_SetReg( offset, ( value & ~ADC_SC2_ADACT_MASK ) | ( HostAdc_Reg( offset ) & ADC_SC2_ADACT_MASK ) );
+		HostAdc_UpdateIrq();
+		break;
+
+	case HOSTADC_SC3:
+		{
+			uint32_t sc3 = ( value & ~( ADC_SC3_CAL_MASK | ADC_SC3_CALF_MASK ) ) |
+					( HostAdc_Reg( offset ) & ( ADC_SC3_CAL_MASK | ADC_SC3_CALF_MASK ) );
+
+			sc3 &= ~( value & ADC_SC3_CALF_MASK ); /* Write 1 to clear */
+			if ( ( value & ADC_SC3_CAL_MASK ) && !g_adc.calibrating )
+			{
+				HostAdc_Abort();
+				g_adc.calibrating = true;
+				sc3 |= ADC_SC3_CAL_MASK;
+				HostAdc_SetReg( HOSTADC_SC1A, HostAdc_Reg( HOSTADC_SC1A ) & ~ADC_SC1_COCO_MASK );
+				HostAdc_SetReg( HOSTADC_SC2, HostAdc_Reg( HOSTADC_SC2 ) | ADC_SC2_ADACT_MASK );
+				HostSim_Schedule( HOSTADC_CALIBRATION_ADCK * HostAdc_AdckPeriod(), HostAdc_ConversionDone, NULL );
+			}
+			HostAdc_SetReg( offset, sc3 );
+		}
+		break;
+
+	default:
+		HostAdc_SetReg( offset, value );
+		break;
+	}
+}
+
+/**********************************************************************************/
+static void HostAdc_Reset( hostSimDevice_t *dev )
+{
+	(void)dev;
+	g_adc.calibrating = false;
+	g_adc.conversions = 0U;
+	HostAdc_SetReg( HOSTADC_SC1A, 0x1FU );
+	HostAdc_SetReg( HOSTADC_SC1A + 4U, 0x1FU );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->OFS, 0x00000004UL, 4U );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->PG, 0x00008200UL, 4U );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->CLPD, 0x0000000AUL, 4U );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->CLPS, 0x00000020UL, 4U );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->CLP4, 0x00000200UL, 4U );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->CLP3, 0x00000100UL, 4U );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->CLP2, 0x00000080UL, 4U );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->CLP1, 0x00000040UL, 4U );
+	HostSim_RawWrite( (uint32_t)(uintptr_t)&ADC0->CLP0, 0x00000020UL, 4U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostAdc_SetInput( hostAdcInput_t input, void *context )
+{
+	g_adc.input = input;
+	g_adc.context = context;
+}
+
+/**********************************************************************************/
+uint64_t HostAdc_GetConversionCount( void )
+{
+	return g_adc.conversions;
+}
+
+/**********************************************************************************/
+void HostAdc_Register( void )
+{
+	g_adcDevice = (hostSimDevice_t){
+		.name = "ADC0", .base = ADC0_BASE, .size = sizeof(ADC_Type),
+		.gateMask = SIM_SCGC6_ADC0_MASK, .gateRegister = HostSimModule_GetGate( 6U ),
+		.Read = HostAdc_Read, .Write = HostAdc_Write, .Reset = HostAdc_Reset
+	};
+	HostSim_AddDevice( &g_adcDevice );
+}
+
+/*! @}*/
@@ -0,0 +1,351 @@
+/***************************************************************************************
+ * @file        model_dma.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the DMA controller and of the DMAMUX.
+ * @remarks     The peripheral models raise their requests with HostDma_SetRequest
+ *              and the channels move one element per request in cycle-steal mode
+ *              (DCR[CS]), or the whole count on a START or with CS cleared. Each
+ *              element takes a bus read and a bus write; the cycles stolen from the
+ *              core are not counted. A request with BCR at 0 ends with a
+ *              configuration error (DSR_BCR[CE]), as on the device. The modulo
+ *              buffers (SMOD/DMOD), the channel linking, the auto-align, the mixed
+ *              access sizes and the periodic triggers of the DMAMUX are not modeled
+ *              and stop the program.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+#include "host_models.h"
+
+#include <string.h>
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HOSTDMA_CHANNELS 4U
+#define HOSTDMA_SOURCES 64U
+
+/*!< DMAMUX sources 60 to 63 always request. */
+#define HOSTDMA_ALWAYS_ENABLED_SOURCE 60U
+
+/*!< Core cycles between two elements: a read and a write on the bus. */
+#define HOSTDMA_ELEMENT_CYCLES ( 2U * HOSTSIM_ACCESS_CYCLES )
+
+/*!< Largest byte count: BCR has 20 valid bits, more is a configuration error. */
+#define HOSTDMA_BCR_MAX 0xFFFFFU
+
+/*!< Register offsets. */
+#define HOSTDMA_SAR(n)     ( 0x100U + 0x10U * (n) )
+#define HOSTDMA_DAR(n)     ( 0x104U + 0x10U * (n) )
+#define HOSTDMA_DSR_BCR(n) ( 0x108U + 0x10U * (n) )
+#define HOSTDMA_DCR(n)     ( 0x10CU + 0x10U * (n) )
+
+#define HOSTDMA_DSR_ERRORS ( DMA_DSR_BCR_CE_MASK | DMA_DSR_BCR_BES_MASK | DMA_DSR_BCR_BED_MASK )
+
+/*!< DCR features that are not modeled. */
+#define HOSTDMA_DCR_UNSUPPORTED ( DMA_DCR_SMOD_MASK | DMA_DCR_DMOD_MASK | DMA_DCR_LINKCC_MASK | DMA_DCR_AA_MASK )
+
+/*!
+ * @brief State of the DMA model.
+ */
+typedef struct
+{
+	bool requests[HOSTDMA_SOURCES];       /*!< Request lines of the DMAMUX sources. */
+	bool continuous[HOSTDMA_CHANNELS];    /*!< The channel runs to the end without requests. */
+	uint64_t elements[HOSTDMA_CHANNELS];  /*!< Elements moved by each channel. */
+} hostDma_t;
+
+static hostDma_t g_dma;
+static hostSimDevice_t g_dmaDevice;
+static hostSimDevice_t g_dmamuxDevice;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Reads a register from the storage.
+ */
+static inline uint32_t HostDma_Reg( uint32_t offset )
+{
+	return HostSim_RawRead( DMA_BASE + offset, 4U );
+}
+
+/**
+ * @brief Stores a register.
+ */
+static inline void HostDma_SetReg( uint32_t offset, uint32_t value )
+{
+	HostSim_RawWrite( DMA_BASE + offset, value, 4U );
+}
+
+/**
+ * @brief Updates the interrupt line of a channel.
+ */
+static void HostDma_UpdateIrq( uint32_t channel )
+{
+	HostSim_SetIrqLine( (IRQn_Type)( DMA0_IRQn + channel ),
+			( HostDma_Reg( HOSTDMA_DCR(channel) ) & DMA_DCR_EINT_MASK ) &&
+			( HostDma_Reg( HOSTDMA_DSR_BCR(channel) ) & DMA_DSR_BCR_DONE_MASK ) );
+}
+
+/**
+ * @brief Checks if a channel has an element to move now.
+ */
+static bool HostDma_IsRequesting( uint32_t channel )
+{
+	const uint32_t dsr = HostDma_Reg( HOSTDMA_DSR_BCR(channel) );
+	const uint8_t chcfg = (uint8_t)HostSim_RawRead( DMAMUX0_BASE + channel, 1U );
+	const uint32_t source = chcfg & DMAMUX_CHCFG_SOURCE_MASK;
+
+	/* A request with BCR at 0 is serviced, to end with a configuration error */
+	if ( dsr & HOSTDMA_DSR_ERRORS )
+	{
+		return false;
+	}
+	if ( g_dma.continuous[channel] )
+	{
+		return true;
+	}
+	if ( !( HostDma_Reg( HOSTDMA_DCR(channel) ) & DMA_DCR_ERQ_MASK ) || !( chcfg & DMAMUX_CHCFG_ENBL_MASK ) )
+	{
+		return false;
+	}
+	return ( source >= HOSTDMA_ALWAYS_ENABLED_SOURCE ) || g_dma.requests[source];
+}
+
+/**
+ * @brief Decodes the SSIZE/DSIZE fields in bytes, 0 if reserved.
+ */
+static uint32_t HostDma_SizeBytes( uint32_t field )
+{
+	static const uint32_t sizes[4] = { 4U, 1U, 2U, 0U };
+
+	return sizes[field & 3U];
+}
+
+/**
+ * @brief Ends the transfer of a channel with a configuration error.
+ */
+static void HostDma_ConfigError( uint32_t channel )
+{
+	HostDma_SetReg( HOSTDMA_DSR_BCR(channel), ( HostDma_Reg( HOSTDMA_DSR_BCR(channel) ) & ~DMA_DSR_BCR_BSY_MASK ) |
+			DMA_DSR_BCR_CE_MASK | DMA_DSR_BCR_DONE_MASK );
+	g_dma.continuous[channel] = false;
+	HostDma_UpdateIrq( channel );
+}
+
+/**
+ * @brief Moves one element of a channel.
+ */
+static void HostDma_MoveElement( uint32_t channel )
+{
+	const uint32_t dcr = HostDma_Reg( HOSTDMA_DCR(channel) );
+	const uint32_t size = HostDma_SizeBytes( ( dcr & DMA_DCR_SSIZE_MASK ) >> DMA_DCR_SSIZE_SHIFT );
+	uint32_t sar = HostDma_Reg( HOSTDMA_SAR(channel) );
+	uint32_t dar = HostDma_Reg( HOSTDMA_DAR(channel) );
+	uint32_t dsr = HostDma_Reg( HOSTDMA_DSR_BCR(channel) );
+	uint32_t bcr = dsr & DMA_DSR_BCR_BCR_MASK;
+
+	if ( dcr & HOSTDMA_DCR_UNSUPPORTED )
+	{
+		HostSim_Fatal( "DMA channel %u: modulo, linking and auto-align (DCR 0x%08x) are not modeled", channel, dcr );
+	}
+	if ( size != HostDma_SizeBytes( ( dcr & DMA_DCR_DSIZE_MASK ) >> DMA_DCR_DSIZE_SHIFT ) )
+	{
+		HostSim_Fatal( "DMA channel %u: different source and destination sizes are not modeled", channel );
+	}
+	if ( ( size == 0U ) || ( bcr == 0U ) || ( bcr > HOSTDMA_BCR_MAX ) || ( bcr % size ) || ( sar % size ) ||
+			( dar % size ) )
+	{
+		HostDma_ConfigError( channel );
+		return;
+	}
+
+	HostSim_BusWrite( dar, HostSim_BusRead( sar, size ), size );
+	++g_dma.elements[channel];
+
+	sar += ( dcr & DMA_DCR_SINC_MASK ) ? size : 0U;
+	dar += ( dcr & DMA_DCR_DINC_MASK ) ? size : 0U;
+	bcr -= size;
+	dsr = ( dsr & ~DMA_DSR_BCR_BCR_MASK ) | bcr | DMA_DSR_BCR_BSY_MASK;
+	if ( bcr == 0U )
+	{
+		dsr = ( dsr & ~DMA_DSR_BCR_BSY_MASK ) | DMA_DSR_BCR_DONE_MASK;
+		g_dma.continuous[channel] = false;
+		if ( dcr & DMA_DCR_D_REQ_MASK )
+		{
+			HostDma_SetReg( HOSTDMA_DCR(channel), dcr & ~DMA_DCR_ERQ_MASK );
+		}
+	}
+	else if ( !( dcr & DMA_DCR_CS_MASK ) )
+	{
+		g_dma.continuous[channel] = true; /* A request starts the whole transfer */
+	}
+	HostDma_SetReg( HOSTDMA_SAR(channel), sar );
+	HostDma_SetReg( HOSTDMA_DAR(channel), dar );
+	HostDma_SetReg( HOSTDMA_DSR_BCR(channel), dsr );
+	HostDma_UpdateIrq( channel );
+}
+
+static void HostDma_Service( void *context );
+
+/**
+ * @brief Schedules the service of the channels if one of them has a request.
+ */
+static void HostDma_Kick( void )
+{
+	if ( HostSim_IsScheduled( HostDma_Service, NULL ) )
+	{
+		return;
+	}
+	for ( uint32_t channel = 0; channel < HOSTDMA_CHANNELS; ++channel )
+	{
+		if ( HostDma_IsRequesting( channel ) )
+		{
+			HostSim_Schedule( HOSTDMA_ELEMENT_CYCLES, HostDma_Service, NULL );
+			return;
+		}
+	}
+}
+
+/**
+ * @brief Moves an element of the requesting channel with the highest priority,
+ *        channel 0 first.
+ */
+static void HostDma_Service( void *context )
+{
+	(void)context;
+	for ( uint32_t channel = 0; channel < HOSTDMA_CHANNELS; ++channel )
+	{
+		if ( HostDma_IsRequesting( channel ) )
+		{
+			HostDma_MoveElement( channel );
+			break;
+		}
+	}
+	HostDma_Kick();
+}
+
+/**********************************************************************************/
+static void HostDma_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	const uint32_t reg = offset & ~3U;
+	const uint32_t shift = 8U * ( offset & 3U );
+	const uint32_t mask = (uint32_t)( ( ( 1ULL << ( 8U * width ) ) - 1U ) << shift );
+	const uint32_t channel = ( reg - HOSTDMA_SAR(0) ) / 0x10U;
+	const uint32_t old = HostDma_Reg( reg );
+	const uint32_t merged = ( old & ~mask ) | ( ( value << shift ) & mask );
+
+	(void)dev;
+	if ( ( offset & 3U ) + width > 4U )
+	{
+		HostSim_Fatal( "DMA access across two registers at offset 0x%x", offset );
+	}
+	if ( reg < HOSTDMA_SAR(0) )
+	{
+		return; /* Reserved */
+	}
+
+	switch ( reg - HOSTDMA_SAR(channel) )
+	{
+	case 0x8U:
+		{
+			/* DSR: writing DONE clears the status, the other bits are read only */
+			uint32_t dsr = old;
+
+			if ( ( mask & 0xFF000000UL ) && ( merged & DMA_DSR_BCR_DONE_MASK ) )
+			{
+				dsr &= ~( HOSTDMA_DSR_ERRORS | DMA_DSR_BCR_DONE_MASK | DMA_DSR_BCR_BSY_MASK );
+				g_dma.continuous[channel] = false;
+			}
+			dsr = ( dsr & ~( mask & DMA_DSR_BCR_BCR_MASK ) ) | ( merged & mask & DMA_DSR_BCR_BCR_MASK );
+			HostDma_SetReg( reg, dsr );
+		}
+		break;
+	case 0xCU:
+		HostDma_SetReg( reg, merged & ~DMA_DCR_START_MASK );
+		if ( merged & DMA_DCR_START_MASK )
+		{
+			g_dma.continuous[channel] = true;
+			HostDma_SetReg( HOSTDMA_DSR_BCR(channel), HostDma_Reg( HOSTDMA_DSR_BCR(channel) ) | DMA_DSR_BCR_BSY_MASK );
+		}
+		break;
+	default:
+		HostDma_SetReg( reg, merged );
+		break;
+	}
+	HostDma_UpdateIrq( channel );
+	HostDma_Kick();
+}
+
+/**********************************************************************************/
+static void HostDma_Reset( hostSimDevice_t *dev )
+{
+	(void)dev;
+	memset( &g_dma, 0, sizeof(g_dma) );
+}
+
+/**********************************************************************************/
+static void HostDmamux_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	(void)dev;
+	for ( uint32_t i = 0; i < width; ++i )
+	{
+		const uint8_t chcfg = (uint8_t)( value >> ( 8U * i ) );
+
+		if ( chcfg & DMAMUX_CHCFG_TRIG_MASK )
+		{
+			HostSim_Fatal( "DMAMUX channel %u: the periodic trigger is not modeled", offset + i );
+		}
+		HostSim_RawWrite( DMAMUX0_BASE + offset + i, chcfg, 1U );
+	}
+	HostDma_Kick();
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostDma_SetRequest( uint32_t source, bool asserted )
+{
+	g_dma.requests[source] = asserted;
+	if ( asserted )
+	{
+		HostDma_Kick();
+	}
+}
+
+/**********************************************************************************/
+uint64_t HostDma_GetElementCount( uint32_t channel )
+{
+	return g_dma.elements[channel];
+}
+
+/**********************************************************************************/
+void HostDma_Register( void )
+{
+	g_dmaDevice = (hostSimDevice_t){
+		.name = "DMA", .base = DMA_BASE, .size = sizeof(DMA_Type),
+		.gateMask = SIM_SCGC7_DMA_MASK, .gateRegister = HostSimModule_GetGate( 7U ),
+		.Write = HostDma_Write, .Reset = HostDma_Reset
+	};
+	HostSim_AddDevice( &g_dmaDevice );
+
+	g_dmamuxDevice = (hostSimDevice_t){
+		.name = "DMAMUX0", .base = DMAMUX0_BASE, .size = sizeof(DMAMUX_Type),
+		.gateMask = SIM_SCGC6_DMAMUX_MASK, .gateRegister = HostSimModule_GetGate( 6U ),
+		.Write = HostDmamux_Write
+	};
+	HostSim_AddDevice( &g_dmamuxDevice );
+}
+
+/*! @}*/
@@ -0,0 +1,232 @@
+/***************************************************************************************
+ * @file        model_gpio.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the GPIOA/GPIOB ports and of their fast GPIO aliases.
+ * @remarks     A pin configured as output has the level of PDOR, an input the level
+ *              set by the tests. The listeners see every change of the output pins,
+ *              which is how the host tests model the devices wired to the GPIO.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+#include "host_models.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Register offsets. */
+#define HOSTGPIO_PDOR 0x00U
+#define HOSTGPIO_PSOR 0x04U
+#define HOSTGPIO_PCOR 0x08U
+#define HOSTGPIO_PTOR 0x0CU
+#define HOSTGPIO_PDIR 0x10U
+#define HOSTGPIO_PDDR 0x14U
+
+/*!
+ * @brief State of a port, shared by its GPIO and fast GPIO aliases.
+ */
+typedef struct
+{
+	uint32_t pdor;
+	uint32_t pddr;
+	uint32_t inputs; /*!< Levels driven from outside. */
+	uint32_t pins;   /*!< Last level of the pins. */
+	hostGpioListener_t listeners[HOSTGPIO_MAX_LISTENERS];
+	void *contexts[HOSTGPIO_MAX_LISTENERS];
+	uint32_t listenerCount;
+} hostGpioPort_t;
+
+static hostGpioPort_t g_ports[HOSTSIM_PORT_COUNT];
+static hostSimDevice_t g_gpioDevices[HOSTSIM_PORT_COUNT];
+static hostSimDevice_t g_fgpioDevices[HOSTSIM_PORT_COUNT];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Gets the port of a GPIO or fast GPIO device.
+ */
+static uint32_t HostGpio_PortOf( hostSimDevice_t *dev )
+{
+	return (uint32_t)( (uintptr_t)dev->context );
+}
+
+/**
+ * @brief Computes the pin levels and notifies the changes.
+ */
+static void HostGpio_Update( uint32_t port )
+{
+	hostGpioPort_t *p = &g_ports[port];
+	const uint32_t pins = ( p->pdor & p->pddr ) | ( p->inputs & ~p->pddr );
+	const uint32_t changed = pins ^ p->pins;
+
+	if ( changed == 0U )
+	{
+		return;
+	}
+	p->pins = pins;
+	for ( uint32_t pin = 0; pin < 32U; ++pin )
+	{
+		if ( ( changed >> pin ) & 1U )
+		{
+			HostPort_PinChanged( port, pin, ( pins >> pin ) & 1U );
+		}
+	}
+	if ( changed & p->pddr )
+	{
+		for ( uint32_t i = 0; i < p->listenerCount; ++i )
+		{
+			p->listeners[i]( port, pins, changed & p->pddr, p->contexts[i] );
+		}
+	}
+}
+
+/**********************************************************************************/
+static void HostGpio_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	const uint32_t port = HostGpio_PortOf( dev );
+	hostGpioPort_t *p = &g_ports[port];
+
+	if ( width != 4U )
+	{
+		/* Byte and halfword writes are allowed on PDOR and PDDR lanes */
+		const uint32_t shift = ( offset & 3U ) * 8U;
+		const uint32_t mask = ( ( width == 1U ) ? 0xFFUL : 0xFFFFUL ) << shift;
+		const uint32_t old = ( ( offset & ~3U ) == HOSTGPIO_PDDR ) ? p->pddr :
+				( ( offset & ~3U ) == HOSTGPIO_PDOR ) ? p->pdor : 0U;
+
+		value = ( old & ~mask ) | ( ( value << shift ) & mask );
+		if ( ( ( offset & ~3U ) != HOSTGPIO_PDOR ) && ( ( offset & ~3U ) != HOSTGPIO_PDDR ) )
+		{
+			value &= mask;
+		}
+		offset &= ~3U;
+	}
+
+	switch ( offset )
+	{
+	case HOSTGPIO_PDOR:
+		p->pdor = value;
+		break;
+	case HOSTGPIO_PSOR:
+		p->pdor |= value;
+		break;
+	case HOSTGPIO_PCOR:
+		p->pdor &= ~value;
+		break;
+	case HOSTGPIO_PTOR:
+		p->pdor ^= value;
+		break;
+	case HOSTGPIO_PDDR:
+		p->pddr = value;
+		break;
+	default:
+		break; /* PDIR is read-only */
+	}
+	HostGpio_Update( port );
+}
+
+/**********************************************************************************/
+static uint32_t HostGpio_Read( hostSimDevice_t *dev, uint32_t offset, uint32_t width )
+{
+	const hostGpioPort_t *p = &g_ports[HostGpio_PortOf( dev )];
+	uint32_t value;
+
+	switch ( offset & ~3U )
+	{
+	case HOSTGPIO_PDOR:
+		value = p->pdor;
+		break;
+	case HOSTGPIO_PDIR:
+		value = p->pins;
+		break;
+	case HOSTGPIO_PDDR:
+		value = p->pddr;
+		break;
+	default:
+		value = 0U; /* Write-only */
+		break;
+	}
+	value >>= ( offset & 3U ) * 8U;
+	return ( width == 4U ) ? value : ( value & ( ( 1UL << ( width * 8U ) ) - 1U ) );
+}
+
+/**********************************************************************************/
+static void HostGpio_Reset( hostSimDevice_t *dev )
+{
+	hostGpioPort_t *p = &g_ports[HostGpio_PortOf( dev )];
+
+	/* The listeners and the outside levels survive a reset */
+	p->pdor = p->pddr = 0U;
+	p->pins = p->inputs;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostGpio_AddListener( uint32_t port, hostGpioListener_t listener, void *context )
+{
+	hostGpioPort_t *p = &g_ports[port];
+
+	if ( p->listenerCount == HOSTGPIO_MAX_LISTENERS )
+	{
+		HostSim_Fatal( "too many listeners of GPIO port %u", port );
+	}
+	p->listeners[p->listenerCount] = listener;
+	p->contexts[p->listenerCount++] = context;
+}
+
+/**********************************************************************************/
+void HostGpio_SetInputs( uint32_t port, uint32_t mask, uint32_t levels )
+{
+	g_ports[port].inputs = ( g_ports[port].inputs & ~mask ) | ( levels & mask );
+	HostGpio_Update( port );
+}
+
+/**********************************************************************************/
+uint32_t HostGpio_GetPins( uint32_t port )
+{
+	return g_ports[port].pins;
+}
+
+/**********************************************************************************/
+uint64_t HostGpio_GetWriteCount( uint32_t port )
+{
+	return g_gpioDevices[port].writes + g_fgpioDevices[port].writes;
+}
+
+/**********************************************************************************/
+void HostGpio_Register( void )
+{
+	static const char *const names[HOSTSIM_PORT_COUNT] = { "GPIOA", "GPIOB" };
+	static const char *const fastNames[HOSTSIM_PORT_COUNT] = { "FGPIOA", "FGPIOB" };
+	static const uint32_t bases[HOSTSIM_PORT_COUNT] = { PTA_BASE, PTB_BASE };
+	static const uint32_t fastBases[HOSTSIM_PORT_COUNT] = { FPTA_BASE, FPTB_BASE };
+
+	for ( uint32_t i = 0; i < HOSTSIM_PORT_COUNT; ++i )
+	{
+		g_gpioDevices[i] = (hostSimDevice_t){
+			.name = names[i], .base = bases[i], .size = sizeof(GPIO_Type),
+			.Read = HostGpio_Read, .Write = HostGpio_Write, .Reset = HostGpio_Reset,
+			.context = (void*)(uintptr_t)i
+		};
+		g_fgpioDevices[i] = (hostSimDevice_t){
+			.name = fastNames[i], .base = fastBases[i], .size = sizeof(GPIO_Type),
+			.Read = HostGpio_Read, .Write = HostGpio_Write, .context = (void*)(uintptr_t)i
+		};
+		HostSim_AddDevice( &g_gpioDevices[i] );
+		HostSim_AddDevice( &g_fgpioDevices[i] );
+	}
+}
+
+/*! @}*/
@@ -0,0 +1,399 @@
+/***************************************************************************************
+ * @file        model_i2c.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the I2C0 module in master mode and of the bus it drives.
+ * @remarks     A byte takes 9 SCL periods and a START, repeated START or STOP one
+ *              period. The slaves attached by the tests answer at the byte level.
+ *              The slave mode of the module, the arbitration and the SMBus features
+ *              are not modeled.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+#include "host_models.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Register offsets. */
+#define HOSTI2C_F   0x1U
+#define HOSTI2C_C1  0x2U
+#define HOSTI2C_S   0x3U
+#define HOSTI2C_D   0x4U
+#define HOSTI2C_FLT 0x6U
+
+/*!< SCL divider of the I2C_F[ICR] values, from the reference manual. */
+static const uint16_t _sclDividers[64] = {
+	20U, 22U, 24U, 26U, 28U, 30U, 34U, 40U,
+	28U, 32U, 36U, 40U, 44U, 48U, 56U, 68U,
+	48U, 56U, 64U, 72U, 80U, 88U, 104U, 128U,
+	80U, 96U, 112U, 128U, 144U, 160U, 192U, 240U,
+	160U, 192U, 224U, 256U, 288U, 320U, 384U, 480U,
+	320U, 384U, 448U, 512U, 576U, 640U, 768U, 960U,
+	640U, 768U, 896U, 1024U, 1152U, 1280U, 1536U, 1920U,
+	1280U, 1536U, 1792U, 2048U, 2304U, 2560U, 3072U, 3840U
+};
+
+/*!
+ * @brief State of the I2C0 model.
+ */
+typedef struct
+{
+	uint8_t s;                /*!< Status register. */
+	uint8_t d;                /*!< Data register. */
+	uint8_t txByte;           /*!< Byte being sent. */
+	bool transferring;        /*!< A byte is on the bus. */
+	bool addressNext;         /*!< The next byte sent is an address. */
+	bool reading;             /*!< The addressed slave transmits. */
+	uint64_t busFreeTime;     /*!< Time the bus ends the current condition. */
+	hostI2cSlave_t *slave;    /*!< Addressed slave, NULL if none answered. */
+	hostI2cSlave_t *slaves;
+	hostI2cStats_t stats;
+} hostI2c_t;
+
+static hostI2c_t g_i2c;
+static hostSimDevice_t g_i2cDevice;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Reads a register from the storage.
+ */
+static inline uint8_t HostI2c_Reg( uint32_t offset )
+{
+	return (uint8_t)HostSim_RawRead( I2C0_BASE + offset, 1U );
+}
+
+/**
+ * @brief Updates the interrupt request line.
+ */
+static void HostI2c_UpdateIrq( void )
+{
+	const uint8_t c1 = HostI2c_Reg( HOSTI2C_C1 );
+
+	HostSim_SetIrqLine( I2C0_IRQn, ( c1 & I2C_C1_IICEN_MASK ) && ( c1 & I2C_C1_IICIE_MASK ) &&
+			( g_i2c.s & I2C_S_IICIF_MASK ) );
+}
+
+/**
+ * @brief Gets the SCL period in core cycles.
+ */
+static uint64_t HostI2c_SclPeriod( void )
+{
+	const uint8_t f = HostI2c_Reg( HOSTI2C_F );
+	const uint32_t mult = ( f & I2C_F_MULT_MASK ) >> I2C_F_MULT_SHIFT;
+	const uint32_t divider = (uint32_t)_sclDividers[f & I2C_F_ICR_MASK] << ( ( mult < 3U ) ? mult : 0U );
+	const uint32_t busClock = HostSimModule_GetBusClock();
+
+	return ( (uint64_t)divider * SystemCoreClock + busClock - 1U ) / busClock;
+}
+
+/**
+ * @brief Occupies the bus with a condition of a number of SCL periods.
+ * @return The delay until the end of the condition.
+ */
+static uint64_t HostI2c_Occupy( uint32_t periods )
+{
+	const uint64_t now = HostSim_GetCycles();
+
+	if ( g_i2c.busFreeTime < now )
+	{
+		g_i2c.busFreeTime = now;
+	}
+	g_i2c.busFreeTime += periods * HostI2c_SclPeriod();
+	g_i2c.stats.sclCycles += periods;
+
+	return g_i2c.busFreeTime - now;
+}
+
+/**
+ * @brief Ends the transaction with the addressed slave.
+ */
+static void HostI2c_ReleaseSlave( void )
+{
+	if ( ( g_i2c.slave != NULL ) && ( g_i2c.slave->Stop != NULL ) )
+	{
+		g_i2c.slave->Stop( g_i2c.slave );
+	}
+	g_i2c.slave = NULL;
+}
+
+/**
+ * @brief End of a byte transfer: the 9th SCL clock.
+ */
+static void HostI2c_ByteDone( void *context )
+{
+	const uint8_t c1 = HostI2c_Reg( HOSTI2C_C1 );
+	bool ack = false;
+
+	(void)context;
+	g_i2c.transferring = false;
+	++g_i2c.stats.bytes;
+
+	if ( g_i2c.addressNext )
+	{
+		g_i2c.addressNext = false;
+		g_i2c.reading = ( g_i2c.txByte & 1U ) != 0U;
+		for ( hostI2cSlave_t *slave = g_i2c.slaves; slave != NULL; slave = slave->next )
+		{
+			if ( slave->address == ( g_i2c.txByte >> 1 ) )
+			{
+				ack = ( slave->Start != NULL ) ? slave->Start( slave, g_i2c.reading ) : true;
+				g_i2c.slave = ack ? slave : NULL;
+				break;
+			}
+		}
+	}
+	else if ( !g_i2c.reading )
+	{
+		if ( g_i2c.slave != NULL )
+		{
+			ack = ( g_i2c.slave->Write != NULL ) ? g_i2c.slave->Write( g_i2c.slave, g_i2c.txByte ) : true;
+		}
+	}
+	else
+	{
+		/* The master answers with TXAK, sampled at the 9th clock */
+		ack = !( c1 & I2C_C1_TXAK_MASK );
+		g_i2c.d = 0xFFU;
+		if ( g_i2c.slave != NULL )
+		{
+			g_i2c.d = ( g_i2c.slave->Read != NULL ) ? g_i2c.slave->Read( g_i2c.slave, ack ) : 0xFFU;
+		}
+	}
+
+	if ( !ack )
+	{
+		++g_i2c.stats.naks;
+	}
+	g_i2c.s = ack ? ( g_i2c.s & ~I2C_S_RXAK_MASK ) : ( g_i2c.s | I2C_S_RXAK_MASK );
+	g_i2c.s |= I2C_S_TCF_MASK | I2C_S_IICIF_MASK;
+	HostI2c_UpdateIrq();
+}
+
+/**
+ * @brief Starts a byte transfer after the current bus condition.
+ */
+static void HostI2c_StartByte( void )
+{
+	if ( g_i2c.transferring )
+	{
+		HostSim_Fatal( "I2C0 byte started while another one is on the bus" );
+	}
+	g_i2c.transferring = true;
+	g_i2c.s &= ~I2C_S_TCF_MASK;
+	HostSim_Schedule( HostI2c_Occupy( 9U ), HostI2c_ByteDone, NULL );
+}
+
+/**
+ * @brief The bus is free after a STOP.
+ */
+static void HostI2c_StopDone( void *context )
+{
+	(void)context;
+	g_i2c.s &= ~I2C_S_BUSY_MASK;
+	HostSim_RawWrite( I2C0_BASE + HOSTI2C_FLT, HostI2c_Reg( HOSTI2C_FLT ) | I2C_FLT_STOPF_MASK, 1U );
+	if ( HostI2c_Reg( HOSTI2C_FLT ) & I2C_FLT_STOPIE_MASK )
+	{
+		g_i2c.s |= I2C_S_IICIF_MASK;
+		HostI2c_UpdateIrq();
+	}
+}
+
+/**
+ * @brief Applies a write of C1.
+ */
+static void HostI2c_WriteC1( uint8_t value )
+{
+	const uint8_t old = HostI2c_Reg( HOSTI2C_C1 );
+
+	/* RSTA is write-only, it reads 0 */
+	HostSim_RawWrite( I2C0_BASE + HOSTI2C_C1, value & (uint8_t)~I2C_C1_RSTA_MASK, 1U );
+	if ( !( value & I2C_C1_IICEN_MASK ) )
+	{
+		return;
+	}
+
+	if ( ( value & I2C_C1_MST_MASK ) && !( old & I2C_C1_MST_MASK ) )
+	{
+		if ( g_i2c.s & I2C_S_BUSY_MASK )
+		{
+			/* START on a busy bus: the arbitration is lost */
+			HostSim_RawWrite( I2C0_BASE + HOSTI2C_C1, value & (uint8_t)~( I2C_C1_MST_MASK | I2C_C1_RSTA_MASK ), 1U );
+			g_i2c.s |= I2C_S_ARBL_MASK | I2C_S_IICIF_MASK;
+		}
+		else
+		{
+			++g_i2c.stats.starts;
+			(void)HostI2c_Occupy( 1U );
+			g_i2c.s |= I2C_S_BUSY_MASK;
+			g_i2c.addressNext = true;
+			g_i2c.slave = NULL;
+		}
+	}
+	else if ( ( value & I2C_C1_MST_MASK ) && ( value & I2C_C1_RSTA_MASK ) )
+	{
+		++g_i2c.stats.repeatedStarts;
+		(void)HostI2c_Occupy( 1U );
+		g_i2c.addressNext = true;
+	}
+	else if ( !( value & I2C_C1_MST_MASK ) && ( old & I2C_C1_MST_MASK ) )
+	{
+		++g_i2c.stats.stops;
+		HostI2c_ReleaseSlave();
+		HostSim_Schedule( HostI2c_Occupy( 1U ), HostI2c_StopDone, NULL );
+	}
+	HostI2c_UpdateIrq();
+}
+
+/**********************************************************************************/
+static uint32_t HostI2c_Read( hostSimDevice_t *dev, uint32_t offset, uint32_t width )
+{
+	uint32_t value = 0U;
+
+	(void)dev;
+	for ( uint32_t i = 0; i < width; ++i )
+	{
+		const uint32_t reg = offset + i;
+		uint8_t byte;
+
+		if ( reg == HOSTI2C_S )
+		{
+			byte = g_i2c.s;
+		}
+		else if ( reg == HOSTI2C_D )
+		{
+			const uint8_t c1 = HostI2c_Reg( HOSTI2C_C1 );
+
+			byte = g_i2c.d;
+			/* In master receive mode, reading D receives the next byte */
+			if ( ( c1 & I2C_C1_IICEN_MASK ) && ( c1 & I2C_C1_MST_MASK ) && !( c1 & I2C_C1_TX_MASK ) )
+			{
+				if ( g_i2c.addressNext )
+				{
+					HostSim_Fatal( "I2C0 receives before sending the slave address" );
+				}
+				HostI2c_StartByte();
+			}
+		}
+		else
+		{
+			byte = HostI2c_Reg( reg );
+		}
+		value |= (uint32_t)byte << ( i * 8U );
+	}
+	return value;
+}
+
+/**********************************************************************************/
+static void HostI2c_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	(void)dev;
+	for ( uint32_t i = 0; i < width; ++i )
+	{
+		const uint32_t reg = offset + i;
+		const uint8_t byte = (uint8_t)( value >> ( i * 8U ) );
+
+		switch ( reg )
+		{
+		case HOSTI2C_C1:
+			HostI2c_WriteC1( byte );
+			break;
+
+		case HOSTI2C_S:
+			g_i2c.s &= ~( byte & ( I2C_S_ARBL_MASK | I2C_S_IICIF_MASK ) );
+			HostI2c_UpdateIrq();
+			break;
+
+		case HOSTI2C_D:
+			g_i2c.d = byte;
+			if ( ( HostI2c_Reg( HOSTI2C_C1 ) & ( I2C_C1_IICEN_MASK | I2C_C1_MST_MASK | I2C_C1_TX_MASK ) ) ==
+				 ( I2C_C1_IICEN_MASK | I2C_C1_MST_MASK | I2C_C1_TX_MASK ) )
+			{
+				g_i2c.txByte = byte;
+				HostI2c_StartByte();
+			}
+			break;
+
+		case HOSTI2C_FLT:
+			HostSim_RawWrite( I2C0_BASE + reg,
+					( byte & (uint8_t)~I2C_FLT_STOPF_MASK ) |
+					( HostI2c_Reg( reg ) & I2C_FLT_STOPF_MASK & (uint8_t)~byte ), 1U );
+			break;
+
+		default:
+			HostSim_RawWrite( I2C0_BASE + reg, byte, 1U );
+			break;
+		}
+	}
+}
+
+/**********************************************************************************/
+static void HostI2c_Reset( hostSimDevice_t *dev )
+{
+	(void)dev;
+	g_i2c.s = I2C_S_TCF_MASK;
+	g_i2c.d = g_i2c.txByte = 0U;
+	g_i2c.transferring = g_i2c.addressNext = g_i2c.reading = false;
+	g_i2c.busFreeTime = 0U;
+	g_i2c.slave = NULL;
+	g_i2c.stats = (hostI2cStats_t){ 0 };
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostI2c_AddSlave( hostI2cSlave_t *slave )
+{
+	slave->next = g_i2c.slaves;
+	g_i2c.slaves = slave;
+}
+
+/**********************************************************************************/
+void HostI2c_RemoveSlaves( void )
+{
+	g_i2c.slaves = NULL;
+	g_i2c.slave = NULL;
+}
+
+/**********************************************************************************/
+const hostI2cStats_t *HostI2c_GetStats( void )
+{
+	return &g_i2c.stats;
+}
+
+/**********************************************************************************/
+void HostI2c_ClearStats( void )
+{
+	g_i2c.stats = (hostI2cStats_t){ 0 };
+}
+
+/**********************************************************************************/
+uint64_t HostI2c_GetSclCycles( void )
+{
+	return HostI2c_SclPeriod();
+}
+
+/**********************************************************************************/
+void HostI2c_Register( void )
+{
+	g_i2cDevice = (hostSimDevice_t){
+		.name = "I2C0", .base = I2C0_BASE, .size = sizeof(I2C_Type),
+		.gateMask = SIM_SCGC4_I2C0_MASK, .gateRegister = HostSimModule_GetGate( 4U ),
+		.Read = HostI2c_Read, .Write = HostI2c_Write, .Reset = HostI2c_Reset
+	};
+	HostSim_AddDevice( &g_i2cDevice );
+}
+
+/*! @}*/
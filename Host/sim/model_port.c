@@ -0,0 +1,193 @@
+/***************************************************************************************
+ * @file        model_port.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the PORTA/PORTB pin control and pin interrupts.
+ * @remarks     The pin multiplexing is not checked: the GPIO model drives the pins
+ *              whatever MUX field they have.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+#include "host_models.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Writable bits of PORTx_PCRn: IRQC, MUX, DSE, PFE, SRE, PE and PS. */
+#define HOSTPORT_PCR_WRITABLE 0x000F0757UL
+
+/*!< Register offsets. */
+#define HOSTPORT_GPCLR 0x80U
+#define HOSTPORT_GPCHR 0x84U
+#define HOSTPORT_ISFR  0xA0U
+
+/*!< IRQC field values of the interrupt modes. */
+#define HOSTPORT_IRQC_ZERO    8U
+#define HOSTPORT_IRQC_RISING  9U
+#define HOSTPORT_IRQC_FALLING 10U
+#define HOSTPORT_IRQC_EITHER  11U
+#define HOSTPORT_IRQC_ONE     12U
+
+static hostSimDevice_t g_portDevices[HOSTSIM_PORT_COUNT];
+
+static const IRQn_Type _portIrqs[HOSTSIM_PORT_COUNT] = { PORTA_IRQn, PORTB_IRQn };
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Gets the IRQC field of a pin.
+ */
+static uint32_t HostPort_GetIrqc( hostSimDevice_t *dev, uint32_t pin )
+{
+	return ( HostSim_RawRead( dev->base + pin * 4U, 4U ) & PORT_PCR_IRQC_MASK ) >> PORT_PCR_IRQC_SHIFT;
+}
+
+/**
+ * @brief Sets the interrupt flag of a pin and updates the request line.
+ */
+static void HostPort_SetFlag( uint32_t port, uint32_t pin )
+{
+	hostSimDevice_t *dev = &g_portDevices[port];
+
+	HostSim_RawWrite( dev->base + pin * 4U, HostSim_RawRead( dev->base + pin * 4U, 4U ) | PORT_PCR_ISF_MASK, 4U );
+	HostSim_RawWrite( dev->base + HOSTPORT_ISFR, HostSim_RawRead( dev->base + HOSTPORT_ISFR, 4U ) | ( 1UL << pin ), 4U );
+	HostSim_SetIrqLine( _portIrqs[port], true );
+}
+
+/**
+ * @brief Sets the flags of the pins with a level interrupt whose level is active.
+ */
+static void HostPort_UpdateLevels( uint32_t port )
+{
+	hostSimDevice_t *dev = &g_portDevices[port];
+	const uint32_t pins = HostGpio_GetPins( port );
+
+	for ( uint32_t pin = 0; pin < 32U; ++pin )
+	{
+		const uint32_t irqc = HostPort_GetIrqc( dev, pin );
+		const bool level = ( pins >> pin ) & 1U;
+
+		if ( ( ( irqc == HOSTPORT_IRQC_ZERO ) && !level ) || ( ( irqc == HOSTPORT_IRQC_ONE ) && level ) )
+		{
+			HostPort_SetFlag( port, pin );
+		}
+	}
+	HostSim_SetIrqLine( _portIrqs[port], HostSim_RawRead( dev->base + HOSTPORT_ISFR, 4U ) != 0U );
+}
+
+/**
+ * @brief Clears interrupt flags, write 1 to clear.
+ */
+static void HostPort_ClearFlags( hostSimDevice_t *dev, uint32_t pins )
+{
+	for ( uint32_t pin = 0; pin < 32U; ++pin )
+	{
+		if ( ( pins >> pin ) & 1U )
+		{
+			HostSim_RawWrite( dev->base + pin * 4U,
+					HostSim_RawRead( dev->base + pin * 4U, 4U ) & ~PORT_PCR_ISF_MASK, 4U );
+		}
+	}
+	HostSim_RawWrite( dev->base + HOSTPORT_ISFR, HostSim_RawRead( dev->base + HOSTPORT_ISFR, 4U ) & ~pins, 4U );
+}
+
+/**********************************************************************************/
+static void HostPort_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	const uint32_t port = (uint32_t)( dev - g_portDevices );
+
+	if ( width != 4U )
+	{
+		HostSim_Fatal( "%s register 0x%02x written with a %u byte access", dev->name, offset, width );
+	}
+
+	if ( offset < HOSTPORT_GPCLR )
+	{
+		const uint32_t pin = offset / 4U;
+		const uint32_t pcr = HostSim_RawRead( dev->base + offset, 4U );
+
+		HostSim_RawWrite( dev->base + offset, ( pcr & PORT_PCR_ISF_MASK ) | ( value & HOSTPORT_PCR_WRITABLE ), 4U );
+		if ( value & PORT_PCR_ISF_MASK )
+		{
+			HostPort_ClearFlags( dev, 1UL << pin );
+		}
+	}
+	else if ( ( offset == HOSTPORT_GPCLR ) || ( offset == HOSTPORT_GPCHR ) )
+	{
+		const uint32_t first = ( offset == HOSTPORT_GPCLR ) ? 0U : 16U;
+
+		for ( uint32_t pin = 0; pin < 16U; ++pin )
+		{
+			if ( ( value >> ( 16U + pin ) ) & 1U )
+			{
+				const uint32_t address = dev->base + ( first + pin ) * 4U;
+				const uint32_t pcr = HostSim_RawRead( address, 4U );
+
+				HostSim_RawWrite( address, ( pcr & ~0xFFFFUL ) | ( value & HOSTPORT_PCR_WRITABLE & 0xFFFFUL ), 4U );
+			}
+		}
+	}
+	else if ( offset == HOSTPORT_ISFR )
+	{
+		HostPort_ClearFlags( dev, value );
+	}
+
+	/* A level interrupt flags again while its level is active */
+	HostPort_UpdateLevels( port );
+}
+
+/**********************************************************************************/
+static uint32_t HostPort_Read( hostSimDevice_t *dev, uint32_t offset, uint32_t width )
+{
+	if ( ( offset == HOSTPORT_GPCLR ) || ( offset == HOSTPORT_GPCHR ) )
+	{
+		return 0U; /* Write-only */
+	}
+	return HostSim_RawRead( dev->base + offset, width );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostPort_PinChanged( uint32_t port, uint32_t pin, bool level )
+{
+	const uint32_t irqc = HostPort_GetIrqc( &g_portDevices[port], pin );
+
+	if ( ( ( irqc == HOSTPORT_IRQC_RISING ) && level ) || ( ( irqc == HOSTPORT_IRQC_FALLING ) && !level ) ||
+		 ( irqc == HOSTPORT_IRQC_EITHER ) || ( ( irqc == HOSTPORT_IRQC_ZERO ) && !level ) ||
+		 ( ( irqc == HOSTPORT_IRQC_ONE ) && level ) )
+	{
+		HostPort_SetFlag( port, pin );
+	}
+}
+
+/**********************************************************************************/
+void HostPort_Register( void )
+{
+	static const char *const names[HOSTSIM_PORT_COUNT] = { "PORTA", "PORTB" };
+	static const uint32_t bases[HOSTSIM_PORT_COUNT] = { PORTA_BASE, PORTB_BASE };
+	static const uint32_t gates[HOSTSIM_PORT_COUNT] = { SIM_SCGC5_PORTA_MASK, SIM_SCGC5_PORTB_MASK };
+
+	for ( uint32_t i = 0; i < HOSTSIM_PORT_COUNT; ++i )
+	{
+		g_portDevices[i] = (hostSimDevice_t){
+			.name = names[i], .base = bases[i], .size = sizeof(PORT_Type),
+			.gateMask = gates[i], .gateRegister = HostSimModule_GetGate( 5U ),
+			.Read = HostPort_Read, .Write = HostPort_Write
+		};
+		HostSim_AddDevice( &g_portDevices[i] );
+	}
+}
+
+/*! @}*/
@@ -0,0 +1,344 @@
+/***************************************************************************************
+ * @file        model_scs.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the Cortex-M0+ System Control Space: SysTick, NVIC and SCB.
+ * @remarks     Only the priority bits implemented by the KL05 (bits 7:6) are kept.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+
+#include <string.h>
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define SCS_SYST_CSR  0x010U
+#define SCS_SYST_RVR  0x014U
+#define SCS_SYST_CVR  0x018U
+#define SCS_SYST_CALIB 0x01CU
+#define SCS_NVIC_ISER 0x100U
+#define SCS_NVIC_ICER 0x180U
+#define SCS_NVIC_ISPR 0x200U
+#define SCS_NVIC_ICPR 0x280U
+#define SCS_NVIC_IPR  0x400U
+#define SCS_SCB_CPUID 0xD00U
+#define SCS_SCB_ICSR  0xD04U
+#define SCS_SCB_AIRCR 0xD0CU
+#define SCS_SCB_SHPR2 0xD1CU
+#define SCS_SCB_SHPR3 0xD20U
+
+#define SCS_SYST_CSR_ENABLE    (1UL << 0)
+#define SCS_SYST_CSR_TICKINT   (1UL << 1)
+#define SCS_SYST_CSR_COUNTFLAG (1UL << 16)
+
+#define SCS_ICSR_PENDSTCLR  (1UL << 25)
+#define SCS_ICSR_PENDSTSET  (1UL << 26)
+#define SCS_ICSR_PENDSVCLR  (1UL << 27)
+#define SCS_ICSR_PENDSVSET  (1UL << 28)
+#define SCS_ICSR_NMIPENDSET (1UL << 31)
+
+
+/*!
+ * @brief SysTick state. The counter is computed from the time it reaches zero.
+ */
+typedef struct
+{
+	uint32_t csr;       /*!< CSR without COUNTFLAG. */
+	bool countFlag;
+	uint32_t reload;    /*!< RVR. */
+	uint32_t stopped;   /*!< CVR while the counter is disabled. */
+	uint64_t zeroTime;  /*!< Time the counter reaches zero, while enabled. */
+} hostSysTick_t;
+
+static hostSysTick_t g_sysTick;
+static uint32_t g_ipr[8];
+static uint32_t g_shpr2, g_shpr3;
+
+static hostSimDevice_t g_scsDevice;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Counter wrap event: sets COUNTFLAG, pends the interrupt and reloads.
+ */
+static void HostScs_SysTickWrap( void *context )
+{
+	(void)context;
+	g_sysTick.countFlag = true;
+	if ( g_sysTick.csr & SCS_SYST_CSR_TICKINT )
+	{
+		HostSim_PendException( HOSTSIM_EXCEPTION_SYSTICK );
+	}
+	if ( g_sysTick.reload != 0U )
+	{
+		g_sysTick.zeroTime += g_sysTick.reload + 1U;
+		HostSim_Schedule( g_sysTick.zeroTime - HostSim_GetCycles(), HostScs_SysTickWrap, NULL );
+	}
+}
+
+/**
+ * @brief Gets the current SysTick counter value.
+ */
+static uint32_t HostScs_SysTickValue( void )
+{
+	if ( !( g_sysTick.csr & SCS_SYST_CSR_ENABLE ) )
+	{
+		return g_sysTick.stopped;
+	}
+	if ( g_sysTick.zeroTime <= HostSim_GetCycles() )
+	{
+		return 0U;
+	}
+	return (uint32_t)( g_sysTick.zeroTime - HostSim_GetCycles() ) & 0xFFFFFFU;
+}
+
+/**
+ * @brief Starts the counter from a value, 0 reloads on the next clock.
+ */
+static void HostScs_SysTickStart( uint32_t value )
+{
+	HostSim_Cancel( HostScs_SysTickWrap, NULL );
+	if ( value == 0U )
+	{
+		if ( g_sysTick.reload == 0U )
+		{
+			return;
+		}
+		value = g_sysTick.reload + 1U;
+	}
+	g_sysTick.zeroTime = HostSim_GetCycles() + value;
+	HostSim_Schedule( value, HostScs_SysTickWrap, NULL );
+}
+
+/**
+ * @brief Rebuilds the exception priorities from IPR and SHPR.
+ */
+static void HostScs_UpdatePriorities( void )
+{
+	for ( uint32_t irq = 0; irq < 32U; ++irq )
+	{
+		g_hostSimNvic.priority[HOSTSIM_IRQ_EXCEPTION(irq)] = (uint8_t)( g_ipr[irq / 4U] >> ( 8U * ( irq % 4U ) ) );
+	}
+	g_hostSimNvic.priority[HOSTSIM_EXCEPTION_SVCALL] = (uint8_t)( g_shpr2 >> 24 );
+	g_hostSimNvic.priority[HOSTSIM_EXCEPTION_PENDSV] = (uint8_t)( g_shpr3 >> 16 );
+	g_hostSimNvic.priority[HOSTSIM_EXCEPTION_SYSTICK] = (uint8_t)( g_shpr3 >> 24 );
+}
+
+/**
+ * @brief Reads a 32-bit SCS register.
+ */
+static uint32_t HostScs_ReadWord( uint32_t offset )
+{
+	uint32_t value;
+
+	switch ( offset )
+	{
+	case SCS_SYST_CSR:
+		value = g_sysTick.csr | ( g_sysTick.countFlag ? SCS_SYST_CSR_COUNTFLAG : 0U );
+		g_sysTick.countFlag = false;
+		return value;
+	case SCS_SYST_RVR:
+		return g_sysTick.reload;
+	case SCS_SYST_CVR:
+		return HostScs_SysTickValue();
+	case SCS_SYST_CALIB:
+		return 0x80000000UL; /* No reference clock */
+	case SCS_NVIC_ISER:
+	case SCS_NVIC_ICER:
+		return g_hostSimNvic.irqEnabled;
+	case SCS_NVIC_ISPR:
+	case SCS_NVIC_ICPR:
+		return HostSim_GetIrqPending();
+	case SCS_SCB_CPUID:
+		return 0x410CC601UL; /* Cortex-M0+ r0p1 */
+	case SCS_SCB_ICSR:
+		{
+			uint32_t pendingVector = 0U;
+			const uint32_t irqs = HostSim_GetIrqPending() & g_hostSimNvic.irqEnabled;
+
+			value = HostSim_GetIpsr();
+			if ( g_hostSimNvic.systemPending & ( 1UL << HOSTSIM_EXCEPTION_SYSTICK ) )
+			{
+				value |= SCS_ICSR_PENDSTSET;
+				pendingVector = HOSTSIM_EXCEPTION_SYSTICK;
+			}
+			if ( g_hostSimNvic.systemPending & ( 1UL << HOSTSIM_EXCEPTION_PENDSV ) )
+			{
+				value |= SCS_ICSR_PENDSVSET;
+				pendingVector = HOSTSIM_EXCEPTION_PENDSV;
+			}
+			if ( irqs )
+			{
+				value |= 1UL << 22; /* ISRPENDING */
+				pendingVector = HOSTSIM_IRQ_EXCEPTION( __builtin_ctz( irqs ) );
+			}
+			return value | ( pendingVector << 12 );
+		}
+	case SCS_SCB_SHPR2:
+		return g_shpr2;
+	case SCS_SCB_SHPR3:
+		return g_shpr3;
+	default:
+		if ( ( offset >= SCS_NVIC_IPR ) && ( offset < SCS_NVIC_IPR + sizeof(g_ipr) ) )
+		{
+			return g_ipr[( offset - SCS_NVIC_IPR ) / 4U];
+		}
+		return HostSim_RawRead( g_scsDevice.base + offset, 4U );
+	}
+}
+
+/**
+ * @brief Writes a 32-bit SCS register.
+ * @param mask - the bytes written, for the byte and halfword accesses.
+ */
+static void HostScs_WriteWord( uint32_t offset, uint32_t value, uint32_t mask )
+{
+	switch ( offset )
+	{
+	case SCS_SYST_CSR:
+		{
+			const bool wasEnabled = ( g_sysTick.csr & SCS_SYST_CSR_ENABLE ) != 0U;
+			const uint32_t current = HostScs_SysTickValue();
+
+			g_sysTick.csr = value & 0x7U;
+			if ( !wasEnabled && ( value & SCS_SYST_CSR_ENABLE ) )
+			{
+				HostScs_SysTickStart( current );
+			}
+			else if ( wasEnabled && !( value & SCS_SYST_CSR_ENABLE ) )
+			{
+				g_sysTick.stopped = current;
+				HostSim_Cancel( HostScs_SysTickWrap, NULL );
+			}
+		}
+		break;
+	case SCS_SYST_RVR:
+		g_sysTick.reload = value & 0xFFFFFFU;
+		break;
+	case SCS_SYST_CVR:
+		/* Any write clears the counter and COUNTFLAG */
+		g_sysTick.countFlag = false;
+		g_sysTick.stopped = 0U;
+		if ( g_sysTick.csr & SCS_SYST_CSR_ENABLE )
+		{
+			HostScs_SysTickStart( 0U );
+		}
+		break;
+	case SCS_NVIC_ISER:
+		g_hostSimNvic.irqEnabled |= value;
+		break;
+	case SCS_NVIC_ICER:
+		g_hostSimNvic.irqEnabled &= ~value;
+		break;
+	case SCS_NVIC_ISPR:
+		g_hostSimNvic.irqPending |= value;
+		break;
+	case SCS_NVIC_ICPR:
+		g_hostSimNvic.irqPending &= ~value;
+		break;
+	case SCS_SCB_ICSR:
+		if ( value & SCS_ICSR_NMIPENDSET )
+		{
+			HostSim_PendException( HOSTSIM_EXCEPTION_NMI );
+		}
+		if ( value & SCS_ICSR_PENDSVSET )
+		{
+			HostSim_PendException( HOSTSIM_EXCEPTION_PENDSV );
+		}
+		if ( value & SCS_ICSR_PENDSVCLR )
+		{
+			g_hostSimNvic.systemPending &= ~( 1UL << HOSTSIM_EXCEPTION_PENDSV );
+		}
+		if ( value & SCS_ICSR_PENDSTSET )
+		{
+			HostSim_PendException( HOSTSIM_EXCEPTION_SYSTICK );
+		}
+		if ( value & SCS_ICSR_PENDSTCLR )
+		{
+			g_hostSimNvic.systemPending &= ~( 1UL << HOSTSIM_EXCEPTION_SYSTICK );
+		}
+		break;
+	case SCS_SCB_AIRCR:
+		if ( ( ( value >> 16 ) == 0x05FAU ) && ( value & ( 1UL << 2 ) ) )
+		{
+			HostSim_Fatal( "system reset requested through AIRCR" );
+		}
+		break;
+	case SCS_SCB_SHPR2:
+		g_shpr2 = ( ( g_shpr2 & ~mask ) | ( value & mask ) ) & 0xC0000000UL;
+		HostScs_UpdatePriorities();
+		break;
+	case SCS_SCB_SHPR3:
+		g_shpr3 = ( ( g_shpr3 & ~mask ) | ( value & mask ) ) & 0xC0C00000UL;
+		HostScs_UpdatePriorities();
+		break;
+	default:
+		if ( ( offset >= SCS_NVIC_IPR ) && ( offset < SCS_NVIC_IPR + sizeof(g_ipr) ) )
+		{
+			uint32_t *ipr = &g_ipr[( offset - SCS_NVIC_IPR ) / 4U];
+
+			*ipr = ( ( *ipr & ~mask ) | ( value & mask ) ) & 0xC0C0C0C0UL;
+			HostScs_UpdatePriorities();
+		}
+		else
+		{
+			HostSim_RawWrite( g_scsDevice.base + offset, value, 4U );
+		}
+		break;
+	}
+}
+
+/**********************************************************************************/
+static uint32_t HostScs_Read( hostSimDevice_t *dev, uint32_t offset, uint32_t width )
+{
+	const uint32_t shift = 8U * ( offset & 3U );
+
+	(void)dev;
+	return (uint32_t)( ( HostScs_ReadWord( offset & ~3U ) >> shift ) & ( ( 1ULL << ( 8U * width ) ) - 1U ) );
+}
+
+/**********************************************************************************/
+static void HostScs_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	const uint32_t shift = 8U * ( offset & 3U );
+	const uint32_t mask = (uint32_t)( ( ( 1ULL << ( 8U * width ) ) - 1U ) << shift );
+
+	(void)dev;
+	HostScs_WriteWord( offset & ~3U, value << shift, mask );
+}
+
+/**********************************************************************************/
+static void HostScs_Reset( hostSimDevice_t *dev )
+{
+	(void)dev;
+	memset( &g_sysTick, 0, sizeof(g_sysTick) );
+	memset( g_ipr, 0, sizeof(g_ipr) );
+	g_shpr2 = g_shpr3 = 0U;
+	HostScs_UpdatePriorities();
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostScs_Register( void )
+{
+	g_scsDevice = (hostSimDevice_t){
+		.name = "SCS", .base = 0xE000E000UL, .size = 0x1000U,
+		.Read = HostScs_Read, .Write = HostScs_Write, .Reset = HostScs_Reset
+	};
+	HostSim_AddDevice( &g_scsDevice );
+}
+
+/*! @}*/
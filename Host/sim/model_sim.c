@@ -0,0 +1,102 @@
+/***************************************************************************************
+ * @file        model_sim.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the System Integration Module (SIM) clock gates and dividers.
+ * @remarks     The registers are plain memory with their reset values. The other
+ *              models read the clock gates and the clock selections from them.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define SIM_ADDRESS(reg) ( (uint32_t)(uintptr_t)&SIM->reg )
+
+static hostSimDevice_t g_simDevice;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void HostSimModule_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	const uint32_t address = dev->base + offset;
+
+	/* Read-only and write-only registers */
+	if ( ( address != SIM_ADDRESS(SOPT1CFG) ) && ( address != SIM_ADDRESS(SDID) ) &&
+		 ( address != SIM_ADDRESS(SRVCOP) ) )
+	{
+		HostSim_RawWrite( address, value, width );
+	}
+}
+
+/**********************************************************************************/
+static void HostSimModule_Reset( hostSimDevice_t *dev )
+{
+	(void)dev;
+	HostSim_RawWrite( SIM_ADDRESS(SDID), 0x00001011UL, 4U );
+	HostSim_RawWrite( SIM_ADDRESS(SCGC4), 0xF0000030UL, 4U );
+	HostSim_RawWrite( SIM_ADDRESS(SCGC5), 0x00000182UL, 4U );
+	HostSim_RawWrite( SIM_ADDRESS(SCGC6), 0x00000001UL, 4U );
+	HostSim_RawWrite( SIM_ADDRESS(SCGC7), 0x00000100UL, 4U );
+	HostSim_RawWrite( SIM_ADDRESS(CLKDIV1), 0x00010000UL, 4U );
+	HostSim_RawWrite( SIM_ADDRESS(COPC), 0x0000000CUL, 4U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+volatile uint32_t *HostSimModule_GetGate( uint32_t index )
+{
+	static const uint32_t gates[] = { SIM_ADDRESS(SCGC4), SIM_ADDRESS(SCGC5), SIM_ADDRESS(SCGC6), SIM_ADDRESS(SCGC7) };
+
+	return (volatile uint32_t*)HostSim_Store( gates[index - 4U] );
+}
+
+/**********************************************************************************/
+uint32_t HostSimModule_GetBusClock( void )
+{
+	const uint32_t clkdiv1 = HostSim_RawRead( SIM_ADDRESS(CLKDIV1), 4U );
+
+	return SystemCoreClock / ( ( ( clkdiv1 & SIM_CLKDIV1_OUTDIV4_MASK ) >> SIM_CLKDIV1_OUTDIV4_SHIFT ) + 1U );
+}
+
+/**********************************************************************************/
+uint32_t HostSimModule_GetAsyncClock( uint32_t select )
+{
+	switch ( select )
+	{
+	case 1U:
+		return SystemCoreClock;     /* MCGFLLCLK */
+	case 2U:
+		return CPU_XTAL_CLK_HZ;     /* OSCERCLK */
+	case 3U:
+		return CPU_INT_SLOW_CLK_HZ; /* MCGIRCLK */
+	default:
+		return 0U;                  /* Clock disabled */
+	}
+}
+
+/**********************************************************************************/
+void HostSimModule_Register( void )
+{
+	g_simDevice = (hostSimDevice_t){
+		.name = "SIM", .base = SIM_BASE, .size = 0x1108U,
+		.Write = HostSimModule_Write, .Reset = HostSimModule_Reset
+	};
+	HostSim_AddDevice( &g_simDevice );
+}
+
+/*! @}*/
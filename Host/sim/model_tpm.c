@@ -0,0 +1,335 @@
+/***************************************************************************************
+ * @file        model_tpm.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the TPM0/TPM1 counters, overflows and channel matches.
+ * @remarks     The counter is computed from the simulated time when it is read and
+ *              events are only scheduled for the overflow and the channel matches.
+ *              Up counting with the internal clock only: the center aligned mode,
+ *              the input capture and the external clock are not modeled.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+#include "host_models.h"
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HOSTTPM_COUNT 2U
+#define HOSTTPM_CHANNELS 6U
+
+/*!< Register offsets. */
+#define HOSTTPM_SC     0x00U
+#define HOSTTPM_CNT    0x04U
+#define HOSTTPM_MOD    0x08U
+#define HOSTTPM_CNSC(n) ( 0x0CU + 8U * (n) )
+#define HOSTTPM_CNV(n)  ( 0x10U + 8U * (n) )
+#define HOSTTPM_STATUS 0x50U
+#define HOSTTPM_CONF   0x84U
+
+/*!
+ * @brief State of a TPM instance.
+ */
+typedef struct
+{
+	hostSimDevice_t device;
+	IRQn_Type irq;
+	uint32_t channels;
+	bool running;
+	uint64_t startTime;  /*!< Time of the last counter restart. */
+	uint32_t startCount; /*!< Counter value at startTime. */
+	uint64_t overflows;
+} hostTpm_t;
+
+static hostTpm_t g_tpms[HOSTTPM_COUNT];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Reads a register from the storage.
+ */
+static inline uint32_t HostTpm_Reg( hostTpm_t *tpm, uint32_t offset )
+{
+	return HostSim_RawRead( tpm->device.base + offset, 4U );
+}
+
+/**
+ * @brief Stores a register.
+ */
+static inline void HostTpm_SetReg( hostTpm_t *tpm, uint32_t offset, uint32_t value )
+{
+	HostSim_RawWrite( tpm->device.base + offset, value, 4U );
+}
+
+/**
+ * @brief Gets the core cycles per count as the fraction cyclesNum / cyclesDen.
+ * @return false if the counter is stopped.
+ */
+static bool HostTpm_GetRate( hostTpm_t *tpm, uint64_t *cyclesNum, uint64_t *cyclesDen )
+{
+	const uint32_t sc = HostTpm_Reg( tpm, HOSTTPM_SC );
+	const uint32_t sopt2 = HostSim_RawRead( (uint32_t)(uintptr_t)&SIM->SOPT2, 4U );
+	const uint32_t clock = HostSimModule_GetAsyncClock( ( sopt2 & SIM_SOPT2_TPMSRC_MASK ) >> SIM_SOPT2_TPMSRC_SHIFT );
+
+	if ( ( ( sc & TPM_SC_CMOD_MASK ) != TPM_SC_CMOD(1U) ) || ( clock == 0U ) )
+	{
+		return false;
+	}
+	*cyclesNum = (uint64_t)SystemCoreClock << ( sc & TPM_SC_PS_MASK );
+	*cyclesDen = clock;
+	return true;
+}
+
+/**
+ * @brief Gets the number of counts since the last restart.
+ */
+static uint64_t HostTpm_Elapsed( hostTpm_t *tpm )
+{
+	uint64_t num, den;
+
+	if ( !tpm->running || !HostTpm_GetRate( tpm, &num, &den ) )
+	{
+		return 0U;
+	}
+	return ( HostSim_GetCycles() - tpm->startTime ) * den / num;
+}
+
+/**
+ * @brief Gets the current counter value.
+ */
+static uint32_t HostTpm_Count( hostTpm_t *tpm )
+{
+	const uint64_t period = ( HostTpm_Reg( tpm, HOSTTPM_MOD ) & 0xFFFFU ) + 1U;
+
+	return (uint32_t)( ( tpm->startCount + HostTpm_Elapsed( tpm ) ) % period );
+}
+
+/**
+ * @brief Updates the interrupt request line.
+ */
+static void HostTpm_UpdateIrq( hostTpm_t *tpm )
+{
+	const uint32_t sc = HostTpm_Reg( tpm, HOSTTPM_SC );
+	bool request = ( sc & TPM_SC_TOIE_MASK ) && ( sc & TPM_SC_TOF_MASK );
+
+	for ( uint32_t n = 0; n < tpm->channels; ++n )
+	{
+		const uint32_t cnsc = HostTpm_Reg( tpm, HOSTTPM_CNSC( n ) );
+
+		request |= ( cnsc & TPM_CnSC_CHIE_MASK ) && ( cnsc & TPM_CnSC_CHF_MASK );
+	}
+	HostSim_SetIrqLine( tpm->irq, request );
+}
+
+/**
+ * @brief Updates STATUS from the flags.
+ */
+static void HostTpm_UpdateStatus( hostTpm_t *tpm )
+{
+	uint32_t status = ( HostTpm_Reg( tpm, HOSTTPM_SC ) & TPM_SC_TOF_MASK ) ? TPM_STATUS_TOF_MASK : 0U;
+
+	for ( uint32_t n = 0; n < tpm->channels; ++n )
+	{
+		if ( HostTpm_Reg( tpm, HOSTTPM_CNSC( n ) ) & TPM_CnSC_CHF_MASK )
+		{
+			status |= 1UL << n;
+		}
+	}
+	HostTpm_SetReg( tpm, HOSTTPM_STATUS, status );
+	HostTpm_UpdateIrq( tpm );
+}
+
+static void HostTpm_Event( void *context );
+
+/**
+ * @brief Schedules the next overflow or channel match.
+ */
+static void HostTpm_Reschedule( hostTpm_t *tpm )
+{
+	const uint32_t period = ( HostTpm_Reg( tpm, HOSTTPM_MOD ) & 0xFFFFU ) + 1U;
+	uint64_t num, den;
+
+	HostSim_Cancel( HostTpm_Event, tpm );
+	if ( !tpm->running || !HostTpm_GetRate( tpm, &num, &den ) )
+	{
+		return;
+	}
+
+	/* The counts to the next interesting value: the wrap to 0 or a channel value */
+	const uint64_t elapsed = HostTpm_Elapsed( tpm );
+	const uint32_t count = (uint32_t)( ( tpm->startCount + elapsed ) % period );
+	uint64_t next = period - count;
+
+	for ( uint32_t n = 0; n < tpm->channels; ++n )
+	{
+		const uint32_t cnsc = HostTpm_Reg( tpm, HOSTTPM_CNSC( n ) );
+		const uint32_t cnv = HostTpm_Reg( tpm, HOSTTPM_CNV( n ) ) & 0xFFFFU;
+
+		if ( ( cnsc & ( TPM_CnSC_MSA_MASK | TPM_CnSC_MSB_MASK ) ) && ( cnv < period ) && ( cnv > count ) &&
+			 ( cnv - count < next ) )
+		{
+			next = cnv - count;
+		}
+	}
+
+	/* The time the counter reaches elapsed + next */
+	const uint64_t target = tpm->startTime + ( ( elapsed + next ) * num + den - 1U ) / den;
+
+	HostSim_Schedule( target - HostSim_GetCycles(), HostTpm_Event, tpm );
+}
+
+/**
+ * @brief The counter reached an overflow or a channel value.
+ */
+static void HostTpm_Event( void *context )
+{
+	hostTpm_t *tpm = context;
+	const uint32_t count = HostTpm_Count( tpm );
+
+	if ( count == 0U )
+	{
+		++tpm->overflows;
+		HostTpm_SetReg( tpm, HOSTTPM_SC, HostTpm_Reg( tpm, HOSTTPM_SC ) | TPM_SC_TOF_MASK );
+	}
+	for ( uint32_t n = 0; n < tpm->channels; ++n )
+	{
+		const uint32_t cnsc = HostTpm_Reg( tpm, HOSTTPM_CNSC( n ) );
+
+		if ( ( cnsc & ( TPM_CnSC_MSA_MASK | TPM_CnSC_MSB_MASK ) ) &&
+			 ( ( HostTpm_Reg( tpm, HOSTTPM_CNV( n ) ) & 0xFFFFU ) == count ) )
+		{
+			HostTpm_SetReg( tpm, HOSTTPM_CNSC( n ), cnsc | TPM_CnSC_CHF_MASK );
+		}
+	}
+	HostTpm_UpdateStatus( tpm );
+	HostTpm_Reschedule( tpm );
+}
+
+/**
+ * @brief Restarts the time base from the current counter value.
+ */
+static void HostTpm_Rebase( hostTpm_t *tpm, uint32_t count )
+{
+	tpm->startCount = count;
+	tpm->startTime = HostSim_GetCycles();
+}
+
+/**********************************************************************************/
+static uint32_t HostTpm_Read( hostSimDevice_t *dev, uint32_t offset, uint32_t width )
+{
+	hostTpm_t *tpm = dev->context;
+
+	if ( offset == HOSTTPM_CNT )
+	{
+		return HostTpm_Count( tpm );
+	}
+	return HostSim_RawRead( dev->base + offset, width );
+}
+
+/**********************************************************************************/
+static void HostTpm_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	hostTpm_t *tpm = dev->context;
+	const uint32_t count = HostTpm_Count( tpm );
+
+	if ( width != 4U )
+	{
+		HostSim_Fatal( "%s register 0x%02x written with a %u byte access", dev->name, offset, width );
+	}
+
+	if ( offset == HOSTTPM_SC )
+	{
+		const uint32_t old = HostTpm_Reg( tpm, offset );
+		uint32_t sc = ( value & ~TPM_SC_TOF_MASK ) | ( old & TPM_SC_TOF_MASK );
+
+		sc &= ~( value & TPM_SC_TOF_MASK ); /* Write 1 to clear */
+		HostTpm_SetReg( tpm, offset, sc );
+		tpm->running = ( sc & TPM_SC_CMOD_MASK ) != 0U;
+		HostTpm_Rebase( tpm, count );
+	}
+	else if ( offset == HOSTTPM_CNT )
+	{
+		HostTpm_Rebase( tpm, 0U ); /* Any write clears the counter */
+	}
+	else if ( offset == HOSTTPM_STATUS )
+	{
+		HostTpm_SetReg( tpm, HOSTTPM_SC, HostTpm_Reg( tpm, HOSTTPM_SC ) & ~( value & TPM_STATUS_TOF_MASK ) );
+		for ( uint32_t n = 0; n < tpm->channels; ++n )
+		{
+			if ( ( value >> n ) & 1U )
+			{
+				HostTpm_SetReg( tpm, HOSTTPM_CNSC( n ), HostTpm_Reg( tpm, HOSTTPM_CNSC( n ) ) & ~TPM_CnSC_CHF_MASK );
+			}
+		}
+	}
+	else if ( ( offset >= HOSTTPM_CNSC( 0 ) ) && ( offset < HOSTTPM_CNSC( tpm->channels ) ) && ( ( offset - HOSTTPM_CNSC( 0 ) ) % 8U == 0U ) )
+	{
+		const uint32_t old = HostTpm_Reg( tpm, offset );
+		uint32_t cnsc = ( value & ~TPM_CnSC_CHF_MASK ) | ( old & TPM_CnSC_CHF_MASK );
+
+		cnsc &= ~( value & TPM_CnSC_CHF_MASK );
+		HostTpm_SetReg( tpm, offset, cnsc );
+	}
+	else
+	{
+		HostTpm_SetReg( tpm, offset, value );
+	}
+
+	HostTpm_UpdateStatus( tpm );
+	HostTpm_Reschedule( tpm );
+}
+
+/**********************************************************************************/
+static void HostTpm_Reset( hostSimDevice_t *dev )
+{
+	hostTpm_t *tpm = dev->context;
+
+	tpm->running = false;
+	tpm->startTime = 0U;
+	tpm->startCount = 0U;
+	tpm->overflows = 0U;
+	HostTpm_SetReg( tpm, HOSTTPM_MOD, 0xFFFFU );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+uint64_t HostTpm_GetOverflowCount( uint32_t instance )
+{
+	return g_tpms[instance].overflows;
+}
+
+/**********************************************************************************/
+void HostTpm_Register( void )
+{
+	static const char *const names[HOSTTPM_COUNT] = { "TPM0", "TPM1" };
+	static const uint32_t bases[HOSTTPM_COUNT] = { TPM0_BASE, TPM1_BASE };
+	static const uint32_t gates[HOSTTPM_COUNT] = { SIM_SCGC6_TPM0_MASK, SIM_SCGC6_TPM1_MASK };
+	static const IRQn_Type irqs[HOSTTPM_COUNT] = { TPM0_IRQn, TPM1_IRQn };
+	static const uint32_t channels[HOSTTPM_COUNT] = { 6U, 2U };
+
+	for ( uint32_t i = 0; i < HOSTTPM_COUNT; ++i )
+	{
+		g_tpms[i].irq = irqs[i];
+		g_tpms[i].channels = channels[i];
+		g_tpms[i].device = (hostSimDevice_t){
+			.name = names[i], .base = bases[i], .size = sizeof(TPM_Type),
+			.gateMask = gates[i], .gateRegister = HostSimModule_GetGate( 6U ),
+			.Read = HostTpm_Read, .Write = HostTpm_Write, .Reset = HostTpm_Reset, .context = &g_tpms[i]
+		};
+		HostSim_AddDevice( &g_tpms[i].device );
+	}
+}
+
+/*! @}*/
@@ -0,0 +1,373 @@
+/***************************************************************************************
+ * @file        model_uart0.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Model of the UART0 transmitter and receiver at the frame level.
+ * @remarks     A frame takes (start + data + parity + stop bits) x (OSR + 1) x SBR
+ *              UART clocks. The transmitted bytes are captured for the tests and the
+ *              injected ones are received one frame apart, with TDRE/RDRF requesting
+ *              the DMA when enabled in C5. The line errors (noise,
+ *              framing, parity) and the LIN/match address features are not modeled.
+ * @author      agent
+ ***************************************************************************************/
+
+#include "host_sim_core.h"
+#include "host_models.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*!
+ * @addtogroup host simulator
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Register offsets. */
+#define HOSTUART_BDH 0x0U
+#define HOSTUART_BDL 0x1U
+#define HOSTUART_C1  0x2U
+#define HOSTUART_C2  0x3U
+#define HOSTUART_S1  0x4U
+#define HOSTUART_C3  0x6U
+#define HOSTUART_D   0x7U
+#define HOSTUART_C4  0xAU
+#define HOSTUART_C5  0xBU
+
+/*!< DMAMUX sources of the receiver and the transmitter. */
+#define HOSTUART_DMA_RX_SOURCE 2U
+#define HOSTUART_DMA_TX_SOURCE 3U
+
+/*!< Flags of S1 cleared by writing 1 to them. */
+#define HOSTUART_S1_W1C ( UART0_S1_OR_MASK | UART0_S1_NF_MASK | UART0_S1_FE_MASK | UART0_S1_PF_MASK | UART0_S1_IDLE_MASK )
+
+/*!
+ * @brief State of the UART0 model.
+ */
+typedef struct
+{
+	uint8_t s1;           /*!< Status flags. */
+	uint8_t txData;       /*!< Transmit data register, valid while TDRE is 0. */
+	uint8_t rxData;       /*!< Receive data register. */
+	bool txShifting;      /*!< The transmit shifter is busy. */
+	uint8_t txShifter;    /*!< Byte in the transmit shifter. */
+	uint8_t *txCapture;   /*!< Bytes sent on the line. */
+	size_t txCount;
+	size_t txCapacity;
+	uint8_t *rxQueue;     /*!< Bytes waiting to arrive on the line. */
+	size_t rxHead;
+	size_t rxCount;
+	size_t rxCapacity;
+	uint32_t overruns;
+} hostUart_t;
+
+static hostUart_t g_uart;
+static hostSimDevice_t g_uartDevice;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Reads a register from the storage.
+ */
+static inline uint8_t HostUart0_Reg( uint32_t offset )
+{
+	return (uint8_t)HostSim_RawRead( UART0_BASE + offset, 1U );
+}
+
+/**
+ * @brief Updates the interrupt request line and the DMA requests. With
+ *        C5[TDMAE/RDMAE] set, TDRE/RDRF request the DMA instead of the interrupt.
+ */
+static void HostUart0_UpdateIrq( void )
+{
+	const uint8_t c2 = HostUart0_Reg( HOSTUART_C2 );
+	const uint8_t c3 = HostUart0_Reg( HOSTUART_C3 );
+	const uint8_t c5 = HostUart0_Reg( HOSTUART_C5 );
+	const uint8_t s1 = g_uart.s1;
+	const bool txRequest = ( c2 & UART0_C2_TIE_MASK ) && ( s1 & UART0_S1_TDRE_MASK );
+	const bool rxRequest = ( c2 & UART0_C2_RIE_MASK ) && ( s1 & UART0_S1_RDRF_MASK );
+	bool request = false;
+
+	request |= txRequest && !( c5 & UART0_C5_TDMAE_MASK );
+	request |= ( c2 & UART0_C2_TCIE_MASK ) && ( s1 & UART0_S1_TC_MASK );
+	request |= rxRequest && !( c5 & UART0_C5_RDMAE_MASK );
+	request |= ( c2 & UART0_C2_ILIE_MASK ) && ( s1 & UART0_S1_IDLE_MASK );
+	request |= ( c3 & UART0_C3_ORIE_MASK ) && ( s1 & UART0_S1_OR_MASK );
+	request |= ( c3 & UART0_C3_NEIE_MASK ) && ( s1 & UART0_S1_NF_MASK );
+	request |= ( c3 & UART0_C3_FEIE_MASK ) && ( s1 & UART0_S1_FE_MASK );
+	request |= ( c3 & UART0_C3_PEIE_MASK ) && ( s1 & UART0_S1_PF_MASK );
+	HostSim_SetIrqLine( UART0_IRQn, request );
+	HostDma_SetRequest( HOSTUART_DMA_TX_SOURCE, txRequest && ( c5 & UART0_C5_TDMAE_MASK ) );
+	HostDma_SetRequest( HOSTUART_DMA_RX_SOURCE, rxRequest && ( c5 & UART0_C5_RDMAE_MASK ) );
+}
+
+/**
+ * @brief Gets the frame duration in core cycles, 0 if the baud rate generator
+ *        or its clock are off.
+ */
+static uint64_t HostUart0_FrameCycles( void )
+{
+	const uint32_t sopt2 = HostSim_RawRead( (uint32_t)(uintptr_t)&SIM->SOPT2, 4U );
+	const uint32_t clock = HostSimModule_GetAsyncClock( ( sopt2 & SIM_SOPT2_UART0SRC_MASK ) >> SIM_SOPT2_UART0SRC_SHIFT );
+	const uint8_t bdh = HostUart0_Reg( HOSTUART_BDH );
+	const uint8_t c1 = HostUart0_Reg( HOSTUART_C1 );
+	const uint32_t sbr = ( (uint32_t)( bdh & UART0_BDH_SBR_MASK ) << 8 ) | HostUart0_Reg( HOSTUART_BDL );
+	const uint32_t osr = ( HostUart0_Reg( HOSTUART_C4 ) & UART0_C4_OSR_MASK ) + 1U;
+	uint32_t bits = 10U;
+
+	if ( ( clock == 0U ) || ( sbr == 0U ) )
+	{
+		return 0U;
+	}
+	bits += ( c1 & UART0_C1_M_MASK ) ? 1U : 0U;
+	bits += ( c1 & UART0_C1_PE_MASK ) ? 1U : 0U;
+	bits += ( bdh & UART0_BDH_SBNS_MASK ) ? 1U : 0U;
+
+	return ( (uint64_t)bits * osr * sbr * SystemCoreClock + clock - 1U ) / clock;
+}
+
+/**
+ * @brief Appends a byte to a growing buffer.
+ */
+static void HostUart0_Append( uint8_t **buffer, size_t *count, size_t *capacity, uint8_t data )
+{
+	if ( *count == *capacity )
+	{
+		*capacity = ( *capacity != 0U ) ? *capacity * 2U : 256U;
+		*buffer = realloc( *buffer, *capacity );
+		if ( *buffer == NULL )
+		{
+			HostSim_Fatal( "out of memory" );
+		}
+	}
+	( *buffer )[( *count )++] = data;
+}
+
+static void HostUart0_TxDone( void *context );
+
+/**
+ * @brief Loads the transmit shifter from the data register.
+ */
+static void HostUart0_StartTx( void )
+{
+	const uint64_t frame = HostUart0_FrameCycles();
+
+	if ( frame == 0U )
+	{
+		HostSim_Fatal( "UART0 transmits with the baud rate generator or its clock off" );
+	}
+	g_uart.txShifter = g_uart.txData;
+	g_uart.txShifting = true;
+	g_uart.s1 |= UART0_S1_TDRE_MASK;
+	HostSim_Schedule( frame, HostUart0_TxDone, NULL );
+}
+
+/**
+ * @brief End of a transmitted frame.
+ */
+static void HostUart0_TxDone( void *context )
+{
+	(void)context;
+	HostUart0_Append( &g_uart.txCapture, &g_uart.txCount, &g_uart.txCapacity, g_uart.txShifter );
+	g_uart.txShifting = false;
+	if ( !( g_uart.s1 & UART0_S1_TDRE_MASK ) && ( HostUart0_Reg( HOSTUART_C2 ) & UART0_C2_TE_MASK ) )
+	{
+		HostUart0_StartTx();
+	}
+	else
+	{
+		g_uart.s1 |= UART0_S1_TC_MASK;
+	}
+	HostUart0_UpdateIrq();
+}
+
+/**
+ * @brief End of a received frame.
+ */
+static void HostUart0_RxDone( void *context )
+{
+	const uint8_t data = g_uart.rxQueue[g_uart.rxHead++];
+
+	(void)context;
+	--g_uart.rxCount;
+	if ( HostUart0_Reg( HOSTUART_C2 ) & UART0_C2_RE_MASK )
+	{
+		if ( g_uart.s1 & UART0_S1_RDRF_MASK )
+		{
+			g_uart.s1 |= UART0_S1_OR_MASK; /* The new byte is lost */
+			++g_uart.overruns;
+		}
+		else
+		{
+			g_uart.rxData = data;
+			g_uart.s1 |= UART0_S1_RDRF_MASK;
+		}
+	}
+	if ( g_uart.rxCount != 0U )
+	{
+		HostSim_Schedule( HostUart0_FrameCycles(), HostUart0_RxDone, NULL );
+	}
+	else
+	{
+		g_uart.rxHead = 0U;
+	}
+	HostUart0_UpdateIrq();
+}
+
+/**********************************************************************************/
+static uint32_t HostUart0_Read( hostSimDevice_t *dev, uint32_t offset, uint32_t width )
+{
+	uint32_t value = 0U;
+
+	(void)dev;
+	for ( uint32_t i = 0; i < width; ++i )
+	{
+		const uint32_t reg = offset + i;
+		uint8_t byte;
+
+		if ( reg == HOSTUART_S1 )
+		{
+			byte = g_uart.s1;
+		}
+		else if ( reg == HOSTUART_D )
+		{
+			byte = g_uart.rxData;
+			g_uart.s1 &= ~UART0_S1_RDRF_MASK;
+			HostUart0_UpdateIrq();
+		}
+		else
+		{
+			byte = HostUart0_Reg( reg );
+		}
+		value |= (uint32_t)byte << ( i * 8U );
+	}
+	return value;
+}
+
+/**********************************************************************************/
+static void HostUart0_Write( hostSimDevice_t *dev, uint32_t offset, uint32_t value, uint32_t width )
+{
+	(void)dev;
+	for ( uint32_t i = 0; i < width; ++i )
+	{
+		const uint32_t reg = offset + i;
+		const uint8_t byte = (uint8_t)( value >> ( i * 8U ) );
+
+		if ( reg == HOSTUART_S1 )
+		{
+			g_uart.s1 &= ~( byte & HOSTUART_S1_W1C );
+		}
+		else if ( reg == HOSTUART_D )
+		{
+			if ( !( HostUart0_Reg( HOSTUART_C2 ) & UART0_C2_TE_MASK ) )
+			{
+				continue; /* The transmitter is off */
+			}
+			g_uart.txData = byte;
+			g_uart.s1 &= ~( UART0_S1_TDRE_MASK | UART0_S1_TC_MASK );
+			if ( !g_uart.txShifting )
+			{
+				HostUart0_StartTx();
+			}
+		}
+		else
+		{
+			HostSim_RawWrite( UART0_BASE + reg, byte, 1U );
+		}
+	}
+	HostUart0_UpdateIrq();
+}
+
+/**********************************************************************************/
+static void HostUart0_Reset( hostSimDevice_t *dev )
+{
+	(void)dev;
+	g_uart.s1 = UART0_S1_TDRE_MASK | UART0_S1_TC_MASK;
+	g_uart.txData = g_uart.rxData = 0U;
+	g_uart.txShifting = false;
+	g_uart.txCount = 0U;
+	g_uart.rxHead = g_uart.rxCount = 0U;
+	g_uart.overruns = 0U;
+	HostSim_RawWrite( UART0_BASE + HOSTUART_BDL, 0x04U, 1U );
+	HostSim_RawWrite( UART0_BASE + HOSTUART_C4, 0x0FU, 1U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void HostUart0_Inject( const uint8_t *data, size_t length )
+{
+	const bool idle = ( g_uart.rxCount == 0U );
+
+	if ( idle )
+	{
+		g_uart.rxHead = 0U;
+	}
+	for ( size_t i = 0; i < length; ++i )
+	{
+		size_t end = g_uart.rxHead + g_uart.rxCount;
+
+		HostUart0_Append( &g_uart.rxQueue, &end, &g_uart.rxCapacity, data[i] );
+		++g_uart.rxCount;
+	}
+	if ( idle && ( length != 0U ) )
+	{
+		const uint64_t frame = HostUart0_FrameCycles();
+
+		if ( frame == 0U )
+		{
+			HostSim_Fatal( "UART0 receives with the baud rate generator or its clock off" );
+		}
+		HostSim_Schedule( frame, HostUart0_RxDone, NULL );
+	}
+}
+
+/**********************************************************************************/
+const uint8_t *HostUart0_GetTxData( void )
+{
+	return g_uart.txCapture;
+}
+
+/**********************************************************************************/
+size_t HostUart0_GetTxCount( void )
+{
+	return g_uart.txCount;
+}
+
+/**********************************************************************************/
+void HostUart0_ClearTx( void )
+{
+	g_uart.txCount = 0U;
+}
+
+/**********************************************************************************/
+uint32_t HostUart0_GetOverrunCount( void )
+{
+	return g_uart.overruns;
+}
+
+/**********************************************************************************/
+uint64_t HostUart0_GetFrameCycles( void )
+{
+	return HostUart0_FrameCycles();
+}
+
+/**********************************************************************************/
+void HostUart0_Register( void )
+{
+	g_uartDevice = (hostSimDevice_t){
+		.name = "UART0", .base = UART0_BASE, .size = sizeof(UART0_Type),
+		.gateMask = SIM_SCGC4_UART0_MASK, .gateRegister = HostSimModule_GetGate( 4U ),
+		.Read = HostUart0_Read, .Write = HostUart0_Write, .Reset = HostUart0_Reset
+	};
+	HostSim_AddDevice( &g_uartDevice );
+}
+
+/*! @}*/
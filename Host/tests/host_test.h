@@ -0,0 +1,59 @@
+/***************************************************************************************
+ * @file        host_test.h
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Minimal check macros of the host tests.
+ * @remarks     A test program runs its cases with HOST_TEST_RUN and returns
+ *              HOST_TEST_RESULT() from main, so ctest sees the failures.
+ * @author      agent
+ ***************************************************************************************/
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_sim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Failed checks of the program. */
+static unsigned g_hostTestFailures;
+
+/*!< Checks a condition, reports it and goes on. */
+#define HOST_TEST_CHECK( condition ) \
+	do { \
+		if ( !( condition ) ) { \
+			++g_hostTestFailures; \
+			fprintf( stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition ); \
+		} \
+	} while ( 0 )
+
+/*!< Checks two integers for equality, printing both on failure. */
+#define HOST_TEST_EQUAL( actual, expected ) \
+	do { \
+		const long long hostTestA = (long long)( actual ); \
+		const long long hostTestE = (long long)( expected ); \
+		if ( hostTestA != hostTestE ) { \
+			++g_hostTestFailures; \
+			fprintf( stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, \
+					hostTestA, hostTestE ); \
+		} \
+	} while ( 0 )
+
+/*!< Runs a test case on a freshly reset simulator. */
+#define HOST_TEST_RUN( test ) \
+	do { \
+		const unsigned hostTestBefore = g_hostTestFailures; \
+		HostSim_Init(); \
+		test(); \
+		printf( "%-50s %s\n", #test, ( g_hostTestFailures == hostTestBefore ) ? "ok" : "FAILED" ); \
+	} while ( 0 )
+
+/*!< Exit status of the program. */
+#define HOST_TEST_RESULT() ( ( g_hostTestFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE )
+
+#endif /* HOST_TEST_H_ */
@@ -0,0 +1,249 @@
+/***************************************************************************************
+ * @file        test_decimal.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Fuzz test of the base 10 conversions of Libraries/util and
+ *              Libraries/printf, which share Util_DecToStrReversed.
+ * @remarks     Util_IntToStr is compared with the digit loop it had before the digit
+ *              pair table, kept here as the reference. snprintf_ is compared with the
+ *              glibc snprintf on random integers, widths, precisions and flags.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/printf/printf.h>
+#include <Libraries/util/string.h>
+
+#include "host_test.h"
+
+/* The glibc functions, hidden by the macros of printf.h */
+#undef snprintf
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_VALUES 200000U
+#define TEST_FORMATS 100000U
+
+static uint64_t g_random = 0x2545F4914F6CDD1DULL;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static uint64_t Random( void )
+{
+	g_random ^= g_random << 13;
+	g_random ^= g_random >> 7;
+	g_random ^= g_random << 17;
+	return g_random;
+}
+
+/**
+ * @brief A random value with a uniformly distributed number of bits.
+ */
+static uint64_t RandomValue( void )
+{
+	return Random() >> ( Random() % 64U );
+}
+
+/**
+ * @brief Util_IntToStr before the digit pair table: one division per digit.
+ */
+static int ReferenceIntToStr( int32_t num, uint8_t *str, uint8_t base )
+{
+	int i = 0;
+	bool isNegative = false;
+
+	if ( num == 0 )
+	{
+		str[i++] = '0';
+		str[i] = '\0';
+		return i;
+	}
+	if ( num < 0 && base == 10 )
+	{
+		isNegative = true;
+		num = -num;
+	}
+	while ( num != 0 )
+	{
+		int rem = num % base;
+		str[i++] = ( rem > 9 ) ? ( rem - 10 ) + 'A' : rem + '0';
+		num = num / base;
+	}
+	if ( isNegative )
+	{
+		str[i++] = '-';
+	}
+	str[i] = '\0';
+	Util_ReverseStr( str, i );
+	return i;
+}
+
+/**********************************************************************************/
+static void TestDecToStrReversed( void )
+{
+	uint8_t str[16];
+
+	HOST_TEST_EQUAL( Util_DecToStrReversed( str, 0U, 1U ), 1U );
+	HOST_TEST_EQUAL( str[0], '0' );
+	HOST_TEST_EQUAL( Util_DecToStrReversed( str, 4294967295U, 1U ), 10U );
+	HOST_TEST_CHECK( memcmp( str, "5927694924", 10U ) == 0 );
+	HOST_TEST_EQUAL( Util_DecToStrReversed( str, 42U, 5U ), 5U );
+	HOST_TEST_CHECK( memcmp( str, "24000", 5U ) == 0 );
+
+	/* Every value below 10^5 and then random ones, against the division loop */
+	for ( uint64_t i = 0; i < 100000U + TEST_VALUES; ++i )
+	{
+		const uint32_t value = ( i < 100000U ) ? (uint32_t)i : (uint32_t)RandomValue();
+		uint32_t rest = value;
+		size_t digits = Util_DecToStrReversed( str, value, 1U );
+		size_t j = 0;
+
+		do
+		{
+			if ( str[j++] != '0' + rest % 10U )
+			{
+				break;
+			}
+			rest /= 10U;
+		} while ( rest != 0U );
+		HOST_TEST_CHECK( ( rest == 0U ) && ( j == digits ) );
+	}
+}
+
+/**********************************************************************************/
+static void TestIntToStr( void )
+{
+	static const uint8_t bases[] = { 2U, 8U, 10U, 16U };
+	uint8_t expected[40];
+	uint8_t str[40];
+
+	for ( unsigned i = 0; i < TEST_VALUES; ++i )
+	{
+		/* INT32_MIN is left out: the reference overflows on it */
+		int32_t value = (int32_t)RandomValue();
+		const uint8_t base = bases[i % sizeof(bases)];
+
+		if ( value == INT32_MIN )
+		{
+			continue;
+		}
+		if ( Random() & 1U )
+		{
+			value = -value;
+		}
+		HOST_TEST_EQUAL( Util_IntToStr( value, str, base ), ReferenceIntToStr( value, expected, base ) );
+		HOST_TEST_CHECK( strcmp( (const char*)str, (const char*)expected ) == 0 );
+	}
+
+	HOST_TEST_EQUAL( Util_IntToStr( INT32_MIN, str, 10U ), 11 );
+	HOST_TEST_CHECK( strcmp( (const char*)str, "-2147483648" ) == 0 );
+}
+
+/**
+ * @brief Builds a random integer conversion, as "%+08.3lld".
+ * @note The precision is not combined with the '-' flag: snprintf_ has always
+ *       ignored it there, unlike glibc.
+ */
+static void RandomFormat( char *format, char length, char conversion )
+{
+	static const char flags[] = "-+ 0";
+	bool left = false;
+
+	*format++ = '%';
+	for ( unsigned i = 0; i < 4U; ++i )
+	{
+		if ( Random() % 4U == 0U )
+		{
+			left |= ( flags[i] == '-' );
+			*format++ = flags[i];
+		}
+	}
+	if ( Random() & 1U )
+	{
+		format += sprintf( format, "%u", (unsigned)( Random() % 24U ) );
+	}
+	if ( !left && ( Random() % 4U == 0U ) )
+	{
+		format += sprintf( format, ".%u", (unsigned)( Random() % 24U ) );
+	}
+	if ( length == 'L' )
+	{
+		*format++ = 'l';
+		*format++ = 'l';
+	}
+	else if ( length != '\0' )
+	{
+		*format++ = length;
+	}
+	*format++ = conversion;
+	*format = '\0';
+}
+
+/**********************************************************************************/
+static void TestSnprintf( void )
+{
+	char format[32];
+	char expected[64];
+	char str[64];
+	unsigned failures = 0U;
+
+	for ( unsigned i = 0; i < TEST_FORMATS; ++i )
+	{
+		const uint64_t value = RandomValue();
+		const bool negative = Random() & 1U;
+
+		switch ( i % 4U )
+		{
+			case 0:
+				RandomFormat( format, '\0', ( i & 4U ) ? 'i' : 'd' );
+				snprintf( expected, sizeof(expected), format, negative ? -(int)value : (int)value );
+				snprintf_( str, sizeof(str), format, negative ? -(int)value : (int)value );
+				break;
+			case 1:
+				RandomFormat( format, '\0', 'u' );
+				snprintf( expected, sizeof(expected), format, (unsigned)value );
+				snprintf_( str, sizeof(str), format, (unsigned)value );
+				break;
+			case 2:
+				RandomFormat( format, 'l', ( i & 4U ) ? 'u' : 'd' );
+				snprintf( expected, sizeof(expected), format, negative ? -(long)value : (long)value );
+				snprintf_( str, sizeof(str), format, negative ? -(long)value : (long)value );
+				break;
+			default:
+				RandomFormat( format, 'L', ( i & 4U ) ? 'u' : 'd' );
+				snprintf( expected, sizeof(expected), format, negative ? -(long long)value : (long long)value );
+				snprintf_( str, sizeof(str), format, negative ? -(long long)value : (long long)value );
+				break;
+		}
+		if ( strcmp( expected, str ) != 0 )
+		{
+			if ( failures++ < 10U )
+			{
+				printf( "  \"%s\": glibc \"%s\", snprintf_ \"%s\"\n", format, expected, str );
+			}
+		}
+	}
+	HOST_TEST_EQUAL( failures, 0U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HOST_TEST_RUN( TestDecToStrReversed );
+	HOST_TEST_RUN( TestIntToStr );
+	HOST_TEST_RUN( TestSnprintf );
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,273 @@
+/***************************************************************************************
+ * @file        test_display.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the display HAL primitives and of their command batching on
+ *              the ILI9320 and ILI9341 drivers.
+ * @remarks     Built once per controller: test_display_ili9341 links its own
+ *              display_ili9341.c built with DISPLAY_USE_ILI9341. The controller is
+ *              the TFT LCD model of host_devices.h, from which each primitive is
+ *              checked pixel by pixel and its bus bytes and window commands are
+ *              counted: a window, then 2 bytes per pixel.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <common.h>
+#include <Libraries/display/display.h>
+#ifdef DISPLAY_USE_ILI9341
+#include <Libraries/display/drivers/display_ili9341.h>
+#include <Libraries/ili9341/tftlcd_ili9341.h>
+#else
+#include <Libraries/display/drivers/display_ili9320.h>
+#include <Libraries/ili9320/ili9320.h>
+#endif
+
+#include "host_devices.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifdef DISPLAY_USE_ILI9341
+#define TEST_CONTROLLER HOSTTFTLCD_ILI9341
+#define TEST_DRIVER g_displayIli9341Driver
+/*!< A window: 2Ah and 2Bh with 4 parameters each, and 2Ch. */
+#define TEST_WINDOW_BYTES 11U
+#define TEST_WINDOW_COMMANDS 2U
+#else
+#define TEST_CONTROLLER HOSTTFTLCD_ILI9320
+#define TEST_DRIVER g_displayIli9320Driver
+/*!< A window: R50h..R53h, R20h and R21h with a 2-byte index and value each, and the R22h index. */
+#define TEST_WINDOW_BYTES 26U
+#define TEST_WINDOW_COMMANDS 6U
+#endif
+
+/*!< Bus pins of the boards: data and DC, CS on PTA, data, WR and RD on PTB. */
+#define TEST_PTA_PINS ( ( 1UL << 0 ) | ( 1UL << 8 ) | ( 1UL << 10 ) | ( 1UL << 11 ) | ( 1UL << 12 ) )
+#define TEST_PTB_PINS ( ( 1UL << 5 ) | ( 1UL << 6 ) | ( 1UL << 7 ) | ( 1UL << 8 ) | ( 1UL << 9 ) | \
+		( 1UL << 10 ) | ( 1UL << 11 ) )
+
+#define TEST_BACKGROUND 0x0000U
+#define TEST_RED 0xF800U
+#define TEST_WHITE 0xFFFFU
+
+static hostTftLcd_t g_lcd;
+static displayHandle_t g_display;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Configures the bus pins with the controller selected, as its driver
+ *        leaves them.
+ */
+static void BusInit( void )
+{
+	GPIOA->PSOR = ( 1UL << 0 ) | ( 1UL << 8 );
+	GPIOB->PSOR = ( 1UL << 8 ) | ( 1UL << 9 );
+	GPIOA->PDDR |= TEST_PTA_PINS;
+	GPIOB->PDDR |= TEST_PTB_PINS;
+	GPIOA->PCOR = 1UL << 0;
+}
+
+/**
+ * @brief Starts a test case: the pins of the reset simulator, a black screen,
+ *        cleared counters and the write position forgotten.
+ */
+static void TestStart( void )
+{
+	BusInit();
+	for ( uint16_t row = 0; row < HOSTTFTLCD_GRAM_HEIGHT; ++row )
+	{
+		for ( uint16_t column = 0; column < HOSTTFTLCD_GRAM_WIDTH; ++column )
+		{
+			g_lcd.gram[row][column] = TEST_BACKGROUND;
+		}
+	}
+	g_lcd.stats = (hostTftLcdStats_t){ 0 };
+	Display_Invalidate( g_display );
+}
+
+/**
+ * @brief Tells if the pixels of a rectangle have a color, and the ones around it
+ *        the background.
+ */
+static bool CheckRect( uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color )
+{
+	for ( uint16_t py = ( y > 0U ) ? y - 1U : 0U; ( py <= y + h ) && ( py < TEST_DRIVER.height ); ++py )
+	{
+		for ( uint16_t px = ( x > 0U ) ? x - 1U : 0U; ( px <= x + w ) && ( px < TEST_DRIVER.width ); ++px )
+		{
+			const bool inside = ( px >= x ) && ( px < x + w ) && ( py >= y ) && ( py < y + h );
+
+			if ( HostTftLcd_GetPixel( &g_lcd, px, py ) != ( inside ? color : TEST_BACKGROUND ) )
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Prints the bus traffic of a primitive.
+ */
+static void PrintTraffic( const char *primitive, uint32_t pixels )
+{
+	printf( "  %-28s %6llu bus bytes for %5u pixels, %llu window commands\n", primitive,
+			(unsigned long long)g_lcd.stats.bytes, pixels, (unsigned long long)g_lcd.stats.windowCommands );
+}
+
+/**********************************************************************************/
+static void TestFillRect( void )
+{
+	TestStart();
+
+	Display_FillRect( g_display, 20, 30, 50, 40, TEST_RED );
+	PrintTraffic( "FillRect 50x40", 2000U );
+	HOST_TEST_CHECK( CheckRect( 20U, 30U, 50U, 40U, TEST_RED ) );
+	HOST_TEST_EQUAL( g_lcd.stats.bytes, TEST_WINDOW_BYTES + 2U * 2000U );
+	HOST_TEST_EQUAL( g_lcd.stats.windowCommands, TEST_WINDOW_COMMANDS );
+	HOST_TEST_EQUAL( g_lcd.stats.violations, 0U );
+}
+
+/**********************************************************************************/
+static void TestFillRectClipped( void )
+{
+	TestStart();
+
+	/* Only the 10x10 corner inside the display is written */
+	Display_FillRect( g_display, -10, -10, 20, 20, TEST_WHITE );
+	PrintTraffic( "FillRect clipped to 10x10", 100U );
+	HOST_TEST_CHECK( CheckRect( 0U, 0U, 10U, 10U, TEST_WHITE ) );
+	HOST_TEST_EQUAL( g_lcd.stats.bytes, TEST_WINDOW_BYTES + 2U * 100U );
+}
+
+/**********************************************************************************/
+static void TestStackedRects( void )
+{
+	TestStart();
+
+	/* Same columns, right below: one memory write */
+	Display_FillRect( g_display, 40, 10, 30, 20, TEST_RED );
+	Display_FillRect( g_display, 40, 30, 30, 20, TEST_WHITE );
+	PrintTraffic( "2 stacked FillRect 30x20", 1200U );
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 40U, 10U ), TEST_RED );
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 69U, 29U ), TEST_RED );
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 40U, 30U ), TEST_WHITE );
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 69U, 49U ), TEST_WHITE );
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 70U, 10U ), TEST_BACKGROUND );
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 40U, 50U ), TEST_BACKGROUND );
+	HOST_TEST_EQUAL( g_lcd.stats.bytes, TEST_WINDOW_BYTES + 2U * 1200U );
+	HOST_TEST_EQUAL( g_lcd.stats.windowCommands, TEST_WINDOW_COMMANDS );
+
+	/* Other columns: a new window */
+	g_lcd.stats = (hostTftLcdStats_t){ 0 };
+	Display_FillRect( g_display, 41, 50, 30, 1, TEST_RED );
+	HOST_TEST_EQUAL( g_lcd.stats.windowCommands, TEST_WINDOW_COMMANDS );
+}
+
+/**********************************************************************************/
+static void TestPixelColumn( void )
+{
+	const uint16_t color = TEST_RED;
+
+	TestStart();
+
+	/* A vertical line drawn pixel by pixel is one memory write */
+	for ( uint16_t y = 5; y < 105U; ++y )
+	{
+		Display_SetWindow( g_display, 7U, y, 1U, 1U );
+		Display_WritePixels( g_display, &color, 1U );
+	}
+	PrintTraffic( "100 pixels of a column", 100U );
+	HOST_TEST_CHECK( CheckRect( 7U, 5U, 1U, 100U, TEST_RED ) );
+	HOST_TEST_EQUAL( g_lcd.stats.bytes, TEST_WINDOW_BYTES + 2U * 100U );
+	HOST_TEST_EQUAL( g_lcd.stats.memoryWrites, 1U );
+}
+
+/**********************************************************************************/
+static void TestBlit( void )
+{
+	uint16_t image[6][8];
+
+	TestStart();
+	for ( uint16_t y = 0; y < 6U; ++y )
+	{
+		for ( uint16_t x = 0; x < 8U; ++x )
+		{
+			image[y][x] = (uint16_t)( ( x << 11 ) | ( y << 5 ) | 0x0001U );
+		}
+	}
+
+	Display_Blit( g_display, 100U, 60U, 8U, 6U, &image[0][0] );
+	PrintTraffic( "Blit 8x6", 48U );
+	for ( uint16_t y = 0; y < 6U; ++y )
+	{
+		for ( uint16_t x = 0; x < 8U; ++x )
+		{
+			HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 100U + x, 60U + y ), image[y][x] );
+		}
+	}
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 108U, 60U ), TEST_BACKGROUND );
+	HOST_TEST_EQUAL( g_lcd.stats.bytes, TEST_WINDOW_BYTES + 2U * 48U );
+	HOST_TEST_EQUAL( g_lcd.stats.violations, 0U );
+}
+
+/**********************************************************************************/
+static void TestScrollArea( void )
+{
+	TestStart();
+
+	const uint8_t status = Display_ScrollArea( g_display, 20U, 200U, 10U );
+
+	PrintTraffic( "ScrollArea", 0U );
+	if ( TEST_DRIVER.ScrollArea == NULL )
+	{
+		HOST_TEST_EQUAL( status, SYSTEM_STATUS_FAIL );
+		HOST_TEST_EQUAL( g_lcd.stats.bytes, 0U );
+		return;
+	}
+	HOST_TEST_EQUAL( status, SYSTEM_STATUS_SUCCESS );
+	/* 33h with 6 parameters and 37h with 2 */
+	HOST_TEST_EQUAL( g_lcd.stats.bytes, 10U );
+
+	/* The scroll commands end the memory write: the next fill sends its window */
+	g_lcd.stats = (hostTftLcdStats_t){ 0 };
+	Display_FillRect( g_display, 0, 0, 4, 4, TEST_RED );
+	HOST_TEST_EQUAL( g_lcd.stats.windowCommands, TEST_WINDOW_COMMANDS );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	/* Once: the GPIO listeners, the controller registers and the handle survive the simulator resets */
+	HostSim_Init();
+	Delay_Init();
+	HostTftLcd_AttachGpio( &g_lcd );
+	BusInit();
+	HostTftLcd_Init( &g_lcd, TEST_CONTROLLER );
+#ifdef DISPLAY_USE_ILI9341
+	tftLcd_Init();
+	tftLcd_Begin();
+#else
+	ili9320_Init();
+#endif
+	g_display = Display_Init( &TEST_DRIVER );
+	HOST_TEST_CHECK( g_display != NULL );
+
+	HOST_TEST_RUN( TestFillRect );
+	HOST_TEST_RUN( TestFillRectClipped );
+	HOST_TEST_RUN( TestStackedRects );
+	HOST_TEST_RUN( TestPixelColumn );
+	HOST_TEST_RUN( TestBlit );
+	HOST_TEST_RUN( TestScrollArea );
+
+	return HOST_TEST_RESULT();
+}
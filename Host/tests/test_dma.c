@@ -0,0 +1,301 @@
+/***************************************************************************************
+ * @file        test_dma.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the DMA driver and of its UART0/ADC0 adapters on the simulated
+ *              DMA controller: the bytes and samples arrive complete and in order.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/adc/adc.h>
+#include <Drivers/dma/dma.h>
+#include <Drivers/dma/dma_stream.h>
+#include <Drivers/uart/uart0.h>
+
+#include "host_models.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_TX_CHANNEL 0U
+#define TEST_RX_CHANNEL 1U
+#define TEST_ADC_CHANNEL 2U
+
+#define TEST_LENGTH 1000U
+#define TEST_ADC_EVENTS 6U
+
+static uint8_t g_message[TEST_LENGTH];
+static uint8_t g_received[TEST_LENGTH];
+
+static uint32_t g_adcLevel;
+static dmaEvent_t g_adcEvents[TEST_ADC_EVENTS];
+static uint16_t g_adcSamples[TEST_ADC_EVENTS * DMA_ADC0_BUFFER_SAMPLES / 2U];
+static volatile uint32_t g_adcEventCount;
+static volatile dmaEvent_t g_lastEvent;
+static volatile uint32_t g_errorCount;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void InitUart( void )
+{
+	for ( size_t i = 0; i < sizeof(g_message); ++i )
+	{
+		g_message[i] = (uint8_t)( i * 13U + ( i >> 8 ) );
+	}
+	UART0_SetClkSrc( UART0_CLOCK_FLL );
+	UART0_Init( 115200U, UART0_TX_RX_ENABLE, UART0_NO_PARITY, UART0_ONE_STOP_BIT );
+	DMA_Init();
+}
+
+/**********************************************************************************/
+static uint16_t AdcRamp( uint32_t channel, void *context )
+{
+	(void)channel;
+	(void)context;
+	return (uint16_t)( g_adcLevel++ << 4 );
+}
+
+/**********************************************************************************/
+static void AdcCallback( uint8_t channel, dmaEvent_t event, void *arg )
+{
+	(void)channel;
+	(void)arg;
+	if ( g_adcEventCount < TEST_ADC_EVENTS )
+	{
+		g_adcEvents[g_adcEventCount] = event;
+		memcpy( &g_adcSamples[g_adcEventCount * DMA_ADC0_BUFFER_SAMPLES / 2U], DMA_Adc0GetSamples( event ),
+				DMA_ADC0_BUFFER_SAMPLES / 2U * sizeof(uint16_t) );
+		++g_adcEventCount;
+	}
+}
+
+/**********************************************************************************/
+static void RecordEvent( uint8_t channel, dmaEvent_t event, void *arg )
+{
+	(void)channel;
+	(void)arg;
+	g_lastEvent = event;
+	if ( event == DMA_EVENT_ERROR )
+	{
+		++g_errorCount;
+	}
+}
+
+/**********************************************************************************/
+static void TestUartTx( void )
+{
+	size_t sent = 0U;
+
+	InitUart();
+	DMA_Uart0TxInit( TEST_TX_CHANNEL );
+
+	while ( sent < sizeof(g_message) )
+	{
+		sent += DMA_Uart0WriteBlock( &g_message[sent], sizeof(g_message) - sent );
+		if ( sent < sizeof(g_message) )
+		{
+			__WFI();
+		}
+	}
+	while ( DMA_Uart0GetTxFree() != DMA_UART0_TX_BUFFER_SIZE )
+	{
+		__WFI();
+	}
+	HostSim_Advance( 2U * HostUart0_GetFrameCycles() );
+
+	HOST_TEST_EQUAL( HostUart0_GetTxCount(), sizeof(g_message) );
+	HOST_TEST_CHECK( memcmp( HostUart0_GetTxData(), g_message, sizeof(g_message) ) == 0 );
+	HOST_TEST_EQUAL( HostDma_GetElementCount( TEST_TX_CHANNEL ), sizeof(g_message) );
+	/* One interrupt per contiguous block of the ring, not per byte */
+	HOST_TEST_CHECK( HostSim_GetExceptionCount() <= 2U * sizeof(g_message) / DMA_UART0_TX_BUFFER_SIZE + 2U );
+}
+
+/**********************************************************************************/
+static void TestUartRx( void )
+{
+	size_t count = 0U;
+
+	InitUart();
+	DMA_Uart0RxInit( TEST_RX_CHANNEL );
+
+	HostUart0_Inject( g_message, sizeof(g_message) );
+	while ( count < sizeof(g_message) )
+	{
+		count += DMA_Uart0ReadBlock( &g_received[count], sizeof(g_message) - count );
+	}
+
+	HOST_TEST_CHECK( memcmp( g_received, g_message, sizeof(g_message) ) == 0 );
+	HOST_TEST_EQUAL( HostDma_GetElementCount( TEST_RX_CHANNEL ), sizeof(g_message) );
+	HOST_TEST_EQUAL( HostUart0_GetOverrunCount(), 0U );
+	HOST_TEST_EQUAL( DMA_Uart0GetRxCount(), 0U );
+}
+
+/**********************************************************************************/
+static void TestUartTxRequestAfterEnd( void )
+{
+	/* The controller takes 32-bit addresses: static storage, not the host stack */
+	static uint8_t block[4] = { 'a', 'b', 'c', 'd' };
+
+	InitUart();
+	g_errorCount = 0U;
+	DMA_InitChannel( TEST_TX_CHANNEL, DMA_SOURCE_UART0_TX, RecordEvent, NULL );
+	UART0->C5 |= UART0_C5_TDMAE_MASK;
+	UART0->C2 |= UART0_C2_TIE_MASK;
+
+	/* TDRE keeps requesting after the last byte: the requests must be disabled */
+	HOST_TEST_EQUAL( DMA_StartTransfer( TEST_TX_CHANNEL, DMA_MEMORY_TO_PERIPHERAL, &UART0->D, block,
+			sizeof(block), DMA_TRANSFER_SIZE_8BIT ), SYSTEM_STATUS_SUCCESS );
+	HostSim_Advance( 8U * HostUart0_GetFrameCycles() );
+
+	HOST_TEST_EQUAL( HostUart0_GetTxCount(), sizeof(block) );
+	HOST_TEST_EQUAL( g_lastEvent, DMA_EVENT_FULL_COMPLETE );
+	HOST_TEST_EQUAL( g_errorCount, 0U );
+	HOST_TEST_CHECK( !( DMA0->DMA[TEST_TX_CHANNEL].DSR_BCR & DMA_DSR_BCR_CE_MASK ) );
+}
+
+/**********************************************************************************/
+static void TestUartRxFullAndOverrun( void )
+{
+	InitUart();
+	DMA_Uart0RxInit( TEST_RX_CHANNEL );
+
+	/* A full buffer is not an empty one */
+	HostUart0_Inject( g_message, DMA_UART0_RX_BUFFER_SIZE );
+	HostSim_Advance( ( DMA_UART0_RX_BUFFER_SIZE + 2U ) * HostUart0_GetFrameCycles() );
+	HOST_TEST_EQUAL( DMA_Uart0GetRxCount(), DMA_UART0_RX_BUFFER_SIZE );
+	HOST_TEST_CHECK( !DMA_Uart0GetRxOverrun() );
+	HOST_TEST_EQUAL( DMA_Uart0ReadBlock( g_received, sizeof(g_received) ), DMA_UART0_RX_BUFFER_SIZE );
+	HOST_TEST_CHECK( memcmp( g_received, g_message, DMA_UART0_RX_BUFFER_SIZE ) == 0 );
+
+	/* More than the buffer without reading: the loss is reported, then reading goes on */
+	HostUart0_Inject( g_message, DMA_UART0_RX_BUFFER_SIZE + 10U );
+	HostSim_Advance( ( DMA_UART0_RX_BUFFER_SIZE + 12U ) * HostUart0_GetFrameCycles() );
+	HOST_TEST_EQUAL( DMA_Uart0GetRxCount(), 0U );
+	HOST_TEST_CHECK( DMA_Uart0GetRxOverrun() );
+	HOST_TEST_CHECK( !DMA_Uart0GetRxOverrun() );
+
+	HostUart0_Inject( g_message, 3U );
+	HostSim_Advance( 5U * HostUart0_GetFrameCycles() );
+	HOST_TEST_EQUAL( DMA_Uart0ReadBlock( g_received, sizeof(g_received) ), 3U );
+	HOST_TEST_CHECK( memcmp( g_received, g_message, 3U ) == 0 );
+}
+
+/**********************************************************************************/
+static void TestAdcDoubleBuffer( void )
+{
+	g_adcLevel = 0U;
+	g_adcEventCount = 0U;
+	HostAdc_SetInput( AdcRamp, NULL );
+
+	ADC_Init( ADC0 );
+	ADC_SetResolution( ADC0, ADC_RESOLUTION_12_BIT );
+	ADC_EnableContinuousConversion( ADC0 );
+	DMA_Init();
+	DMA_Adc0Init( TEST_ADC_CHANNEL, AdcCallback, NULL );
+	ADC_SetChConfig( ADC0, 3U, false );
+
+	while ( g_adcEventCount < TEST_ADC_EVENTS )
+	{
+		__WFI();
+	}
+	ADC_DisableContinuousConversion( ADC0 );
+	DMA_StopChannel( TEST_ADC_CHANNEL );
+
+	/* The samples not read were written over */
+	HOST_TEST_CHECK( DMA_Adc0GetOverrun() );
+
+	for ( uint32_t i = 0; i < TEST_ADC_EVENTS; ++i )
+	{
+		HOST_TEST_EQUAL( g_adcEvents[i], ( i % 2U ) ? DMA_EVENT_FULL_COMPLETE : DMA_EVENT_HALF_COMPLETE );
+	}
+	for ( uint32_t i = 0; i < sizeof(g_adcSamples) / sizeof(g_adcSamples[0]); ++i )
+	{
+		HOST_TEST_EQUAL( g_adcSamples[i], i );
+	}
+}
+
+/**********************************************************************************/
+static void TestAdcWholeSamples( void )
+{
+	uint8_t bytes[3];
+
+	g_adcLevel = 0U;
+	g_adcEventCount = 0U;
+	HostAdc_SetInput( AdcRamp, NULL );
+
+	ADC_Init( ADC0 );
+	ADC_SetResolution( ADC0, ADC_RESOLUTION_12_BIT );
+	ADC_EnableContinuousConversion( ADC0 );
+	DMA_Init();
+	DMA_Adc0Init( TEST_ADC_CHANNEL, AdcCallback, NULL );
+	ADC_SetChConfig( ADC0, 3U, false );
+
+	while ( g_adcEventCount < 1U )
+	{
+		__WFI();
+	}
+	ADC_DisableContinuousConversion( ADC0 );
+	DMA_StopChannel( TEST_ADC_CHANNEL );
+
+	/* 3 bytes asked: only the first sample, never half of the second one */
+	HOST_TEST_CHECK( DMA_Adc0GetBytesToRead() >= DMA_ADC0_BUFFER_SAMPLES );
+	HOST_TEST_EQUAL( DMA_Adc0ReadBlock( bytes, sizeof(bytes) ), 2U );
+	HOST_TEST_EQUAL( bytes[0] | ( bytes[1] << 8 ), 0U );
+	HOST_TEST_EQUAL( DMA_Adc0ReadBlock( bytes, sizeof(bytes) ), 2U );
+	HOST_TEST_EQUAL( bytes[0] | ( bytes[1] << 8 ), 1U );
+	HOST_TEST_CHECK( !DMA_Adc0GetOverrun() );
+}
+
+/**********************************************************************************/
+static void TestConfigurationError( void )
+{
+	/* The controller takes 32-bit addresses: static storage, not the host stack */
+	static volatile uint32_t source = 0x1234U;
+	static uint16_t buffer[4];
+	static uint8_t odd[3];
+
+	g_lastEvent = DMA_EVENT_FULL_COMPLETE;
+	DMA_Init();
+	DMA_InitChannel( 3U, DMA_SOURCE_ALWAYS_ENABLED, RecordEvent, NULL );
+
+	/* 16-bit accesses with an odd byte count */
+	HOST_TEST_EQUAL( DMA_StartTransfer( 3U, DMA_PERIPHERAL_TO_MEMORY, &source, odd, sizeof(odd),
+			DMA_TRANSFER_SIZE_16BIT ), SYSTEM_STATUS_SUCCESS );
+	HostSim_Advance( 100U );
+	HOST_TEST_EQUAL( g_lastEvent, DMA_EVENT_ERROR );
+	HOST_TEST_EQUAL( HostDma_GetElementCount( 3U ), 0U );
+
+	/* Peripheral to memory on the always enabled source */
+	HOST_TEST_EQUAL( DMA_StartTransfer( 3U, DMA_PERIPHERAL_TO_MEMORY, &source, buffer, sizeof(buffer),
+			DMA_TRANSFER_SIZE_16BIT ), SYSTEM_STATUS_SUCCESS );
+	HostSim_Advance( 100U );
+	HOST_TEST_EQUAL( g_lastEvent, DMA_EVENT_FULL_COMPLETE );
+	HOST_TEST_EQUAL( HostDma_GetElementCount( 3U ), 4U );
+	HOST_TEST_EQUAL( buffer[3], 0x1234U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HOST_TEST_RUN( TestUartTx );
+	HOST_TEST_RUN( TestUartRx );
+	HOST_TEST_RUN( TestUartTxRequestAfterEnd );
+	HOST_TEST_RUN( TestUartRxFullAndOverrun );
+	HOST_TEST_RUN( TestAdcDoubleBuffer );
+	HOST_TEST_RUN( TestAdcWholeSamples );
+	HOST_TEST_RUN( TestConfigurationError );
+
+	return HOST_TEST_RESULT();
+}
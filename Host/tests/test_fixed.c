@@ -0,0 +1,126 @@
+/***************************************************************************************
+ * @file        test_fixed.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the fixed-point (Q format) conversions: %k and %hk of
+ *              snprintf_ and Util_FixedToStr.
+ * @remarks     The output is compared with the exact value of the Q number rounded
+ *              half away from zero, computed here on the whole scaled value.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/printf/printf.h>
+#include <Libraries/util/string.h>
+
+#include "host_test.h"
+
+#undef snprintf
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_VALUES 200000U
+
+static uint64_t g_random = 0x9E3779B97F4A7C15ULL;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static uint64_t Random( void )
+{
+	g_random ^= g_random << 13;
+	g_random ^= g_random >> 7;
+	g_random ^= g_random << 17;
+	return g_random;
+}
+
+/**
+ * @brief The exact value of a Q number with the given digits after the point,
+ *        rounded half away from zero.
+ */
+static void ReferenceFixed( char *str, size_t size, int32_t value, unsigned fracBits, unsigned digits )
+{
+	static const uint64_t pow10[] = { 1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U,
+			100000000U, 1000000000U };
+	const uint64_t mag = ( value < 0 ) ? -(int64_t)value : value;
+	const unsigned __int128 scaled = ( (unsigned __int128)mag * pow10[digits] * 2U + ( 1ULL << fracBits ) )
+			>> ( fracBits + 1U );
+	const uint64_t whole = (uint64_t)( scaled / pow10[digits] );
+	const uint64_t frac = (uint64_t)( scaled % pow10[digits] );
+
+	if ( digits == 0U )
+	{
+		snprintf( str, size, "%s%llu", ( value < 0 ) ? "-" : "", (unsigned long long)whole );
+	}
+	else
+	{
+		snprintf( str, size, "%s%llu.%0*llu", ( value < 0 ) ? "-" : "", (unsigned long long)whole, (int)digits,
+				(unsigned long long)frac );
+	}
+}
+
+/**********************************************************************************/
+static void TestPrintf( void )
+{
+	char expected[40];
+	char str[40];
+
+	for ( unsigned i = 0; i < TEST_VALUES; ++i )
+	{
+		const int32_t value = (int32_t)( Random() >> ( 32U + Random() % 32U ) ) * ( ( i & 1U ) ? -1 : 1 );
+		const unsigned digits = i % 10U;
+		const bool q824 = i & 2U;
+
+		ReferenceFixed( expected, sizeof(expected), value, q824 ? 24U : 16U, digits );
+		snprintf_( str, sizeof(str), q824 ? "%.*hk" : "%.*k", digits, value );
+		HOST_TEST_CHECK( strcmp( str, expected ) == 0 );
+	}
+
+	/* Default precision, width and flags as %f */
+	snprintf_( str, sizeof(str), "%k", 0x00018000 );
+	HOST_TEST_CHECK( strcmp( str, "1.500000" ) == 0 );
+	snprintf_( str, sizeof(str), "[%+09.2k]", 0x00018000 );
+	HOST_TEST_CHECK( strcmp( str, "[+00001.50]" ) == 0 );
+	snprintf_( str, sizeof(str), "[%-7.1hk]", -0x01400000 );
+	HOST_TEST_CHECK( strcmp( str, "[-1.3   ]" ) == 0 );
+}
+
+/**********************************************************************************/
+static void TestUtil( void )
+{
+	char expected[UTIL_FIXED_STR_MAX_LEN];
+	uint8_t str[UTIL_FIXED_STR_MAX_LEN];
+
+	for ( unsigned i = 0; i < TEST_VALUES; ++i )
+	{
+		const int32_t value = (int32_t)Random();
+		const uint8_t fracBits = (uint8_t)( Random() % 32U );
+		const int digits = (int)( i % 10U );
+
+		ReferenceFixed( expected, sizeof(expected), value, fracBits, (unsigned)digits );
+		HOST_TEST_EQUAL( Util_FixedToStr( value, fracBits, str, digits ), (int)strlen( expected ) );
+		HOST_TEST_CHECK( strcmp( (const char*)str, expected ) == 0 );
+	}
+	HOST_TEST_EQUAL( Util_FixedToStr( INT32_MIN, 0U, str, 9 ), 21 );
+	HOST_TEST_CHECK( strcmp( (const char*)str, "-2147483648.000000000" ) == 0 );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HOST_TEST_RUN( TestPrintf );
+	HOST_TEST_RUN( TestUtil );
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,218 @@
+/***************************************************************************************
+ * @file        test_host_sim.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Smoke tests of the host build: the unmodified drivers and FreeRTOS
+ *              running against the simulated KL05.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/gpio/gpio.h>
+#include <Drivers/port/port.h>
+#include <Drivers/uart/uart0.h>
+#include <Libraries/delay/delay.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+
+#include "host_models.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+static uint32_t g_listenerCalls, g_listenerPins;
+static volatile uint32_t g_sysTicks;
+static volatile uint32_t g_portIrqs;
+static QueueHandle_t g_queue;
+static uint32_t g_received[5];
+static uint32_t g_receivedCount;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void Listener( uint32_t port, uint32_t pins, uint32_t changed, void *context )
+{
+	(void)port;
+	(void)changed;
+	(void)context;
+	++g_listenerCalls;
+	g_listenerPins = pins;
+}
+
+/**********************************************************************************/
+static void CountingSysTick( void )
+{
+	++g_sysTicks;
+}
+
+/**********************************************************************************/
+static void PortBHandler( void )
+{
+	++g_portIrqs;
+	PORT_ClearIRQFlag( PORTB, 5U );
+}
+
+/**********************************************************************************/
+static void TestGpio( void )
+{
+	g_listenerCalls = 0U;
+	HostGpio_AddListener( HOSTSIM_PORT_B, Listener, NULL );
+
+	GPIO_InitOutputPin( GPIOB, 8U, 0U );
+	GPIO_SetPin( GPIOB, 8U );
+	HOST_TEST_CHECK( HostGpio_GetPins( HOSTSIM_PORT_B ) & ( 1UL << 8 ) );
+	HOST_TEST_CHECK( g_listenerPins & ( 1UL << 8 ) );
+	GPIO_ClearPin( GPIOB, 8U );
+	HOST_TEST_CHECK( !( g_listenerPins & ( 1UL << 8 ) ) );
+	HOST_TEST_EQUAL( g_listenerCalls, 2U );
+
+	GPIO_InitInputPin( GPIOB, 3U );
+	HostGpio_SetInputs( HOSTSIM_PORT_B, 1UL << 3, 1UL << 3 );
+	HOST_TEST_EQUAL( GPIO_ReadPin( GPIOB, 3U ), 1U );
+	HostGpio_SetInputs( HOSTSIM_PORT_B, 1UL << 3, 0U );
+	HOST_TEST_EQUAL( GPIO_ReadPin( GPIOB, 3U ), 0U );
+	HOST_TEST_EQUAL( g_listenerCalls, 2U );
+}
+
+/**********************************************************************************/
+static void TestPortInterrupt( void )
+{
+	g_portIrqs = 0U;
+	HostSim_SetHandler( HOSTSIM_IRQ_EXCEPTION(PORTB_IRQn), PortBHandler );
+
+	PORT_Init( PORTB );
+	PORT_SetMux( PORTB, 5U, PORT_MUX_ALT1 );
+	PORT_EnableIRQ( PORTB, 5U, PORT_IRQ_ON_RISING_EDGE );
+	NVIC_EnableIRQ( PORTB_IRQn );
+	GPIO_InitInputPin( GPIOB, 5U );
+
+	HostGpio_SetInputs( HOSTSIM_PORT_B, 1UL << 5, 1UL << 5 );
+	HostSim_Advance( 10U );
+	HOST_TEST_EQUAL( g_portIrqs, 1U );
+	HostGpio_SetInputs( HOSTSIM_PORT_B, 1UL << 5, 0U );
+	HostSim_Advance( 10U );
+	HOST_TEST_EQUAL( g_portIrqs, 1U );
+}
+
+/**********************************************************************************/
+static void TestUartPolled( void )
+{
+	static const char message[] = "hello";
+	uint8_t received[3];
+
+	UART0_SetClkSrc( UART0_CLOCK_FLL );
+	UART0_Init( 115200U, UART0_TX_RX_ENABLE, UART0_NO_PARITY, UART0_ONE_STOP_BIT );
+
+	const uint64_t start = HostSim_GetCycles();
+
+	for ( size_t i = 0; i < sizeof(message) - 1U; ++i )
+	{
+		while ( !UART0_IsTxAvailable() ) {}
+		UART0_Write( (uint8_t)message[i] );
+	}
+	while ( !( UART0->S1 & UART0_S1_TC_MASK ) ) {}
+
+	HOST_TEST_EQUAL( HostUart0_GetTxCount(), 5U );
+	HOST_TEST_CHECK( memcmp( HostUart0_GetTxData(), message, 5U ) == 0 );
+	/* 5 frames back to back, 10 bits at about 115200 bit/s */
+	HOST_TEST_CHECK( HostSim_GetCycles() - start >= 5U * HostUart0_GetFrameCycles() );
+	HOST_TEST_CHECK( HostSim_GetCycles() - start < 6U * HostUart0_GetFrameCycles() );
+
+	HostUart0_Inject( (const uint8_t*)"abc", 3U );
+	for ( size_t i = 0; i < 3U; ++i )
+	{
+		while ( !UART0_IsRxAvailable() ) {}
+		received[i] = UART0_Read();
+	}
+	HOST_TEST_CHECK( memcmp( received, "abc", 3U ) == 0 );
+	HOST_TEST_EQUAL( HostUart0_GetOverrunCount(), 0U );
+}
+
+/**********************************************************************************/
+static void TestSysTick( void )
+{
+	g_sysTicks = 0U;
+	HostSim_SetHandler( HOSTSIM_IRQ_EXCEPTION(SysTick_IRQn), CountingSysTick );
+	SysTick_Config( SystemCoreClock / 1000U );
+
+	Delay_Init();
+	Delay_Waitms( 10U );
+	HOST_TEST_EQUAL( g_sysTicks, 10U );
+
+	/* WFI sleeps until the next tick */
+	const uint64_t idle = HostSim_GetIdleCycles();
+
+	__WFI();
+	HOST_TEST_EQUAL( g_sysTicks, 11U );
+	HOST_TEST_CHECK( HostSim_GetIdleCycles() > idle );
+	SysTick->CTRL = 0U;
+}
+
+/**********************************************************************************/
+static void Producer( void *parameters )
+{
+	(void)parameters;
+	for ( uint32_t i = 0; i < 5U; ++i )
+	{
+		vTaskDelay( 1U );
+		xQueueSend( g_queue, &i, portMAX_DELAY );
+	}
+	for ( ;; )
+	{
+		vTaskDelay( 100U );
+	}
+}
+
+/**********************************************************************************/
+static void Consumer( void *parameters )
+{
+	(void)parameters;
+	while ( g_receivedCount < 5U )
+	{
+		xQueueReceive( g_queue, &g_received[g_receivedCount], portMAX_DELAY );
+		++g_receivedCount;
+	}
+	vTaskEndScheduler();
+}
+
+/**********************************************************************************/
+static void TestRtos( void )
+{
+	g_queue = xQueueCreate( 2U, sizeof(uint32_t) );
+	xTaskCreate( Producer, "producer", configMINIMAL_STACK_SIZE, NULL, 1U, NULL );
+	xTaskCreate( Consumer, "consumer", configMINIMAL_STACK_SIZE, NULL, 2U, NULL );
+	vTaskStartScheduler();
+
+	HOST_TEST_EQUAL( g_receivedCount, 5U );
+	for ( uint32_t i = 0; i < 5U; ++i )
+	{
+		HOST_TEST_EQUAL( g_received[i], i );
+	}
+	/* One tick per item, the ticks are 1 ms */
+	HOST_TEST_CHECK( HostSim_GetSeconds() >= 0.004 );
+	HOST_TEST_CHECK( HostSim_GetSeconds() < 0.010 );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HOST_TEST_RUN( TestGpio );
+	HOST_TEST_RUN( TestPortInterrupt );
+	HOST_TEST_RUN( TestUartPolled );
+	HOST_TEST_RUN( TestSysTick );
+	/* The scheduler runs once per program: FreeRTOS can not be restarted */
+	HOST_TEST_RUN( TestRtos );
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,208 @@
+/***************************************************************************************
+ * @file        test_i2c.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the interrupt-driven transaction engine of the I2C driver on
+ *              a simulated register-file slave.
+ * @remarks     Covers the blocking helpers, the queue of I2C_Submit with completion
+ *              callbacks, the polled path with the interrupts masked and the errors.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/i2c/i2c.h>
+
+#include "host_devices.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_SLAVE_ADDRESS 0x48U
+#define TEST_ABSENT_ADDRESS 0x21U
+#define TEST_QUEUED 3U
+
+static hostRegisterFile_t g_file;
+
+static i2cTransaction_t g_queued[TEST_QUEUED];
+static uint8_t g_queuedData[TEST_QUEUED][4];
+static uint8_t g_order[TEST_QUEUED + 1U];
+static volatile uint32_t g_completed;
+static i2cTransaction_t g_chained;
+static uint8_t g_chainedData[2];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void InitBus( void )
+{
+	HostI2c_RemoveSlaves();
+	HostRegisterFile_Init( &g_file, TEST_SLAVE_ADDRESS );
+	HOST_TEST_EQUAL( I2C_Init_400kbps( I2C0 ), SYSTEM_STATUS_SUCCESS );
+	HostI2c_ClearStats();
+}
+
+/**********************************************************************************/
+static void RecordCompletion( i2cTransaction_t *transaction )
+{
+	g_order[g_completed++] = (uint8_t)(uintptr_t)transaction->arg;
+}
+
+/**********************************************************************************/
+static void ChainSubmit( i2cTransaction_t *transaction )
+{
+	RecordCompletion( transaction );
+	g_chained = (i2cTransaction_t){
+		.slave_addr = TEST_SLAVE_ADDRESS, .use_register = true, .register_addr = 0x80U,
+		.tx_data = g_chainedData, .tx_size = sizeof(g_chainedData),
+		.callback = RecordCompletion, .arg = (void*)(uintptr_t)TEST_QUEUED
+	};
+	HOST_TEST_EQUAL( I2C_Submit( I2C0, &g_chained ), SYSTEM_STATUS_SUCCESS );
+}
+
+/**********************************************************************************/
+static void TestRegisterChunks( void )
+{
+	const uint8_t data[] = { 0x11U, 0x22U, 0x33U, 0x44U, 0x55U };
+	uint8_t read[sizeof(data)] = { 0 };
+	uint8_t *result = read;
+
+	InitBus();
+
+	HOST_TEST_EQUAL( I2C_WriteRegisterChunk( I2C0, TEST_SLAVE_ADDRESS, 0x10U, data, sizeof(data) ),
+			SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_CHECK( memcmp( &g_file.registers[0x10], data, sizeof(data) ) == 0 );
+
+	HOST_TEST_EQUAL( I2C_ReadRegisterChunk( I2C0, TEST_SLAVE_ADDRESS, 0x10U, &result, sizeof(read) ),
+			SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_CHECK( memcmp( read, data, sizeof(data) ) == 0 );
+
+	/* Write, then register write and repeated START read */
+	HOST_TEST_EQUAL( HostI2c_GetStats()->starts, 2U );
+	HOST_TEST_EQUAL( HostI2c_GetStats()->repeatedStarts, 1U );
+	HOST_TEST_EQUAL( HostI2c_GetStats()->stops, 2U );
+}
+
+/**********************************************************************************/
+static void TestQueuedSubmit( void )
+{
+	InitBus();
+	g_completed = 0U;
+
+	const uint64_t cycles = HostSim_GetCycles();
+	const uint64_t idle = HostSim_GetIdleCycles();
+
+	for ( uint32_t i = 0; i < TEST_QUEUED; ++i )
+	{
+		memset( g_queuedData[i], (int)( 0xA0U + i ), sizeof(g_queuedData[i]) );
+		/* Uninitialized memory may read as BUSY: I2C_Submit sets the status itself */
+		g_queued[i] = (i2cTransaction_t){
+			.slave_addr = TEST_SLAVE_ADDRESS, .use_register = true, .register_addr = (uint8_t)( 0x20U + 4U * i ),
+			.tx_data = g_queuedData[i], .tx_size = sizeof(g_queuedData[i]),
+			.callback = RecordCompletion, .arg = (void*)(uintptr_t)i, .status = SYSTEM_STATUS_BUSY
+		};
+		HOST_TEST_EQUAL( I2C_Submit( I2C0, &g_queued[i] ), SYSTEM_STATUS_SUCCESS );
+	}
+	/* Already queued */
+	HOST_TEST_EQUAL( I2C_Submit( I2C0, &g_queued[TEST_QUEUED - 1U] ), SYSTEM_STATUS_BUSY );
+
+	while ( g_completed < TEST_QUEUED )
+	{
+		__WFI();
+	}
+
+	for ( uint32_t i = 0; i < TEST_QUEUED; ++i )
+	{
+		HOST_TEST_EQUAL( g_order[i], i );
+		HOST_TEST_EQUAL( g_queued[i].status, SYSTEM_STATUS_SUCCESS );
+		HOST_TEST_CHECK( memcmp( &g_file.registers[0x20U + 4U * i], g_queuedData[i], 4U ) == 0 );
+	}
+	HOST_TEST_EQUAL( HostI2c_GetStats()->starts, TEST_QUEUED );
+	HOST_TEST_EQUAL( HostI2c_GetStats()->stops, TEST_QUEUED );
+	/* The CPU sleeps between the bus events, the STOP of each transaction included */
+	printf( "  %u queued transactions, CPU idle %.1f%%\n", TEST_QUEUED,
+			100.0 * (double)( HostSim_GetIdleCycles() - idle ) / (double)( HostSim_GetCycles() - cycles ) );
+	HOST_TEST_CHECK( HostSim_GetIdleCycles() - idle > ( HostSim_GetCycles() - cycles ) / 2U );
+}
+
+/**********************************************************************************/
+static void TestChainedSubmit( void )
+{
+	InitBus();
+	g_completed = 0U;
+	g_chainedData[0] = 0x5AU;
+	g_chainedData[1] = 0xA5U;
+
+	g_queued[0] = (i2cTransaction_t){
+		.slave_addr = TEST_SLAVE_ADDRESS, .use_register = true, .register_addr = 0x40U,
+		.tx_data = g_queuedData[0], .tx_size = 1U, .callback = ChainSubmit, .arg = (void*)0
+	};
+	HOST_TEST_EQUAL( I2C_Submit( I2C0, &g_queued[0] ), SYSTEM_STATUS_SUCCESS );
+
+	while ( g_completed < 2U )
+	{
+		__WFI();
+	}
+	HOST_TEST_EQUAL( g_order[1], TEST_QUEUED );
+	HOST_TEST_EQUAL( g_chained.status, SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( g_file.registers[0x80], 0x5AU );
+	HOST_TEST_EQUAL( g_file.registers[0x81], 0xA5U );
+	HOST_TEST_EQUAL( HostI2c_GetStats()->starts, 2U );
+}
+
+/**********************************************************************************/
+static void TestPolledExecute( void )
+{
+	uint8_t value = 0U;
+
+	InitBus();
+	g_file.registers[0x33] = 0xC3U;
+
+	/* I2C0_IRQHandler can not run: the engine is run by I2C_Execute */
+	__disable_irq();
+	HOST_TEST_EQUAL( I2C_WriteRegister( I2C0, TEST_SLAVE_ADDRESS, 0x32U, 0x3CU ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( I2C_ReadRegister( I2C0, TEST_SLAVE_ADDRESS, 0x33U, &value ), SYSTEM_STATUS_SUCCESS );
+	/* The queue critical sections restore PRIMASK, they do not enable the interrupts */
+	HOST_TEST_CHECK( __get_PRIMASK() != 0U );
+	__enable_irq();
+
+	HOST_TEST_EQUAL( g_file.registers[0x32], 0x3CU );
+	HOST_TEST_EQUAL( value, 0xC3U );
+}
+
+/**********************************************************************************/
+static void TestAbsentSlave( void )
+{
+	uint8_t value;
+
+	InitBus();
+
+	HOST_TEST_EQUAL( I2C_WriteSlave( I2C0, TEST_ABSENT_ADDRESS, 0x00U ), SYSTEM_STATUS_INVALID_ADDRESS );
+	HOST_TEST_EQUAL( I2C_ReadSlave( I2C0, TEST_ABSENT_ADDRESS, &value ), SYSTEM_STATUS_INVALID_ADDRESS );
+	HOST_TEST_EQUAL( HostI2c_GetStats()->stops, 2U );
+
+	/* The bus is usable again */
+	HOST_TEST_EQUAL( I2C_WriteRegister( I2C0, TEST_SLAVE_ADDRESS, 0x01U, 0x77U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( g_file.registers[0x01], 0x77U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HOST_TEST_RUN( TestRegisterChunks );
+	HOST_TEST_RUN( TestQueuedSubmit );
+	HOST_TEST_RUN( TestChainedSubmit );
+	HOST_TEST_RUN( TestPolledExecute );
+	HOST_TEST_RUN( TestAbsentSlave );
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,163 @@
+/***************************************************************************************
+ * @file        test_i2c_baud.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the baud rate solver of the I2C driver over the matrix of the
+ *              core clocks, bus clock dividers and requested baud rates.
+ * @remarks     The selected rate is compared with an exhaustive search over the SCL
+ *              divider table of the reference manual, and the SCL period of the
+ *              simulated module is checked against it.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <common.h>
+#include <Drivers/i2c/i2c.h>
+
+#include "host_models.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< SCL divider of the I2C_F[ICR] values, KL05 reference manual table 36-41. */
+static const uint16_t _dividers[64] = {
+	20U, 22U, 24U, 26U, 28U, 30U, 34U, 40U,
+	28U, 32U, 36U, 40U, 44U, 48U, 56U, 68U,
+	48U, 56U, 64U, 72U, 80U, 88U, 104U, 128U,
+	80U, 96U, 112U, 128U, 144U, 160U, 192U, 240U,
+	160U, 192U, 224U, 256U, 288U, 320U, 384U, 480U,
+	320U, 384U, 448U, 512U, 576U, 640U, 768U, 960U,
+	640U, 768U, 896U, 1024U, 1152U, 1280U, 1536U, 1920U,
+	1280U, 1536U, 1792U, 2048U, 2304U, 2560U, 3072U, 3840U
+};
+
+/*!< Core clocks of the FLL (DCO ranges with DMX32 set and clear) and of the internal reference. */
+static const uint32_t _coreClocks[] = {
+	4000000U, 20971520U, 24000000U, 41943040U, 47972352U, 48000000U
+};
+
+/*!< Requested baud rates: the standard ones, the table boundaries and odd values. */
+static const uint32_t _bauds[] = {
+	1000U, 3000U, 10000U, 33333U, 50000U, 99999U, 100000U, 100001U, 250000U, 333333U,
+	399999U, 400000U, 400001U, 500000U, 750000U, 1000000U, 1048576U, 1200000U, 2400000U, 12000000U
+};
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Fastest rate at or below a request, or 0 if none.
+ */
+static uint32_t ReferenceRate( uint32_t busClock, uint32_t baud )
+{
+	uint32_t best = UINT32_MAX;
+
+	for ( uint32_t mult = 0; mult <= 2U; ++mult )
+	{
+		for ( uint32_t icr = 0; icr < 64U; ++icr )
+		{
+			const uint32_t divider = (uint32_t)_dividers[icr] << mult;
+
+			if ( ( (uint64_t)baud * divider >= busClock ) && ( divider < best ) )
+			{
+				best = divider;
+			}
+		}
+	}
+	return ( best == UINT32_MAX ) ? 0U : busClock / best;
+}
+
+/**********************************************************************************/
+static void SetClocks( uint32_t coreClock, uint32_t outdiv4 )
+{
+	SystemCoreClock = coreClock;
+	SIM->CLKDIV1 = ( SIM->CLKDIV1 & ~SIM_CLKDIV1_OUTDIV4_MASK ) | SIM_CLKDIV1_OUTDIV4( outdiv4 );
+}
+
+/**********************************************************************************/
+static void TestBaudMatrix( void )
+{
+	uint32_t cases = 0U;
+	uint32_t exact = 0U;
+
+	for ( size_t c = 0; c < sizeof(_coreClocks) / sizeof(_coreClocks[0]); ++c )
+	{
+		for ( uint32_t outdiv4 = 0; outdiv4 < 8U; ++outdiv4 )
+		{
+			SetClocks( _coreClocks[c], outdiv4 );
+
+			const uint32_t busClock = _coreClocks[c] / ( outdiv4 + 1U );
+
+			for ( size_t b = 0; b < sizeof(_bauds) / sizeof(_bauds[0]); ++b )
+			{
+				const uint32_t expected = ReferenceRate( busClock, _bauds[b] );
+				const uint8_t status = I2C_InitWithBaud( I2C0, _bauds[b] );
+
+				++cases;
+				if ( expected == 0U )
+				{
+					HOST_TEST_EQUAL( status, SYSTEM_STATUS_FAIL );
+					continue;
+				}
+				HOST_TEST_EQUAL( status, SYSTEM_STATUS_SUCCESS );
+
+				const uint32_t rate = I2C_GetBaudRate( I2C0 );
+
+				HOST_TEST_EQUAL( rate, expected );
+				HOST_TEST_CHECK( rate <= _bauds[b] );
+				exact += ( rate == _bauds[b] ) ? 1U : 0U;
+				/* Fast mode plus takes the high drive pads */
+				HOST_TEST_EQUAL( ( I2C0->C2 & I2C_C2_HDRS_MASK ) != 0U, rate > 400000U );
+				/* The simulated bus runs with the divider set in F */
+				const uint32_t divider = (uint32_t)_dividers[I2C0->F & I2C_F_ICR_MASK]
+						<< ( ( I2C0->F & I2C_F_MULT_MASK ) >> I2C_F_MULT_SHIFT );
+
+				HOST_TEST_EQUAL( busClock / divider, rate );
+				HOST_TEST_EQUAL( HostI2c_GetSclCycles(),
+						( (uint64_t)divider * _coreClocks[c] + busClock - 1U ) / busClock );
+			}
+		}
+	}
+	printf( "  %u cases, %u exactly achievable\n", cases, exact );
+	SetClocks( DEFAULT_SYSTEM_CLOCK, 0U );
+}
+
+/**********************************************************************************/
+static void TestFastModePlus( void )
+{
+	/* 48 MHz core, 24 MHz bus: exactly 1 Mbps with the divider 24 */
+	SetClocks( 48000000U, 1U );
+	HOST_TEST_EQUAL( I2C_Init_1Mbps( I2C0 ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( I2C_GetBaudRate( I2C0 ), 1000000U );
+	HOST_TEST_CHECK( I2C0->C2 & I2C_C2_HDRS_MASK );
+
+	/* 20.97 MHz bus: the divider 20 gives 1048576 bps, above the request, 22 is taken */
+	SetClocks( 20971520U, 0U );
+	HOST_TEST_EQUAL( I2C_Init_1Mbps( I2C0 ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( I2C_GetBaudRate( I2C0 ), 20971520U / 22U );
+
+	/* Bus clock below 20 MHz: fails and leaves the module as it was */
+	HOST_TEST_EQUAL( I2C_Init_400kbps( I2C0 ), SYSTEM_STATUS_SUCCESS );
+	const uint8_t f = I2C0->F;
+
+	SetClocks( 41943040U, 2U );
+	HOST_TEST_EQUAL( I2C_Init_1Mbps( I2C0 ), SYSTEM_STATUS_FAIL );
+	HOST_TEST_EQUAL( I2C0->F, f );
+
+	SetClocks( DEFAULT_SYSTEM_CLOCK, 0U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HOST_TEST_RUN( TestBaudMatrix );
+	HOST_TEST_RUN( TestFastModePlus );
+
+	return HOST_TEST_RESULT();
+}
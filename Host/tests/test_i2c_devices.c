@@ -0,0 +1,208 @@
+/***************************************************************************************
+ * @file        test_i2c_devices.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the I2C slave device models, driven through the I2C driver.
+ * @remarks     Checks the behaviour of the PCF8574, of the 24Cxx page writes and
+ *              acknowledge polling and of the register file, and the bus and device
+ *              counters.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/i2c/i2c.h>
+
+#include "host_devices.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_PCF8574_ADDRESS 0x27U
+#define TEST_24C32_ADDRESS 0x50U
+#define TEST_24C02_ADDRESS 0x51U
+#define TEST_SENSOR_ADDRESS 0x1DU
+
+static hostPcf8574_t g_expander;
+static hostEeprom24_t g_eeprom;
+static hostEeprom24_t g_smallEeprom;
+static hostRegisterFile_t g_sensor;
+
+static uint8_t g_memory[4096];
+static uint8_t g_smallMemory[256];
+static uint8_t g_outputs[8];
+static uint32_t g_outputCount;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void RecordOutput( hostPcf8574_t *expander, uint8_t previous, void *context )
+{
+	(void)previous;
+	(void)context;
+	if ( g_outputCount < sizeof(g_outputs) )
+	{
+		g_outputs[g_outputCount] = expander->output;
+	}
+	++g_outputCount;
+}
+
+/**********************************************************************************/
+static void InitBus( void )
+{
+	HostI2c_RemoveSlaves();
+	HOST_TEST_EQUAL( I2C_Init_400kbps( I2C0 ), SYSTEM_STATUS_SUCCESS );
+	HostI2c_ClearStats();
+}
+
+/**********************************************************************************/
+static void TestPcf8574( void )
+{
+	const uint8_t sequence[] = { 0x0CU, 0x08U, 0xF4U };
+	uint8_t value = 0U;
+
+	InitBus();
+	HostPcf8574_Init( &g_expander, TEST_PCF8574_ADDRESS );
+	g_expander.listener = RecordOutput;
+	g_outputCount = 0U;
+
+	HOST_TEST_EQUAL( I2C_WriteSlaveChunk( I2C0, TEST_PCF8574_ADDRESS, sequence, sizeof(sequence) ),
+			SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( g_outputCount, sizeof(sequence) );
+	HOST_TEST_CHECK( memcmp( g_outputs, sequence, sizeof(sequence) ) == 0 );
+
+	/* Quasi-bidirectional pins: a high output reads what the outside drives */
+	g_expander.input = 0x3FU;
+	HOST_TEST_EQUAL( I2C_ReadSlave( I2C0, TEST_PCF8574_ADDRESS, &value ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( value, 0xF4U & 0x3FU );
+
+	HOST_TEST_EQUAL( g_expander.stats.starts, 2U );
+	HOST_TEST_EQUAL( g_expander.stats.stops, 2U );
+	HOST_TEST_EQUAL( g_expander.stats.bytesWritten, sizeof(sequence) );
+	HOST_TEST_EQUAL( g_expander.stats.bytesRead, 1U );
+
+	/* Bus: 4 + 2 bytes of 9 clocks, and a START and a STOP per transaction */
+	HOST_TEST_EQUAL( HostI2c_GetStats()->bytes, 6U );
+	HOST_TEST_EQUAL( HostI2c_GetStats()->sclCycles, 6U * 9U + 4U );
+	HOST_TEST_EQUAL( HostI2c_GetStats()->starts, 2U );
+	HOST_TEST_EQUAL( HostI2c_GetStats()->stops, 2U );
+}
+
+/**********************************************************************************/
+static void TestEepromPageWrite( void )
+{
+	/* Two address bytes, then 8 bytes from 4 bytes before the end of a 32 byte page */
+	const uint8_t write[] = { 0x01U, 0x1CU, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U };
+	const uint8_t address[] = { 0x01U, 0x1CU };
+	uint8_t read[8] = { 0 };
+	const i2cSegment_t segments[] = {
+		{ .slave_addr = TEST_24C32_ADDRESS, .direction = I2C_SEGMENT_WRITE, .tx_data = address, .size = 2U },
+		{ .slave_addr = TEST_24C32_ADDRESS, .direction = I2C_SEGMENT_READ, .rx_data = read, .size = 4U }
+	};
+	uint32_t polls = 0U;
+
+	InitBus();
+	memset( g_memory, 0xFF, sizeof(g_memory) );
+	HostEeprom24_Init( &g_eeprom, TEST_24C32_ADDRESS, g_memory, sizeof(g_memory), 32U );
+
+	HOST_TEST_EQUAL( I2C_WriteSlaveChunk( I2C0, TEST_24C32_ADDRESS, write, sizeof(write) ),
+			SYSTEM_STATUS_SUCCESS );
+	const uint64_t stop = HostSim_GetCycles();
+
+	/* The write wraps around in the page */
+	HOST_TEST_CHECK( memcmp( &g_memory[0x11C], &write[2], 4U ) == 0 );
+	HOST_TEST_CHECK( memcmp( &g_memory[0x100], &write[6], 4U ) == 0 );
+	HOST_TEST_EQUAL( g_memory[0x120], 0xFFU );
+	HOST_TEST_EQUAL( g_eeprom.pageWrites, 1U );
+
+	/* Acknowledge polling until the end of the write cycle */
+	HOST_TEST_CHECK( HostEeprom24_IsBusy( &g_eeprom ) );
+	while ( I2C_Transfer( I2C0, segments, 2U ) == SYSTEM_STATUS_INVALID_ADDRESS )
+	{
+		++polls;
+	}
+	HOST_TEST_CHECK( polls > 0U );
+	HOST_TEST_EQUAL( g_eeprom.stats.naks, polls );
+	HOST_TEST_CHECK( HostSim_GetCycles() - stop >= HostSim_UsToCycles( HOSTEEPROM24_WRITE_CYCLE_US ) );
+	HOST_TEST_CHECK( memcmp( read, &write[2], 4U ) == 0 );
+
+	/* Sequential read past the page, the read does not wrap in the page */
+	HOST_TEST_EQUAL( I2C_ReadSlave( I2C0, TEST_24C32_ADDRESS, &read[0] ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( read[0], 0xFFU );
+	HOST_TEST_EQUAL( g_eeprom.pageWrites, 1U );
+}
+
+/**********************************************************************************/
+static void TestEepromOneAddressByte( void )
+{
+	const uint8_t data[] = { 0xDEU, 0xADU, 0xBEU, 0xEFU };
+	uint8_t read[sizeof(data)] = { 0 };
+	uint8_t *result = read;
+
+	InitBus();
+	HostEeprom24_Init( &g_smallEeprom, TEST_24C02_ADDRESS, g_smallMemory, sizeof(g_smallMemory), 8U );
+
+	/* The word address of the 24C02 is a register address for the driver */
+	HOST_TEST_EQUAL( I2C_WriteRegisterChunk( I2C0, TEST_24C02_ADDRESS, 0x40U, data, sizeof(data) ),
+			SYSTEM_STATUS_SUCCESS );
+	HostSim_Advance( HostSim_UsToCycles( HOSTEEPROM24_WRITE_CYCLE_US ) );
+	HOST_TEST_EQUAL( I2C_ReadRegisterChunk( I2C0, TEST_24C02_ADDRESS, 0x40U, &result, sizeof(read) ),
+			SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_CHECK( memcmp( read, data, sizeof(data) ) == 0 );
+	HOST_TEST_EQUAL( g_smallEeprom.stats.naks, 0U );
+	HOST_TEST_EQUAL( g_smallEeprom.stats.bytesRead, sizeof(data) );
+}
+
+/**********************************************************************************/
+static void TestRegisterFile( void )
+{
+	uint8_t values[3] = { 0 };
+	uint8_t *result = values;
+
+	InitBus();
+	HostRegisterFile_Init( &g_sensor, TEST_SENSOR_ADDRESS );
+	g_sensor.registers[0x30] = 0x11U;
+	g_sensor.registers[0x31] = 0x22U;
+	g_sensor.registers[0x32] = 0x33U;
+
+	HOST_TEST_EQUAL( I2C_ReadRegisterChunk( I2C0, TEST_SENSOR_ADDRESS, 0x30U, &result, 3U ),
+			SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( values[0], 0x11U );
+	HOST_TEST_EQUAL( values[2], 0x33U );
+
+	/* Without auto-increment, a burst reads the same register, as a FIFO output */
+	g_sensor.autoIncrement = false;
+	HOST_TEST_EQUAL( I2C_ReadRegisterChunk( I2C0, TEST_SENSOR_ADDRESS, 0x31U, &result, 3U ),
+			SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( values[0], 0x22U );
+	HOST_TEST_EQUAL( values[2], 0x22U );
+
+	HOST_TEST_EQUAL( I2C_WriteRegister( I2C0, TEST_SENSOR_ADDRESS, 0x20U, 0x47U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( g_sensor.registers[0x20], 0x47U );
+
+	/* Two write-then-read transactions (START and repeated START each), one write */
+	HOST_TEST_EQUAL( g_sensor.stats.starts, 5U );
+	HOST_TEST_EQUAL( g_sensor.stats.stops, 3U );
+	HOST_TEST_EQUAL( g_sensor.stats.bytesRead, 6U );
+	HOST_TEST_EQUAL( g_sensor.stats.bytesWritten, 4U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HOST_TEST_RUN( TestPcf8574 );
+	HOST_TEST_RUN( TestEepromPageWrite );
+	HOST_TEST_RUN( TestEepromOneAddressByte );
+	HOST_TEST_RUN( TestRegisterFile );
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,150 @@
+/***************************************************************************************
+ * @file        test_ili9320_bus.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the table-driven GPIO bus of the ILI9320 driver.
+ * @remarks     The bus drives the TFT LCD model of host_devices.h, which latches the
+ *              bytes on the rising edges of WR and checks the WR pulse widths and
+ *              that DC and the data lines hold while WR is low. Checks every byte of
+ *              the table on the wire, the register writes per byte and per register,
+ *              and the pixels of the GRAM written by the driver.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <common.h>
+#include <Libraries/ili9320/ili9320.h>
+
+#include "host_devices.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< GPIO writes of a byte: PSOR and PCOR of each port, and the two of the WR strobe. */
+#define TEST_BYTE_WRITES 6U
+/*!< GPIO writes of a register index or value: DC low and high around the index, and 4 bytes. */
+#define TEST_REGISTER_WRITES ( 2U + 4U * TEST_BYTE_WRITES )
+
+/*!< Bus pins of the boards: data and DC, CS on PTA, data, WR and RD on PTB. */
+#define TEST_PTA_PINS ( ( 1UL << 0 ) | ( 1UL << 8 ) | ( 1UL << 10 ) | ( 1UL << 11 ) | ( 1UL << 12 ) )
+#define TEST_PTB_PINS ( ( 1UL << 5 ) | ( 1UL << 6 ) | ( 1UL << 7 ) | ( 1UL << 8 ) | ( 1UL << 9 ) | \
+		( 1UL << 10 ) | ( 1UL << 11 ) )
+
+/*!< Attached once: the GPIO listeners can not be removed. */
+static hostTftLcd_t g_lcd;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Configures the bus pins as the application does, the control lines idle
+ *        high, and resets the controller and the bus.
+ */
+static void BusInit( void )
+{
+	GPIOA->PSOR = ( 1UL << 0 ) | ( 1UL << 8 );
+	GPIOB->PSOR = ( 1UL << 8 ) | ( 1UL << 9 );
+	GPIOA->PDDR |= TEST_PTA_PINS;
+	GPIOB->PDDR |= TEST_PTB_PINS;
+
+	HostTftLcd_Init( &g_lcd, HOSTTFTLCD_ILI9320 );
+	LCD_IO_Init();
+}
+
+/**
+ * @brief Gets the GPIO writes of both ports.
+ */
+static uint64_t GpioWrites( void )
+{
+	return HostGpio_GetWriteCount( HOSTSIM_PORT_A ) + HostGpio_GetWriteCount( HOSTSIM_PORT_B );
+}
+
+/**********************************************************************************/
+static void TestEveryByte( void )
+{
+	BusInit();
+
+	for ( unsigned value = 0; value < 256U; ++value )
+	{
+		uint8_t byte = (uint8_t)value;
+		const uint64_t writes = GpioWrites();
+
+		LCD_IO_WriteMultipleData( &byte, 1U );
+		HOST_TEST_EQUAL( g_lcd.lastByte, byte );
+		HOST_TEST_EQUAL( GpioWrites() - writes, TEST_BYTE_WRITES );
+	}
+	HOST_TEST_CHECK( g_lcd.lastDc );
+	HOST_TEST_EQUAL( g_lcd.stats.bytes, 256U );
+	HOST_TEST_EQUAL( g_lcd.stats.violations, 0U );
+}
+
+/**********************************************************************************/
+static void TestRegisterWrite( void )
+{
+	BusInit();
+
+	const uint64_t writes = GpioWrites();
+
+	ili9320_WriteReg( LCD_REG_97, 0xA55AU );
+	printf( "  register write: %llu GPIO writes\n", (unsigned long long)( GpioWrites() - writes ) );
+	HOST_TEST_EQUAL( GpioWrites() - writes, TEST_REGISTER_WRITES );
+	HOST_TEST_EQUAL( g_lcd.registers[LCD_REG_97], 0xA55AU );
+	HOST_TEST_EQUAL( g_lcd.stats.commands, 1U );
+	HOST_TEST_EQUAL( g_lcd.stats.bytes, 4U );
+
+	/* The index goes with DC low, the value with DC high */
+	LCD_IO_WriteReg( LCD_REG_7 );
+	HOST_TEST_CHECK( !g_lcd.lastDc );
+	HOST_TEST_EQUAL( g_lcd.lastByte, LCD_REG_7 );
+	HOST_TEST_EQUAL( g_lcd.stats.violations, 0U );
+}
+
+/**********************************************************************************/
+static void TestPixels( void )
+{
+	static const uint16_t image[2][3] = {
+		{ 0x1234U, 0xABCDU, 0x00FFU },
+		{ 0xFF00U, 0x8001U, 0x7FFEU }
+	};
+
+	BusInit();
+	ili9320_Init();
+
+	/* The words go high byte first whatever the MCU byte order */
+	ili9320_WritePixel( 0U, 0U, 0xF800U );
+	ili9320_WritePixel( ILI9320_LCD_PIXEL_WIDTH - 1U, ILI9320_LCD_PIXEL_HEIGHT - 1U, 0x07E0U );
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 0U, 0U ), 0xF800U );
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, ILI9320_LCD_PIXEL_WIDTH - 1U, ILI9320_LCD_PIXEL_HEIGHT - 1U ),
+			0x07E0U );
+
+	/* The rows of an image, each in its own window row */
+	ili9320_SetDisplayWindow( 100U, 50U, 3U, 2U );
+	ili9320_DrawRGBImage( 100U, 50U, 3U, 2U, (uint8_t*)image );
+	for ( uint16_t y = 0; y < 2U; ++y )
+	{
+		for ( uint16_t x = 0; x < 3U; ++x )
+		{
+			HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 100U + x, 50U + y ), image[y][x] );
+		}
+	}
+	HOST_TEST_EQUAL( HostTftLcd_GetPixel( &g_lcd, 103U, 50U ), 0U );
+	HOST_TEST_EQUAL( g_lcd.stats.violations, 0U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HostTftLcd_AttachGpio( &g_lcd );
+
+	HOST_TEST_RUN( TestEveryByte );
+	HOST_TEST_RUN( TestRegisterWrite );
+	HOST_TEST_RUN( TestPixels );
+
+	return HOST_TEST_RESULT();
+}
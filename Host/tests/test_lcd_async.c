@@ -0,0 +1,319 @@
+/***************************************************************************************
+ * @file        test_lcd_async.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the render queue of the asynchronous HD44780 API.
+ * @remarks     Built with __FREERTOS_H. The LCD is the HD44780 model of
+ *              host_devices.h, 16x2 on a 4-bit parallel bus. The checks run in a
+ *              task of higher priority than the render task, which so only runs
+ *              when the checks wait: what they queue meanwhile stays in the queue.
+ *              xTaskCreate is wrapped to make the task creation of LCD_AsyncInit
+ *              fail on request.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/delay/delay.h>
+#include <Libraries/lcd/lcd.h>
+#include <Libraries/lcd/lcd_async.h>
+#include <Libraries/lcd/adapters/lcd_parallel_adapter.h>
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "host_devices.h"
+#include "host_test.h"
+
+#ifndef _LCD_USE_RTOS
+#error "test_lcd_async is built with __FREERTOS_H"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_COLS 16U
+#define TEST_LINES 2U
+
+/*!< Time given to the render task to drain the queue, in ticks. */
+#define TEST_RENDER_TICKS 20U
+
+/*!< RS, E and R/W on PTB0..2, DB4..DB7 on PTB8..11. */
+static const hostHd44780Wiring_t _wiring = {
+	.rs = HOSTHD44780_PIN( HOSTSIM_PORT_B, 0U ), .rw = HOSTHD44780_NOT_WIRED,
+	.enable = HOSTHD44780_PIN( HOSTSIM_PORT_B, 1U ),
+	.data = {
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 8U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 9U ),
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 10U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 11U )
+	},
+	.dataCount = 4U
+};
+
+static hostHd44780_t g_lcd;
+static lcdAsyncHandle_t g_async;
+
+/*!< The next xTaskCreate fails, as when the heap is exhausted. */
+static bool g_failTaskCreate;
+
+BaseType_t __real_xTaskCreate( TaskFunction_t code, const char * const name, const uint16_t depth,
+		void * const parameters, UBaseType_t priority, TaskHandle_t * const created );
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief xTaskCreate, failing once when g_failTaskCreate is set.
+ */
+BaseType_t __wrap_xTaskCreate( TaskFunction_t code, const char * const name, const uint16_t depth,
+		void * const parameters, UBaseType_t priority, TaskHandle_t * const created )
+{
+	if ( g_failTaskCreate )
+	{
+		g_failTaskCreate = false;
+		return errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+	}
+	return __real_xTaskCreate( code, name, depth, parameters, priority, created );
+}
+
+/**
+ * @brief Gets an adapter pin, as an output.
+ */
+static lcdPin_t TestPin( uint8_t pin )
+{
+	const uint32_t mask = 1UL << ( pin & 31U );
+
+	GPIOB->PDDR |= mask;
+	return (lcdPin_t){ .portRegister = GPIOB, .pinMask = mask };
+}
+
+/**
+ * @brief Gives the render task the time to drain the queue.
+ */
+static void Render( void )
+{
+	vTaskDelay( TEST_RENDER_TICKS );
+}
+
+/**
+ * @brief Gets the character shown at a cell.
+ */
+static char ScreenAt( uint8_t col, uint8_t row )
+{
+	char screen[TEST_COLS * TEST_LINES];
+
+	HostHd44780_GetScreen( &g_lcd, TEST_COLS, TEST_LINES, screen );
+	return screen[row * TEST_COLS + col];
+}
+
+/**
+ * @brief Queues operations that are never coalesced until the queue is full.
+ *
+ * @return The number of operations queued.
+ */
+static uint32_t FillQueue( void )
+{
+	uint32_t queued = 0U;
+
+	/* A cursor move and a text alternate: none is merged into the previous one */
+	for ( ;; )
+	{
+		if ( LCD_AsyncSetCursor( g_async, (uint8_t)queued, 1U ) != SYSTEM_STATUS_SUCCESS )
+		{
+			break;
+		}
+		++queued;
+		if ( LCD_AsyncWriteString( g_async, "*" ) != SYSTEM_STATUS_SUCCESS )
+		{
+			break;
+		}
+		++queued;
+	}
+	return queued;
+}
+
+/**
+ * @brief Nothing is sent until the render task runs, then the queue is drained in order.
+ */
+static void CheckQueue( void )
+{
+	const uint64_t instructions = g_lcd.stats.instructions;
+
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 2U, 0U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, "ab" ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 5U, 1U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, "cd" ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( FillQueue(), LCD_ASYNC_QUEUE_LENGTH - 4U );
+	HOST_TEST_EQUAL( g_lcd.stats.instructions, instructions );
+
+	Render();
+	HOST_TEST_EQUAL( ScreenAt( 2U, 0U ), 'a' );
+	HOST_TEST_EQUAL( ScreenAt( 3U, 0U ), 'b' );
+	HOST_TEST_EQUAL( ScreenAt( 5U, 1U ), 'c' );
+	HOST_TEST_EQUAL( ScreenAt( 2U, 1U ), '*' );
+	HOST_TEST_EQUAL( g_lcd.stats.ignored, 0U );
+
+	/* The queue is empty again */
+	HOST_TEST_EQUAL( FillQueue(), LCD_ASYNC_QUEUE_LENGTH );
+	HOST_TEST_EQUAL( LCD_AsyncClear( g_async ), SYSTEM_STATUS_SUCCESS );
+	Render();
+}
+
+/**
+ * @brief Consecutive cursor moves take one operation and send one instruction.
+ */
+static void CheckCursorCoalescing( void )
+{
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 0U, 0U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 9U, 1U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncHome( g_async ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 7U, 1U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, "C" ), SYSTEM_STATUS_SUCCESS );
+
+	const uint64_t instructions = g_lcd.stats.instructions;
+	const uint64_t dataWrites = g_lcd.stats.dataWrites;
+
+	Render();
+	HOST_TEST_EQUAL( g_lcd.stats.instructions - instructions, 1U );
+	HOST_TEST_EQUAL( g_lcd.stats.dataWrites - dataWrites, 1U );
+	HOST_TEST_EQUAL( ScreenAt( 7U, 1U ), 'C' );
+
+	/* The moves are only merged up to a text: a move, a text, two moves and a text take 4 operations */
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 0U, 0U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, "x" ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 1U, 0U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncHome( g_async ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, "y" ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( FillQueue(), LCD_ASYNC_QUEUE_LENGTH - 4U );
+	HOST_TEST_EQUAL( LCD_AsyncClear( g_async ), SYSTEM_STATUS_SUCCESS );
+	Render();
+}
+
+/**
+ * @brief Consecutive texts are appended in one operation while it has room.
+ */
+static void CheckTextAppend( void )
+{
+	char longText[( LCD_ASYNC_QUEUE_LENGTH - 1U ) * LCD_ASYNC_TEXT_SIZE + 2U];
+
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 0U, 0U ), SYSTEM_STATUS_SUCCESS );
+	for ( const char *chunk = "0123456789ABCDEF"; *chunk != '\0'; chunk += 4 )
+	{
+		char text[5];
+
+		memcpy( text, chunk, 4U );
+		text[4] = '\0';
+		HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, text ), SYSTEM_STATUS_SUCCESS );
+	}
+	/* The 16 characters take one operation */
+	HOST_TEST_EQUAL( FillQueue(), LCD_ASYNC_QUEUE_LENGTH - 2U );
+	HOST_TEST_EQUAL( LCD_AsyncClear( g_async ), SYSTEM_STATUS_SUCCESS );
+	Render();
+
+	/* A text longer than the room left is refused whole */
+	memset( longText, 'L', sizeof(longText) - 1U );
+	longText[sizeof(longText) - 1U] = '\0';
+	HOST_TEST_EQUAL( LCD_AsyncHome( g_async ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, longText ), SYSTEM_STATUS_FAIL );
+	longText[sizeof(longText) - 2U] = '\0';
+	HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, longText ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 0U, 1U ), SYSTEM_STATUS_FAIL );
+	HOST_TEST_EQUAL( LCD_AsyncClear( g_async ), SYSTEM_STATUS_SUCCESS );
+	Render();
+}
+
+/**
+ * @brief A clear drops the pending operations, whose result it would erase.
+ */
+static void CheckClearDropsQueue( void )
+{
+	HOST_TEST_EQUAL( LCD_AsyncSetCursor( g_async, 0U, 0U ), SYSTEM_STATUS_SUCCESS );
+	HOST_TEST_EQUAL( LCD_AsyncWriteString( g_async, "lost" ), SYSTEM_STATUS_SUCCESS );
+	(void)FillQueue();
+
+	const uint64_t instructions = g_lcd.stats.instructions;
+	const uint64_t dataWrites = g_lcd.stats.dataWrites;
+
+	HOST_TEST_EQUAL( LCD_AsyncClear( g_async ), SYSTEM_STATUS_SUCCESS );
+	Render();
+	HOST_TEST_EQUAL( g_lcd.stats.instructions - instructions, 1U );
+	HOST_TEST_EQUAL( g_lcd.stats.dataWrites - dataWrites, 0U );
+	HOST_TEST_EQUAL( ScreenAt( 0U, 0U ), ' ' );
+
+	/* The queue has room again after the clear */
+	HOST_TEST_EQUAL( FillQueue(), LCD_ASYNC_QUEUE_LENGTH );
+	HOST_TEST_EQUAL( g_lcd.stats.ignored, 0U );
+}
+
+/**
+ * @brief The checks, run above the priority of the render task.
+ */
+static void CheckTask( void *parameters )
+{
+	(void)parameters;
+
+	CheckQueue();
+	CheckCursorCoalescing();
+	CheckTextAppend();
+	CheckClearDropsQueue();
+	vTaskEndScheduler();
+}
+
+/**********************************************************************************/
+static void TestAsync( void )
+{
+	lcdPin_t data[4];
+
+	Delay_Init();
+	HostHd44780_Init( &g_lcd );
+	g_lcd.wiring = &_wiring;
+	for ( uint8_t i = 0; i < 4U; ++i )
+	{
+		data[i] = TestPin( _wiring.data[i] );
+	}
+	lcdPin_t rs = TestPin( _wiring.rs );
+	lcdPin_t en = TestPin( _wiring.enable );
+
+	lcdHandle_t lcd = LCD_Init( LCD_CreateParallelAdapter( data, &rs, &en ), TEST_COLS, TEST_LINES,
+			LCD_5x8_DOTS );
+
+	HOST_TEST_CHECK( lcd != NULL );
+
+	/* A failed creation gives its slot back, with its mutex: the retry creates no other one */
+	g_failTaskCreate = true;
+	HOST_TEST_CHECK( LCD_AsyncInit( lcd ) == NULL );
+
+	const size_t heap = xPortGetFreeHeapSize();
+
+	g_failTaskCreate = true;
+	HOST_TEST_CHECK( LCD_AsyncInit( lcd ) == NULL );
+	HOST_TEST_EQUAL( xPortGetFreeHeapSize(), heap );
+
+	g_async = LCD_AsyncInit( lcd );
+	HOST_TEST_CHECK( g_async != NULL );
+	if ( g_async == NULL )
+	{
+		return;
+	}
+
+	xTaskCreate( CheckTask, "checks", configMINIMAL_STACK_SIZE, NULL, LCD_ASYNC_TASK_PRIORITY + 1U, NULL );
+	vTaskStartScheduler();
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	/* Once: the GPIO listeners survive the simulator resets */
+	HostHd44780_Init( &g_lcd );
+	HostHd44780_AttachGpio( &g_lcd, &_wiring );
+
+	/* The scheduler runs once per program: FreeRTOS can not be restarted */
+	HOST_TEST_RUN( TestAsync );
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,186 @@
+/***************************************************************************************
+ * @file        test_lcd_glyphs.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the DDRAM address restored by the glyph cache after a glyph
+ *              upload.
+ * @remarks     Built with LCD_GLYPH_CACHE. The LCD is the HD44780 model of
+ *              host_devices.h, 16x2 on a 4-bit parallel bus, created once: the
+ *              handles are static. Each check moves the address counter in a way
+ *              the cursor API does not see, writes a glyph that is not in CGRAM yet
+ *              and checks where it lands in the DDRAM.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/delay/delay.h>
+#include <Libraries/lcd/lcd.h>
+#include <Libraries/lcd/adapters/lcd_parallel_adapter.h>
+
+#include "host_devices.h"
+#include "host_test.h"
+
+#ifndef LCD_GLYPH_CACHE
+#error "test_lcd_glyphs is built with LCD_GLYPH_CACHE"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_COLS 16U
+#define TEST_LINES 2U
+
+/*!< RS and E on PTB0..1, DB4..DB7 on PTB8..11. */
+static const hostHd44780Wiring_t _wiring = {
+	.rs = HOSTHD44780_PIN( HOSTSIM_PORT_B, 0U ), .rw = HOSTHD44780_NOT_WIRED,
+	.enable = HOSTHD44780_PIN( HOSTSIM_PORT_B, 1U ),
+	.data = {
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 8U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 9U ),
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 10U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 11U )
+	},
+	.dataCount = 4U
+};
+
+/*!< Three glyphs with distinct bit maps. */
+static const uint8_t _glyphs[3][8] = {
+	{ 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U },
+	{ 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U },
+	{ 0x1CU, 0x1CU, 0x1CU, 0x1CU, 0x1CU, 0x1CU, 0x1CU, 0x1CU }
+};
+
+static hostHd44780_t g_lcd;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Gets an adapter pin, as an output.
+ */
+static lcdPin_t TestPin( uint8_t pin )
+{
+	const uint32_t mask = 1UL << ( pin & 31U );
+
+	GPIOB->PDDR |= mask;
+	return (lcdPin_t){ .portRegister = GPIOB, .pinMask = mask };
+}
+
+/**
+ * @brief Initializes the LCD.
+ */
+static lcdHandle_t CreateLcd( void )
+{
+	lcdPin_t data[4];
+
+	Delay_Init();
+	HostHd44780_Init( &g_lcd );
+	g_lcd.wiring = &_wiring;
+	for ( uint8_t i = 0; i < 4U; ++i )
+	{
+		data[i] = TestPin( _wiring.data[i] );
+	}
+	lcdPin_t rs = TestPin( _wiring.rs );
+	lcdPin_t en = TestPin( _wiring.enable );
+
+	lcdHandle_t handle = LCD_Init( LCD_CreateParallelAdapter( data, &rs, &en ), TEST_COLS, TEST_LINES,
+			LCD_5x8_DOTS );
+
+	HOST_TEST_CHECK( handle != NULL );
+	return handle;
+}
+
+/**
+ * @brief Checks that a glyph is shown at a DDRAM address.
+ */
+static void CheckGlyphAt( uint8_t address, uint8_t glyph )
+{
+	const uint8_t code = g_lcd.ddram[address];
+
+	HOST_TEST_CHECK( code < 8U );
+	HOST_TEST_CHECK( memcmp( &g_lcd.cgram[( code & 7U ) * 8U], _glyphs[glyph - 1U], 8U ) == 0 );
+}
+
+/**
+ * @brief A raw address command, and a run that goes from the end of line 0 to line 1.
+ */
+static void CheckLineWrap( lcdHandle_t handle )
+{
+	LCD_Command( handle, LCD_SET_DD_RAM_ADDR | 0x26U );
+	LCD_WriteString( handle, "ab\x1B\x01" "c" );
+	HOST_TEST_EQUAL( g_lcd.ddram[0x26U], 'a' );
+	HOST_TEST_EQUAL( g_lcd.ddram[0x27U], 'b' );
+	CheckGlyphAt( 0x40U, 1U );
+	HOST_TEST_EQUAL( g_lcd.ddram[0x41U], 'c' );
+}
+
+/**
+ * @brief Raw cursor moves and display shifts.
+ */
+static void CheckRawCursorMoves( lcdHandle_t handle )
+{
+	LCD_SetCursor( handle, 0U, 0U );
+	LCD_Command( handle, LCD_CURSOR_SHIFT | LCD_CURSOR_MOVE | LCD_MOVE_RIGHT );
+	LCD_Command( handle, LCD_CURSOR_SHIFT | LCD_CURSOR_MOVE | LCD_MOVE_RIGHT );
+	LCD_Write( handle, 'x' );
+	/* A display shift does not move the address counter */
+	LCD_Command( handle, LCD_CURSOR_SHIFT | LCD_DISPLAY_MOVE | LCD_MOVE_RIGHT );
+	LCD_WriteString( handle, "\x1B\x02" );
+	HOST_TEST_EQUAL( g_lcd.ddram[0x02U], 'x' );
+	CheckGlyphAt( 0x03U, 2U );
+
+	/* From the start of the DDRAM, a move left wraps to the end of line 1 */
+	LCD_Home( handle );
+	LCD_Command( handle, LCD_CURSOR_SHIFT | LCD_CURSOR_MOVE | LCD_MOVE_LEFT );
+	LCD_WriteString( handle, "\x1B\x03" );
+	CheckGlyphAt( 0x67U, 3U );
+}
+
+/**
+ * @brief A right to left entry mode decrements the address counter.
+ */
+static void CheckRightToLeft( lcdHandle_t handle )
+{
+	LCD_RightToLeft( handle );
+	LCD_SetCursor( handle, 5U, 1U );
+	LCD_WriteString( handle, "yz\x1B\x01" );
+	HOST_TEST_EQUAL( g_lcd.ddram[0x45U], 'y' );
+	HOST_TEST_EQUAL( g_lcd.ddram[0x44U], 'z' );
+	/* Only the code: the controller also decrements through CGRAM, as for LCD_CreateChar */
+	HOST_TEST_CHECK( g_lcd.ddram[0x43U] < 8U );
+	LCD_LeftToRight( handle );
+}
+
+/**********************************************************************************/
+static void TestGlyphAddress( void )
+{
+	lcdHandle_t handle = CreateLcd();
+
+	/* Setting the table again empties the cache: each check uploads its glyphs */
+	LCD_SetGlyphTable( handle, _glyphs, 3U );
+	CheckLineWrap( handle );
+	LCD_SetGlyphTable( handle, _glyphs, 3U );
+	CheckRawCursorMoves( handle );
+	LCD_SetGlyphTable( handle, _glyphs, 3U );
+	CheckRightToLeft( handle );
+	HOST_TEST_EQUAL( g_lcd.stats.ignored, 0U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	/* Once: the GPIO listeners survive the simulator resets */
+	HostHd44780_Init( &g_lcd );
+	HostHd44780_AttachGpio( &g_lcd, &_wiring );
+
+	/* The LCD is created once: the adapter and the handle are static */
+	HOST_TEST_RUN( TestGlyphAddress );
+
+	return HOST_TEST_RESULT();
+}
@@ -0,0 +1,193 @@
+/***************************************************************************************
+ * @file        test_lcd_parallel.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the GPIO writes of the HD44780 parallel adapter with the
+ *              nibble mask tables.
+ * @remarks     Built with LCD_PARALLEL_MASK_TABLES. The adapter drives the HD44780
+ *              model of host_devices.h in 4 bits. A character costs 1 write for RS
+ *              and, for each nibble, one PSOR and one PCOR per port holding data
+ *              pins plus 3 writes for the E pulse. Checks these counts with the
+ *              data pins on one port and split over both, the characters latched by
+ *              the controller, and the busy flag read through data pins on two ports.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/delay/delay.h>
+#include <Libraries/lcd/lcd.h>
+#include <Libraries/lcd/adapters/lcd_parallel_adapter.h>
+
+#include "host_devices.h"
+#include "host_test.h"
+
+#ifndef LCD_PARALLEL_MASK_TABLES
+#error "test_lcd_parallel is built with LCD_PARALLEL_MASK_TABLES"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_TEXT "Hello, KL05!"
+
+/*!< GPIO writes of a nibble besides the data pins: E low, E high and E low. */
+#define TEST_ENABLE_WRITES 3U
+
+/*!< All the lines on PTB: RS, E and R/W on PTB0..2, DB4..DB7 on PTB8..11. */
+static const hostHd44780Wiring_t _onePort = {
+	.rs = HOSTHD44780_PIN( HOSTSIM_PORT_B, 0U ), .rw = HOSTHD44780_PIN( HOSTSIM_PORT_B, 2U ),
+	.enable = HOSTHD44780_PIN( HOSTSIM_PORT_B, 1U ),
+	.data = {
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 8U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 9U ),
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 10U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 11U )
+	},
+	.dataCount = 4U
+};
+
+/*!< Data pins split as on boards routed by hand: DB4 and DB5 on PTA, DB6 and DB7 on PTB. */
+static const hostHd44780Wiring_t _twoPorts = {
+	.rs = HOSTHD44780_PIN( HOSTSIM_PORT_A, 5U ), .rw = HOSTHD44780_PIN( HOSTSIM_PORT_A, 7U ),
+	.enable = HOSTHD44780_PIN( HOSTSIM_PORT_A, 6U ),
+	.data = {
+		HOSTHD44780_PIN( HOSTSIM_PORT_A, 10U ), HOSTHD44780_PIN( HOSTSIM_PORT_A, 12U ),
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 6U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 7U )
+	},
+	.dataCount = 4U
+};
+
+/*!< One model per wiring, attached once: the GPIO listeners can not be removed. */
+static hostHd44780_t g_lcdOnePort;
+static hostHd44780_t g_lcdTwoPorts;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Gets the adapter pin of a wiring pin, and makes it an output.
+ */
+static lcdPin_t TestPin( uint8_t pin )
+{
+	GPIO_Type *port = ( ( pin >> 5 ) == HOSTSIM_PORT_A ) ? GPIOA : GPIOB;
+	const uint32_t mask = 1UL << ( pin & 31U );
+
+	port->PDDR |= mask;
+	return (lcdPin_t){ .portRegister = port, .pinMask = mask };
+}
+
+/**
+ * @brief Resets a model in 4-bit mode and creates the adapter of its wiring.
+ */
+static lcdAdapterInterface_t *CreateAdapter( hostHd44780_t *lcd )
+{
+	const hostHd44780Wiring_t *wiring = lcd->wiring;
+	lcdPin_t data[4];
+
+	Delay_Init();
+	HostHd44780_Init( lcd );
+	lcd->wiring = wiring;
+	/* As after LCD_Init: the adapter alone is under test */
+	lcd->fourBit = true;
+	lcd->twoLines = true;
+
+	for ( uint8_t i = 0; i < 4U; ++i )
+	{
+		data[i] = TestPin( wiring->data[i] );
+	}
+	lcdPin_t rs = TestPin( wiring->rs );
+	lcdPin_t en = TestPin( wiring->enable );
+
+	return LCD_CreateParallelAdapter( data, &rs, &en );
+}
+
+/**
+ * @brief Writes TEST_TEXT and gives the GPIO writes per character.
+ */
+static uint64_t WriteText( lcdAdapterInterface_t *adapter, hostHd44780_t *lcd )
+{
+	const uint64_t writes = HostGpio_GetWriteCount( HOSTSIM_PORT_A ) + HostGpio_GetWriteCount( HOSTSIM_PORT_B );
+
+	for ( const char *c = TEST_TEXT; *c != '\0'; ++c )
+	{
+		adapter->write( adapter, (uint8_t)*c, false, LCD_DATA_MODE );
+	}
+	HOST_TEST_CHECK( memcmp( lcd->ddram, TEST_TEXT, strlen( TEST_TEXT ) ) == 0 );
+	HOST_TEST_EQUAL( lcd->stats.dataWrites, strlen( TEST_TEXT ) );
+	HOST_TEST_EQUAL( lcd->stats.ignored, 0U );
+
+	return ( HostGpio_GetWriteCount( HOSTSIM_PORT_A ) + HostGpio_GetWriteCount( HOSTSIM_PORT_B ) - writes )
+			/ strlen( TEST_TEXT );
+}
+
+/**********************************************************************************/
+static void TestOnePort( void )
+{
+	lcdAdapterInterface_t *adapter = CreateAdapter( &g_lcdOnePort );
+
+	HOST_TEST_CHECK( adapter != NULL );
+
+	const uint64_t writes = WriteText( adapter, &g_lcdOnePort );
+
+	printf( "  data pins on one port: %llu GPIO writes per character\n", (unsigned long long)writes );
+	HOST_TEST_EQUAL( writes, 1U + 2U * ( 2U + TEST_ENABLE_WRITES ) );
+
+	LCD_FreeAdapterParallel( adapter );
+}
+
+/**********************************************************************************/
+static void TestTwoPorts( void )
+{
+	lcdAdapterInterface_t *adapter = CreateAdapter( &g_lcdTwoPorts );
+
+	HOST_TEST_CHECK( adapter != NULL );
+
+	const uint64_t writes = WriteText( adapter, &g_lcdTwoPorts );
+
+	printf( "  data pins on two ports: %llu GPIO writes per character\n", (unsigned long long)writes );
+	HOST_TEST_EQUAL( writes, 1U + 2U * ( 4U + TEST_ENABLE_WRITES ) );
+
+	LCD_FreeAdapterParallel( adapter );
+}
+
+/**********************************************************************************/
+static void TestBusyFlagTwoPorts( void )
+{
+	lcdAdapterInterface_t *adapter = CreateAdapter( &g_lcdTwoPorts );
+	lcdPin_t rw = TestPin( _twoPorts.rw );
+
+	HOST_TEST_CHECK( adapter != NULL );
+	LCD_ParallelSetRwPin( adapter, &rw );
+
+	/* Without the fixed waits, only the busy flag keeps the writes from being lost */
+	(void)WriteText( adapter, &g_lcdTwoPorts );
+	HOST_TEST_CHECK( g_lcdTwoPorts.stats.busyReads >= strlen( TEST_TEXT ) );
+
+	/* The data pins are outputs again */
+	HOST_TEST_EQUAL( GPIOA->PDDR & ( ( 1UL << 10 ) | ( 1UL << 12 ) ), ( 1UL << 10 ) | ( 1UL << 12 ) );
+	HOST_TEST_EQUAL( GPIOB->PDDR & ( ( 1UL << 6 ) | ( 1UL << 7 ) ), ( 1UL << 6 ) | ( 1UL << 7 ) );
+
+	LCD_FreeAdapterParallel( adapter );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	/* Once: the GPIO listeners survive the simulator resets */
+	HostHd44780_Init( &g_lcdOnePort );
+	HostHd44780_AttachGpio( &g_lcdOnePort, &_onePort );
+	HostHd44780_Init( &g_lcdTwoPorts );
+	HostHd44780_AttachGpio( &g_lcdTwoPorts, &_twoPorts );
+
+	HOST_TEST_RUN( TestOnePort );
+	HOST_TEST_RUN( TestTwoPorts );
+	HOST_TEST_RUN( TestBusyFlagTwoPorts );
+
+	return HOST_TEST_RESULT();
+}
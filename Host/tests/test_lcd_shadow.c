@@ -0,0 +1,124 @@
+/***************************************************************************************
+ * @file        test_lcd_shadow.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the row order of the text written past the end of a row in
+ *              the shadow buffer.
+ * @remarks     Built with LCD_SHADOW_BUFFER. The LCD is the HD44780 model of
+ *              host_devices.h, 20x4 on a 4-bit parallel bus, where the DDRAM lines
+ *              hold the rows 0 and 2, then 1 and 3. The text must land where the
+ *              controller address counter puts it without the shadow.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Libraries/delay/delay.h>
+#include <Libraries/lcd/lcd.h>
+#include <Libraries/lcd/adapters/lcd_parallel_adapter.h>
+
+#include "host_devices.h"
+#include "host_test.h"
+
+#ifndef LCD_SHADOW_BUFFER
+#error "test_lcd_shadow is built with LCD_SHADOW_BUFFER"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_COLS 20U
+#define TEST_LINES 4U
+
+/*!< RS and E on PTB0..1, DB4..DB7 on PTB8..11. */
+static const hostHd44780Wiring_t _wiring = {
+	.rs = HOSTHD44780_PIN( HOSTSIM_PORT_B, 0U ), .rw = HOSTHD44780_NOT_WIRED,
+	.enable = HOSTHD44780_PIN( HOSTSIM_PORT_B, 1U ),
+	.data = {
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 8U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 9U ),
+		HOSTHD44780_PIN( HOSTSIM_PORT_B, 10U ), HOSTHD44780_PIN( HOSTSIM_PORT_B, 11U )
+	},
+	.dataCount = 4U
+};
+
+static hostHd44780_t g_lcd;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Gets an adapter pin, as an output.
+ */
+static lcdPin_t TestPin( uint8_t pin )
+{
+	const uint32_t mask = 1UL << ( pin & 31U );
+
+	GPIOB->PDDR |= mask;
+	return (lcdPin_t){ .portRegister = GPIOB, .pinMask = mask };
+}
+
+/**
+ * @brief Checks the characters shown from a cell.
+ */
+static void CheckScreen( uint8_t col, uint8_t row, const char *text )
+{
+	char screen[TEST_COLS * TEST_LINES];
+
+	HostHd44780_GetScreen( &g_lcd, TEST_COLS, TEST_LINES, screen );
+	HOST_TEST_CHECK( memcmp( &screen[row * TEST_COLS + col], text, strlen( text ) ) == 0 );
+}
+
+/**********************************************************************************/
+static void TestRowOrder( void )
+{
+	lcdPin_t data[4];
+
+	Delay_Init();
+	HostHd44780_Init( &g_lcd );
+	g_lcd.wiring = &_wiring;
+	for ( uint8_t i = 0; i < 4U; ++i )
+	{
+		data[i] = TestPin( _wiring.data[i] );
+	}
+	lcdPin_t rs = TestPin( _wiring.rs );
+	lcdPin_t en = TestPin( _wiring.enable );
+
+	lcdHandle_t handle = LCD_Init( LCD_CreateParallelAdapter( data, &rs, &en ), TEST_COLS, TEST_LINES,
+			LCD_5x8_DOTS );
+
+	HOST_TEST_CHECK( handle != NULL );
+
+	/* Row 0 goes on in row 2, then row 1 */
+	LCD_SetCursor( handle, 15U, 0U );
+	LCD_WriteString( handle, "abcde" "ABCDEFGHIJKLMNOPQRST" "fgh" );
+	/* Row 3 goes on in row 0 */
+	LCD_SetCursor( handle, 18U, 3U );
+	LCD_WriteString( handle, "xyz" );
+	LCD_Flush( handle );
+
+	CheckScreen( 15U, 0U, "abcde" );
+	CheckScreen( 0U, 2U, "ABCDEFGHIJKLMNOPQRST" );
+	CheckScreen( 0U, 1U, "fgh" );
+	CheckScreen( 18U, 3U, "xy" );
+	CheckScreen( 0U, 0U, "z" );
+	HOST_TEST_EQUAL( g_lcd.stats.ignored, 0U );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	/* Once: the GPIO listeners survive the simulator resets */
+	HostHd44780_Init( &g_lcd );
+	HostHd44780_AttachGpio( &g_lcd, &_wiring );
+
+	HOST_TEST_RUN( TestRowOrder );
+
+	return HOST_TEST_RESULT();
+}
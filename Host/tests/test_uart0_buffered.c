@@ -0,0 +1,186 @@
+/***************************************************************************************
+ * @file        test_uart0_buffered.c
+ * @version     1.0
+ * @date        10/16/2026
+ * @brief       Tests of the interrupt-driven buffered mode of UART0.
+ * @remarks     Streams a block at 115200 baud with the polled API and with the ring
+ *              buffers, sleeping with WFI when the Tx ring is full, and reports the
+ *              fraction of the time the CPU was idle in each case.
+ * @author      agent
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include <common.h>
+#include <Drivers/uart/uart0.h>
+#include <Libraries/stream/stream.h>
+
+#include "host_models.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_BAUD_RATE 115200U
+#define TEST_STREAM_LENGTH 1024U
+
+static uint8_t g_message[TEST_STREAM_LENGTH];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**********************************************************************************/
+static void InitUart( void )
+{
+	for ( size_t i = 0; i < sizeof(g_message); ++i )
+	{
+		g_message[i] = (uint8_t)( i * 7U + 3U );
+	}
+	UART0_SetClkSrc( UART0_CLOCK_FLL );
+	UART0_Init( TEST_BAUD_RATE, UART0_TX_RX_ENABLE, UART0_NO_PARITY, UART0_ONE_STOP_BIT );
+}
+
+/**********************************************************************************/
+static double IdleFraction( uint64_t startCycles, uint64_t startIdle )
+{
+	return (double)( HostSim_GetIdleCycles() - startIdle ) / (double)( HostSim_GetCycles() - startCycles );
+}
+
+/**********************************************************************************/
+static void TestPolledStreaming( void )
+{
+	InitUart();
+
+	const uint64_t cycles = HostSim_GetCycles();
+	const uint64_t idle = HostSim_GetIdleCycles();
+
+	for ( size_t i = 0; i < sizeof(g_message); ++i )
+	{
+		while ( !UART0_IsTxAvailable() ) {}
+		UART0_Write( g_message[i] );
+	}
+	while ( !( UART0->S1 & UART0_S1_TC_MASK ) ) {}
+
+	HOST_TEST_EQUAL( HostUart0_GetTxCount(), sizeof(g_message) );
+	HOST_TEST_CHECK( memcmp( HostUart0_GetTxData(), g_message, sizeof(g_message) ) == 0 );
+	printf( "  polled:   %u bytes in %.2f ms, CPU idle %.1f%%\n", TEST_STREAM_LENGTH,
+			(double)( HostSim_GetCycles() - cycles ) * 1000.0 / DEFAULT_SYSTEM_CLOCK,
+			100.0 * IdleFraction( cycles, idle ) );
+	HOST_TEST_CHECK( IdleFraction( cycles, idle ) == 0.0 );
+}
+
+/**********************************************************************************/
+static void TestBufferedStreaming( void )
+{
+	size_t sent = 0U;
+
+	InitUart();
+	UART0_EnableBufferedMode();
+
+	const uint64_t cycles = HostSim_GetCycles();
+	const uint64_t idle = HostSim_GetIdleCycles();
+
+	while ( sent < sizeof(g_message) )
+	{
+		sent += UART0_WriteBuffer( &g_message[sent], sizeof(g_message) - sent );
+		if ( sent < sizeof(g_message) )
+		{
+			__WFI();
+		}
+	}
+	while ( UART0_GetTxBufferFree() != UART0_TX_BUFFER_SIZE )
+	{
+		__WFI();
+	}
+	while ( !( UART0->S1 & UART0_S1_TC_MASK ) ) {}
+
+	HOST_TEST_EQUAL( HostUart0_GetTxCount(), sizeof(g_message) );
+	HOST_TEST_CHECK( memcmp( HostUart0_GetTxData(), g_message, sizeof(g_message) ) == 0 );
+	printf( "  buffered: %u bytes in %.2f ms, CPU idle %.1f%%\n", TEST_STREAM_LENGTH,
+			(double)( HostSim_GetCycles() - cycles ) * 1000.0 / DEFAULT_SYSTEM_CLOCK,
+			100.0 * IdleFraction( cycles, idle ) );
+	/* The line keeps the same rate as the polled loop */
+	HOST_TEST_CHECK( HostSim_GetCycles() - cycles < ( sizeof(g_message) + 1U ) * HostUart0_GetFrameCycles() );
+	/* One interrupt per byte, plus the last one that turns TIE off */
+	HOST_TEST_EQUAL( HostSim_GetExceptionCount(), sizeof(g_message) + 1U );
+	HOST_TEST_CHECK( IdleFraction( cycles, idle ) > 0.9 );
+}
+
+/**********************************************************************************/
+static void TestBufferedReception( void )
+{
+	uint8_t received[UART0_RX_BUFFER_SIZE];
+	size_t count = 0U;
+
+	InitUart();
+	UART0_EnableBufferedMode();
+
+	HostUart0_Inject( g_message, 20U );
+	while ( count < 20U )
+	{
+		__WFI();
+		count += UART0_ReadBuffer( &received[count], 20U - count );
+	}
+	HOST_TEST_CHECK( memcmp( received, g_message, 20U ) == 0 );
+	HOST_TEST_EQUAL( UART0_GetRxBufferOverrunCount(), 0U );
+	HOST_TEST_EQUAL( UART0_GetRxHwOverrunCount(), 0U );
+
+	/* Nobody reads: the bytes past the ring size are counted as lost */
+	HostUart0_Inject( g_message, UART0_RX_BUFFER_SIZE + 8U );
+	HostSim_Advance( ( UART0_RX_BUFFER_SIZE + 9U ) * HostUart0_GetFrameCycles() );
+	HOST_TEST_EQUAL( UART0_GetRxBufferCount(), UART0_RX_BUFFER_SIZE );
+	HOST_TEST_EQUAL( UART0_GetRxBufferOverrunCount(), 8U );
+	HOST_TEST_EQUAL( UART0_ReadBuffer( received, sizeof(received) ), UART0_RX_BUFFER_SIZE );
+	HOST_TEST_CHECK( memcmp( received, g_message, UART0_RX_BUFFER_SIZE ) == 0 );
+}
+
+/**********************************************************************************/
+static void TestStreamCallbacks( void )
+{
+	streamConfig_t *config = Stream_CreateConfig();
+	size_t sent = 0U;
+
+	InitUart();
+	UART0_EnableBufferedMode();
+
+	HOST_TEST_CHECK( config != NULL );
+	config->GetAvailToWrite = UART0_GetTxBufferFree;
+	config->GetBytesToRead = UART0_GetRxBufferCount;
+	config->Write = UART0_WriteBufferByte;
+	config->Read = UART0_ReadBufferByte;
+	config->WriteBlock = UART0_WriteBuffer;
+	config->ReadBlock = UART0_ReadBuffer;
+	config->newLine = (const unsigned char*)"\r\n";
+
+	streamHandle_t stream = Stream_Init( config );
+
+	while ( sent < 100U )
+	{
+		sent += Stream_WriteSome( stream, &g_message[sent], 100U - sent );
+		__WFI();
+	}
+	while ( UART0_GetTxBufferFree() != UART0_TX_BUFFER_SIZE )
+	{
+		__WFI();
+	}
+	HostSim_Advance( 2U * HostUart0_GetFrameCycles() );
+	HOST_TEST_EQUAL( HostUart0_GetTxCount(), 100U );
+	HOST_TEST_CHECK( memcmp( HostUart0_GetTxData(), g_message, 100U ) == 0 );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+int main( void )
+{
+	HOST_TEST_RUN( TestPolledStreaming );
+	HOST_TEST_RUN( TestBufferedStreaming );
+	HOST_TEST_RUN( TestBufferedReception );
+	HOST_TEST_RUN( TestStreamCallbacks );
+
+	return HOST_TEST_RESULT();
+}
@@ -20,7 +20,7 @@
 #ifndef DISPLAY_LIB_H_
 #define DISPLAY_LIB_H_
 
-#include "tftlcd_ili9341.h" /*Specific display driver header*/
+#include "../../ili9341/tftlcd_ili9341.h" /*Specific display driver header*/
 
 /*ABSTRACT TYPES*/
 /*=======================================================================================*/
@@ -76,7 +76,7 @@
 #include "font_CourierNew.h"
 #include "font_TimesNewRomanItalic.h"
 #include "ugui.h"
-#include "tftlcd_ili9341.h"
+#include "../../ili9341/tftlcd_ili9341.h"
 
 void UserPixelSetFunction( UG_S16 x , UG_S16 y ,UG_COLOR c )
 {
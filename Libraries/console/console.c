@@ -39,6 +39,11 @@
 /*!< A type for console handle structures. */
 struct consoleHandle{
 	consoleConfig_t* config; /*!< The console configuration structure. */
+	size_t newLineLength; /*!< The length of config->newLine, computed once in Console_Init. */
+#ifdef CONSOLE_PRINTF_BUFFER_SIZE
+	char printfBuffer[CONSOLE_PRINTF_BUFFER_SIZE]; /*!< Staging buffer of Console_Printf. */
+	size_t printfCount; /*!< The number of characters in printfBuffer. */
+#endif
 #if defined(__OS_PROJECT) && defined(CONSOLE_IS_REENTRANT)
 	osMutex_t consoleAccessMutex; /*!< Protect the console from race condition access. */
 #endif /* __OS_PROJECT */
@@ -66,11 +71,100 @@ static void SendESCPrefix( struct consoleHandle *consoleHandle )
 }
 
 
-void outPrintf( char character, void* arg )
+/*!< Write the fragments without locking the console. */
+static void WriteVUnlocked( struct consoleHandle *consoleHandle, const consoleIovec_t *iov, size_t n )
+{
+	size_t i;
+
+	for ( i = 0; i < n; ++i )
+	{
+		if ( iov[i].length != 0U )
+		{
+			Stream_WriteBlocking( consoleHandle->config->stream, (uint8_t*)iov[i].data, iov[i].length );
+		}
+	}
+}
+
+
+/*!< Lock the console. */
+static inline void ConsoleLock( struct consoleHandle *consoleHandle )
+{
+#if defined(__OS_PROJECT) && defined(CONSOLE_IS_REENTRANT)
+	OS_Mutex_Take(consoleHandle->consoleAccessMutex, OS_TIME_INFINITY);
+#else
+	(void)consoleHandle;
+#endif
+}
+
+
+/*!< Unlock the console. */
+static inline void ConsoleUnlock( struct consoleHandle *consoleHandle )
+{
+#if defined(__OS_PROJECT) && defined(CONSOLE_IS_REENTRANT)
+	OS_Mutex_Give(consoleHandle->consoleAccessMutex);
+#else
+	(void)consoleHandle;
+#endif
+}
+
+
+#ifdef CONSOLE_PRINTF_BUFFER_SIZE
+/*!< Send the characters in the Console_Printf staging buffer as one block. */
+static void FlushPrintfBuffer( struct consoleHandle *consoleHandle )
 {
-	struct consoleHandle *handle = arg;
+	const consoleIovec_t iov = { consoleHandle->printfBuffer, consoleHandle->printfCount };
 
-	Stream_WriteBlocking( handle->config->stream, &character, 1 );
+	WriteVUnlocked( consoleHandle, &iov, 1U );
+	consoleHandle->printfCount = 0U;
+}
+#endif
+
+
+/*!< The output of Console_Printf: stages the characters, which Console_Printf flushes at the end. */
+static void outPrintf( char character, void* arg )
+{
+#ifdef CONSOLE_PRINTF_BUFFER_SIZE
+	struct consoleHandle *consoleHandle = arg;
+
+	consoleHandle->printfBuffer[consoleHandle->printfCount++] = character;
+	if ( consoleHandle->printfCount == CONSOLE_PRINTF_BUFFER_SIZE )
+	{
+		FlushPrintfBuffer( consoleHandle );
+	}
+#else
+	const consoleIovec_t iov = { &character, 1U };
+
+	WriteVUnlocked( arg, &iov, 1U );
+#endif
+}
+
+/**********************************************************************************/
+int Console_Printf( consoleHandle_t handle, const char *format, ... )
+{
+	va_list va;
+	int ret;
+
+	ConsoleLock( handle );
+
+	va_start( va, format );
+	ret = vfctprintf( outPrintf, handle, format, va );
+	va_end( va );
+
+#ifdef CONSOLE_PRINTF_BUFFER_SIZE
+	FlushPrintfBuffer( handle );
+#endif
+
+	ConsoleUnlock( handle );
+
+	return ret;
+}
+
+/**********************************************************************************/
+void Console_WriteV( consoleHandle_t handle, const consoleIovec_t *iov, size_t n )
+{
+	ConsoleLock( handle );
+	WriteVUnlocked( handle, iov, n );
+	ConsoleUnlock( handle );
 }
 
 
@@ -78,7 +172,7 @@ void Console_PrintNum( consoleHandle_t handle, int32_t num, uint8_t base )
 {
 	char str[CONSOLE_MAX_NUMBER_BUFFER_LEN];
 
-	Util_IntToStr( num, str, base );
+	Util_IntToStr( num, (uint8_t*)str, base );
 	Console_Print( handle, str );
 }
 
@@ -87,7 +181,16 @@ void Console_PrintFloat( consoleHandle_t handle, float num, int afterPoint )
 {
 	char str[CONSOLE_MAX_NUMBER_BUFFER_LEN];
 
-	Util_FloatToStr( num, str, afterPoint );
+	Util_FloatToStr( num, (uint8_t*)str, afterPoint );
+	Console_Print( handle, str );
+}
+
+
+void Console_PrintFixed( consoleHandle_t handle, int32_t num, uint8_t fracBits, int afterPoint )
+{
+	char str[UTIL_FIXED_STR_MAX_LEN];
+
+	Util_FixedToStr( num, fracBits, (uint8_t*)str, afterPoint );
 	Console_Print( handle, str );
 }
 
@@ -139,6 +242,12 @@ consoleHandle_t Console_Init(consoleConfig_t *config)
 			if ( handle != NULL)
 			{
 				handle->config = config;
+#ifdef CONSOLE_PRINTF_BUFFER_SIZE
+				handle->printfCount = 0U;
+#endif
+				for ( handle->newLineLength = 0; config->newLine != NULL &&
+						config->newLine[handle->newLineLength] != '\0'; ++handle->newLineLength )
+				{}
 #if defined(__OS_PROJECT) && defined(CONSOLE_IS_REENTRANT)
 				handle->consoleAccessMutex = mtx;
 #endif // __OS_PROJECT
@@ -171,21 +280,12 @@ void Console_Scan( consoleHandle_t handle, char *str, size_t length )
 /**********************************************************************************/
 void Console_Print(consoleHandle_t handle, const char* str)
 {
-	struct consoleHandle *consoleHandle = handle;
+	consoleIovec_t iov = { str, 0U };
 
-	size_t i;
-	for(i = 0; str[i] != '\0'; ++i)
+	for( ; str[iov.length] != '\0'; ++iov.length)
 	{}
 
-#if defined(__OS_PROJECT) && defined(CONSOLE_IS_REENTRANT)
-	OS_Mutex_Take(consoleHandle->consoleAccessMutex, OS_TIME_INFINITY);
-#endif
-
-	Stream_WriteBlocking( consoleHandle->config->stream, (uint8_t*)str, i );
-
-#if defined(__OS_PROJECT) && defined(CONSOLE_IS_REENTRANT)
-	OS_Mutex_Give(consoleHandle->consoleAccessMutex);
-#endif
+	Console_WriteV( handle, &iov, 1U );
 }
 
 /**********************************************************************************/
@@ -205,7 +305,7 @@ void Console_Scanln(consoleHandle_t handle, char line[])
 	for ( int i = 0; ; ++i )
 	{
 		while( !Stream_GetBytesToRead(consoleHandle->config->stream ) );
-		Stream_Read( consoleHandle->config->stream, &line[i], 1 );
+		Stream_Read( consoleHandle->config->stream, (uint8_t*)&line[i], 1 );
 
 		int j;
 		for ( j = newLineSize - 1; j > -1; j-- )
@@ -234,27 +334,15 @@ void Console_Scanln(consoleHandle_t handle, char line[])
 void Console_Println(consoleHandle_t handle, const char* line)
 {
 	struct consoleHandle *consoleHandle = handle;
+	consoleIovec_t iov[2] = {
+		{ line, 0U },
+		{ consoleHandle->config->newLine, consoleHandle->newLineLength }
+	};
 
-#if defined(__OS_PROJECT) && defined(CONSOLE_IS_REENTRANT)
-	OS_Mutex_Take(consoleHandle->consoleAccessMutex, OS_TIME_INFINITY);
-#endif
-
-	size_t i;
-	for(i = 0; line[i] != '\0'; ++i)
+	for( ; line[iov[0].length] != '\0'; ++iov[0].length)
 	{}
 
-	Stream_WriteBlocking( consoleHandle->config->stream, (uint8_t*)line, i );
-
-	for ( int i = 0; consoleHandle->config->newLine[i]; ++i )
-	{
-		while( !Stream_GetAvailToWrite(consoleHandle->config->stream ) );
-		Stream_WriteBlocking( consoleHandle->config->stream, (uint8_t *)&consoleHandle->config->newLine[i], 1 );
-	}
-
-#if defined(__OS_PROJECT) && defined(CONSOLE_IS_REENTRANT)
-	OS_Mutex_Give(consoleHandle->consoleAccessMutex);
-#endif
-
+	Console_WriteV( handle, iov, 2U );
 }
 #endif
 
@@ -299,7 +387,7 @@ void Console_Clear( consoleHandle_t handle )
 	const char scapceSequence[] = { '2', 'J' };
 
 	SendESCPrefix( consoleHandle );
-	Stream_WriteBlocking( consoleHandle->config->stream, scapceSequence, 2 );
+	Stream_WriteBlocking( consoleHandle->config->stream, (const uint8_t*)scapceSequence, 2 );
 }
 
 /**********************************************************************************/
@@ -321,7 +409,7 @@ void Console_SetCursor( consoleHandle_t handle, consoleCursor_t direction, uint8
 	Console_PrintNum( handle, intervals, 10 );
 
 	char ch = (char)direction;
-	Stream_Write( consoleHandle->config->stream, &ch, 1 );
+	Stream_Write( consoleHandle->config->stream, (const uint8_t*)&ch, 1 );
 }
 
 /**********************************************************************************/
@@ -388,7 +476,7 @@ void Console_EraseLine( consoleHandle_t handle )
 
 	SendESCPrefix( consoleHandle );
 	char ch = 'K';
-	Stream_Write(handle, &ch, 1);
+	Stream_Write( consoleHandle->config->stream, (const uint8_t*)&ch, 1 );
 }
 
 #endif //CONSOLE_IS_ANSI
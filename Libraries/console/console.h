@@ -54,6 +54,10 @@
 /*!< The maximum length in bytes of the buffer that hold the string that
  * represents the number converted in "Console_PrintNum" or "Console_PrintFloat".*/
 #define CONSOLE_MAX_NUMBER_BUFFER_LEN (15U)
+/*!< The size in bytes of the per-console staging buffer filled by "Console_Printf".
+ * The formatted characters are sent to the stream as one block when the buffer is
+ * full or at the end of the call. Comment to send each character on its own.*/
+#define CONSOLE_PRINTF_BUFFER_SIZE (32U)
 /*!< Comment macros below to exclude the corresponding function from compile. */
 #define CONSOLE_PRINTLN_FUNCTION
 
@@ -96,8 +100,16 @@ typedef struct
 /*!< The handle that must be passed to the API to communicate with specific console module.*/
 typedef void* consoleHandle_t;
 
-/*!< A internally use function for printf purpose.*/
-void outPrintf( char character, void* arg );
+/*!
+ * @brief A fragment of a message for Console_WriteV.
+ */
+typedef struct
+{
+	/*!< The fragment bytes.*/
+	const void *data;
+	/*!< The fragment length in bytes.*/
+	size_t length;
+}consoleIovec_t;
 
 /*******************************************************************************
  * API
@@ -106,6 +118,8 @@ void outPrintf( char character, void* arg );
 /**
  * @brief A console printf implementation.
  *
+ * 		  The console is locked for the whole formatted message.
+ *
  * @param handle - The console handle.
  * @param format - A string that specifies the format of the output.
  * @param ...    - A list of values.
@@ -114,7 +128,20 @@ void outPrintf( char character, void* arg );
  *           if there was an output error.
  *
  */
-#define Console_Printf( handle, ... ) fctprintf( outPrintf, handle, __VA_ARGS__ )
+int Console_Printf( consoleHandle_t handle, const char *format, ... );
+
+/**
+ * @brief Write a message made of several fragments (scatter/gather).
+ *
+ * 		  The console is locked once and the fragments are sent in
+ * 		  order, each one as a single block to the stream.
+ *
+ * @param handle - The console handle.
+ * @param iov - The list of fragments.
+ * @param n - The number of fragments.
+ *
+ */
+void Console_WriteV( consoleHandle_t handle, const consoleIovec_t *iov, size_t n );
 
 /**
  * @brief Creates the structure to configure the console instance.
@@ -222,6 +249,20 @@ void Console_PrintNum( consoleHandle_t handle, int32_t num, uint8_t base );
  */
 void Console_PrintFloat( consoleHandle_t handle, float num, int afterPoint );
 
+/**
+ * @brief Sends a fixed-point (Q format) number as text to terminal.
+ *
+ * 		  Only integer arithmetic is used, so no floating-point
+ * 		  library is needed.
+ *
+ * @param handle - The console handle.
+ * @param num  - the fixed-point number.
+ * @param fracBits - number of fractional bits of num (ex.: 16 for Q16.16, 24 for Q8.24).
+ * @param afterPoint - number of digits to be considered after the point (0 to 9).
+ *
+ */
+void Console_PrintFixed( consoleHandle_t handle, int32_t num, uint8_t fracBits, int afterPoint );
+
 /**
  * @brief Play the console bell sound.
  *
@@ -0,0 +1,282 @@
+/**
+ * @file	display.c
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * A hardware abstraction layer for RGB565 display controllers.
+ */
+
+#include "display.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Display handle structure used internally
+ *
+ * The windows are always sent extended down to the last display row, so a
+ * memory write that ends a rectangle is already in the first pixel of the
+ * rectangle right below it, with the same columns.
+ */
+typedef struct
+{
+	/*!< The controller driver.*/
+	const displayDriver_t *driver;
+	/*!< The window requested and not sent yet.*/
+	uint16_t x;
+	uint16_t y;
+	uint16_t w;
+	bool windowPending;
+	/*!< If the controller memory write is open, in the window x/w.*/
+	bool writing;
+	/*!< The controller write position, valid if writing is true.*/
+	uint16_t row;
+	uint16_t col;
+}displayPrivateHandle_t;
+
+#ifdef DISPLAY_STATIC_OBJECTS_CREATION
+/*!< A list with all display handle structures used in application. */
+static displayPrivateHandle_t g_displayHandleList[DISPLAY_MAX_STATIC_OBJECTS];
+/*!< The number of handle structures created. */
+static uint8_t g_staticHandlesCreated;
+#endif
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Send the window requested, unless the controller already writes there.
+ */
+static void Display_StartWrite( displayPrivateHandle_t *display )
+{
+	if ( !display->windowPending )
+	{
+		return;
+	}
+	display->windowPending = false;
+
+	if ( display->writing && display->col == 0 && display->row == display->y )
+	{
+		/* Continuation of the previous window, nothing to send */
+		return;
+	}
+
+	display->driver->SetWindow( display->x, display->y, display->w, display->driver->height - display->y );
+	display->writing = true;
+	display->row = display->y;
+	display->col = 0;
+}
+
+/**
+ * @brief Advance the controller write position.
+ */
+static void Display_Advance( displayPrivateHandle_t *display, uint32_t count )
+{
+	uint32_t col, row;
+
+	if ( !display->writing )
+	{
+		return;
+	}
+
+	col = display->col + count;
+	row = display->row + col / display->w;
+
+	display->col = col % display->w;
+	if ( row >= display->driver->height )
+	{
+		/* The controller wrapped to the window top */
+		display->writing = false;
+	}
+	display->row = row;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+displayHandle_t Display_Init( const displayDriver_t *driver )
+{
+	displayPrivateHandle_t *display;
+
+	SYSTEM_ASSERT( driver );
+
+#ifdef	DISPLAY_STATIC_OBJECTS_CREATION
+	if ( g_staticHandlesCreated < DISPLAY_MAX_STATIC_OBJECTS )
+	{
+		display = &g_displayHandleList[g_staticHandlesCreated++];
+	}
+	else
+	{
+		display = NULL;
+	}
+#else
+	display = SYSTEM_MALLOC( sizeof ( displayPrivateHandle_t ) );
+#endif
+	if ( display != NULL )
+	{
+		display->driver = driver;
+		display->windowPending = false;
+		display->writing = false;
+	}
+	return display;
+}
+
+/**********************************************************************************/
+void Display_SetWindow( displayHandle_t handle, uint16_t x, uint16_t y, uint16_t w, uint16_t h )
+{
+	displayPrivateHandle_t *display = handle;
+
+	SYSTEM_ASSERT( w && h && ( x + w <= display->driver->width ) && ( y + h <= display->driver->height ) );
+
+	if ( display->writing && ( x != display->x || w != display->w ) )
+	{
+		/* Other columns, the write position can not be reused */
+		display->writing = false;
+	}
+
+	display->x = x;
+	display->y = y;
+	display->w = w;
+	display->windowPending = true;
+}
+
+/**********************************************************************************/
+void Display_WritePixels( displayHandle_t handle, const uint16_t *pixels, uint32_t count )
+{
+	displayPrivateHandle_t *display = handle;
+
+	if ( count == 0 )
+	{
+		return;
+	}
+
+	Display_StartWrite( display );
+	display->driver->WritePixels( pixels, count );
+	Display_Advance( display, count );
+}
+
+/**********************************************************************************/
+void Display_Flood( displayHandle_t handle, uint16_t color, uint32_t count )
+{
+	displayPrivateHandle_t *display = handle;
+
+	if ( count == 0 )
+	{
+		return;
+	}
+
+	Display_StartWrite( display );
+	display->driver->Flood( color, count );
+	Display_Advance( display, count );
+}
+
+/**********************************************************************************/
+void Display_FillRect( displayHandle_t handle, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color )
+{
+	displayPrivateHandle_t *display = handle;
+	int16_t x2 = x + w;
+	int16_t y2 = y + h;
+
+	/* Clipping */
+	if ( x < 0 )
+	{
+		x = 0;
+	}
+	if ( y < 0 )
+	{
+		y = 0;
+	}
+	if ( x2 > (int16_t)display->driver->width )
+	{
+		x2 = display->driver->width;
+	}
+	if ( y2 > (int16_t)display->driver->height )
+	{
+		y2 = display->driver->height;
+	}
+	if ( x >= x2 || y >= y2 )
+	{
+		return;
+	}
+
+	Display_SetWindow( handle, x, y, x2 - x, y2 - y );
+	Display_Flood( handle, color, (uint32_t)( x2 - x ) * ( y2 - y ) );
+}
+
+/**********************************************************************************/
+void Display_Blit( displayHandle_t handle, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels )
+{
+	displayPrivateHandle_t *display = handle;
+
+	if ( display->driver->Blit != NULL )
+	{
+		SYSTEM_ASSERT( w && h && ( x + w <= display->driver->width ) && ( y + h <= display->driver->height ) );
+
+		display->driver->Blit( x, y, w, h, pixels );
+		display->windowPending = false;
+		display->writing = false;
+		return;
+	}
+
+	Display_SetWindow( handle, x, y, w, h );
+	Display_WritePixels( handle, pixels, (uint32_t)w * h );
+}
+
+/**********************************************************************************/
+uint8_t Display_ScrollArea( displayHandle_t handle, uint16_t top, uint16_t height, uint16_t offset )
+{
+	displayPrivateHandle_t *display = handle;
+
+	if ( display->driver->ScrollArea == NULL )
+	{
+		return SYSTEM_STATUS_FAIL;
+	}
+
+	SYSTEM_ASSERT( ( top + height <= display->driver->height ) && ( offset < height ) );
+
+	/* The scroll commands end the memory write */
+	display->driver->ScrollArea( top, height, offset );
+	display->writing = false;
+
+	return SYSTEM_STATUS_SUCCESS;
+}
+
+/**********************************************************************************/
+void Display_Invalidate( displayHandle_t handle )
+{
+	displayPrivateHandle_t *display = handle;
+
+	display->writing = false;
+}
+
+/**********************************************************************************/
+uint16_t Display_GetWidth( displayHandle_t handle )
+{
+	return ( (displayPrivateHandle_t*)handle )->driver->width;
+}
+
+/**********************************************************************************/
+uint16_t Display_GetHeight( displayHandle_t handle )
+{
+	return ( (displayPrivateHandle_t*)handle )->driver->height;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file	display.h
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * A hardware abstraction layer for RGB565 display controllers.
+ */
+
+#ifndef LIBRARIES_DISPLAY_H_
+#define LIBRARIES_DISPLAY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <common.h>
+
+/*!
+ * @addtogroup display
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Defines if display instances will be created statically.
+ *   If commented, display instances will be allocated dynamically in heap. */
+#define DISPLAY_STATIC_OBJECTS_CREATION
+#define DISPLAY_MAX_STATIC_OBJECTS 1 /*!< The number of object instances that will be created statically.*/
+
+/*!< The controller drivers compiled with the HAL. Comment the ones not used,
+ *   since they share the same pins. */
+#define DISPLAY_USE_ILI9320
+//#define DISPLAY_USE_ILI9341
+
+/*!
+ * @brief Display controller driver
+ *
+ * All coordinates are in pixels, from the top left corner. The pixels of a
+ * window are written row by row and the controller wraps to the next row at
+ * the window right edge.
+ */
+typedef struct
+{
+	/*!< The display width and height in pixels.*/
+	uint16_t width;
+	uint16_t height;
+	/*!< Function pointer that sets a window and starts a memory write in its top left corner.*/
+	void ( *SetWindow )( uint16_t x, uint16_t y, uint16_t w, uint16_t h );
+	/*!< Function pointer that writes pixels, continuing the memory write.*/
+	void ( *WritePixels )( const uint16_t *pixels, uint32_t count );
+	/*!< Function pointer that writes count pixels of the same color, continuing the memory write.*/
+	void ( *Flood )( uint16_t color, uint32_t count );
+	/*!< Optional function pointer that writes a rectangle of pixels.
+	 *   If NULL, the "SetWindow" and "WritePixels" callbacks are used.*/
+	void ( *Blit )( uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels );
+	/*!< Optional function pointer that scrolls the rows from top to top + height - 1
+	 *   by offset rows in hardware. NULL if the controller can not do it.*/
+	void ( *ScrollArea )( uint16_t top, uint16_t height, uint16_t offset );
+}displayDriver_t;
+
+/*!< The handle that must be passed to the API to communicate with specific display.*/
+typedef void* displayHandle_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Initialize a display handle.
+ *
+ * The controller must be already initialized by its own driver.
+ *
+ * @param driver - the controller driver (e.g. g_displayIli9320Driver).
+ *
+ * @return - The display handle or;
+ *         - NULL if it was not possible to create the handle.
+ */
+displayHandle_t Display_Init( const displayDriver_t *driver );
+
+/**
+ * @brief Set the window where the next pixels are written.
+ *
+ * The window command is sent only when the pixels are written, and it is
+ * skipped if the controller is already writing where the window starts,
+ * e.g. a rectangle right below the previous one with the same columns.
+ *
+ * @param handle - the display handle.
+ * @param x - the window left column.
+ * @param y - the window top row.
+ * @param w - the window width, greater than 0.
+ * @param h - the window height, greater than 0.
+ */
+void Display_SetWindow( displayHandle_t handle, uint16_t x, uint16_t y, uint16_t w, uint16_t h );
+
+/**
+ * @brief Write pixels in the current window.
+ *
+ * @param handle - the display handle.
+ * @param pixels - the RGB565 pixels.
+ * @param count - the number of pixels.
+ */
+void Display_WritePixels( displayHandle_t handle, const uint16_t *pixels, uint32_t count );
+
+/**
+ * @brief Write pixels of the same color in the current window.
+ *
+ * @param handle - the display handle.
+ * @param color - the RGB565 color.
+ * @param count - the number of pixels.
+ */
+void Display_Flood( displayHandle_t handle, uint16_t color, uint32_t count );
+
+/**
+ * @brief Fill a rectangle, clipped to the display.
+ *
+ * @param handle - the display handle.
+ * @param x - the rectangle left column.
+ * @param y - the rectangle top row.
+ * @param w - the rectangle width.
+ * @param h - the rectangle height.
+ * @param color - the RGB565 color.
+ */
+void Display_FillRect( displayHandle_t handle, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color );
+
+/**
+ * @brief Write a rectangle of pixels inside the display.
+ *
+ * @param handle - the display handle.
+ * @param x - the rectangle left column.
+ * @param y - the rectangle top row.
+ * @param w - the rectangle width.
+ * @param h - the rectangle height.
+ * @param pixels - the w * h RGB565 pixels, row by row.
+ */
+void Display_Blit( displayHandle_t handle, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels );
+
+/**
+ * @brief Scroll an area of rows in hardware.
+ *
+ * @param handle - the display handle.
+ * @param top - the first row of the area.
+ * @param height - the number of rows of the area.
+ * @param offset - the row of the area shown at its top.
+ *
+ * @return
+ * 		- SYSTEM_STATUS_SUCCESS if the area was scrolled or;
+ * 		- SYSTEM_STATUS_FAIL if the controller can not scroll.
+ */
+uint8_t Display_ScrollArea( displayHandle_t handle, uint16_t top, uint16_t height, uint16_t offset );
+
+/**
+ * @brief Forget the controller write position.
+ *
+ * Must be called if the controller was accessed without the HAL, so the
+ * next window is always sent.
+ *
+ * @param handle - the display handle.
+ */
+void Display_Invalidate( displayHandle_t handle );
+
+/**
+ * @brief Get the display width.
+ *
+ * @param handle - the display handle.
+ *
+ * @return The width in pixels.
+ */
+uint16_t Display_GetWidth( displayHandle_t handle );
+
+/**
+ * @brief Get the display height.
+ *
+ * @param handle - the display handle.
+ *
+ * @return The height in pixels.
+ */
+uint16_t Display_GetHeight( displayHandle_t handle );
+
+/*! @}*/
+
+#endif /* LIBRARIES_DISPLAY_H_ */
@@ -0,0 +1,458 @@
+/**
+ * @file	display_list.c
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * A display list rendered in RAM bands, redrawing only dirty rectangles.
+ */
+
+#include "display_list.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< The kinds of items.*/
+enum
+{
+	DISPLAY_LIST_FILL_RECT,
+	DISPLAY_LIST_FRAME_RECT,
+	DISPLAY_LIST_BITMAP
+};
+
+/*!
+ * @brief A rectangle from (x0, y0) to (x1 - 1, y1 - 1).
+ */
+typedef struct
+{
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+}displayListRect_t;
+
+/*!
+ * @brief An item of the display list.
+ */
+typedef struct
+{
+	displayListRect_t bounds;  /*!< The item area. */
+	const uint8_t *bitmap;     /*!< The bits of a bitmap item. */
+	uint16_t color;            /*!< The item color. */
+	uint16_t background;       /*!< The bits cleared color of a bitmap item. */
+	uint8_t kind;              /*!< One of DISPLAY_LIST_FILL_RECT, ... */
+	bool visible;              /*!< If the item is drawn. */
+	bool transparent;          /*!< If the bits cleared of a bitmap item are not drawn. */
+}displayListItem_t;
+
+/*!
+ * @brief Display list handle structure used internally.
+ */
+typedef struct
+{
+	displayHandle_t display;                              /*!< The display. */
+	displayListItem_t items[DISPLAY_LIST_MAX_ITEMS];      /*!< The items, from bottom to top. */
+	displayListRect_t dirty[DISPLAY_LIST_MAX_DIRTY];      /*!< The areas to be redrawn. */
+	uint8_t itemCount;                                    /*!< The number of items. */
+	uint8_t dirtyCount;                                   /*!< The number of dirty rectangles. */
+	uint16_t background;                                  /*!< The background color. */
+}displayListPrivateHandle_t;
+
+/*!< A list with all display list structures used in application. */
+static displayListPrivateHandle_t g_displayListList[DISPLAY_LIST_MAX_OBJECTS];
+/*!< The number of display list structures created. */
+static uint8_t g_displayListsCreated;
+
+/*!< The band where the dirty rectangles are rasterized. */
+static uint16_t g_displayListBand[DISPLAY_LIST_MAX_WIDTH * DISPLAY_LIST_BAND_LINES];
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Get the area of a rectangle.
+ */
+static int32_t DisplayList_Area( const displayListRect_t *rect )
+{
+	return (int32_t)( rect->x1 - rect->x0 ) * ( rect->y1 - rect->y0 );
+}
+
+/**
+ * @brief Get the smallest rectangle that contains two rectangles.
+ */
+static displayListRect_t DisplayList_Union( const displayListRect_t *a, const displayListRect_t *b )
+{
+	displayListRect_t rect;
+
+	rect.x0 = ( a->x0 < b->x0 ) ? a->x0 : b->x0;
+	rect.y0 = ( a->y0 < b->y0 ) ? a->y0 : b->y0;
+	rect.x1 = ( a->x1 > b->x1 ) ? a->x1 : b->x1;
+	rect.y1 = ( a->y1 > b->y1 ) ? a->y1 : b->y1;
+
+	return rect;
+}
+
+/**
+ * @brief Intersect a rectangle with another one.
+ *
+ * @return false if the intersection is empty.
+ */
+static bool DisplayList_Clip( displayListRect_t *rect, const displayListRect_t *clip )
+{
+	if ( rect->x0 < clip->x0 ) rect->x0 = clip->x0;
+	if ( rect->y0 < clip->y0 ) rect->y0 = clip->y0;
+	if ( rect->x1 > clip->x1 ) rect->x1 = clip->x1;
+	if ( rect->y1 > clip->y1 ) rect->y1 = clip->y1;
+
+	return ( rect->x0 < rect->x1 ) && ( rect->y0 < rect->y1 );
+}
+
+/**
+ * @brief Add a dirty rectangle, merging it with the ones it overlaps or touches.
+ */
+static void DisplayList_AddDirty( displayListPrivateHandle_t *list, displayListRect_t rect )
+{
+	const displayListRect_t screen = { 0, 0, Display_GetWidth( list->display ), Display_GetHeight( list->display ) };
+	uint8_t i = 0;
+
+	if ( !DisplayList_Clip( &rect, &screen ) )
+	{
+		return;
+	}
+
+	/* A merged rectangle may touch others, so the search restarts */
+	while ( i < list->dirtyCount )
+	{
+		displayListRect_t *dirty = &list->dirty[i];
+
+		if ( rect.x0 <= dirty->x1 && dirty->x0 <= rect.x1 && rect.y0 <= dirty->y1 && dirty->y0 <= rect.y1 )
+		{
+			rect = DisplayList_Union( &rect, dirty );
+			list->dirty[i] = list->dirty[--list->dirtyCount];
+			i = 0;
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	if ( list->dirtyCount < DISPLAY_LIST_MAX_DIRTY )
+	{
+		list->dirty[list->dirtyCount++] = rect;
+		return;
+	}
+
+	/* Full: merged into the rectangle that grows less */
+	uint8_t best = 0;
+	int32_t bestGrowth = INT32_MAX;
+
+	for ( i = 0; i < list->dirtyCount; ++i )
+	{
+		displayListRect_t merged = DisplayList_Union( &rect, &list->dirty[i] );
+		int32_t growth = DisplayList_Area( &merged ) - DisplayList_Area( &list->dirty[i] );
+
+		if ( growth < bestGrowth )
+		{
+			bestGrowth = growth;
+			best = i;
+		}
+	}
+	rect = DisplayList_Union( &rect, &list->dirty[best] );
+	list->dirty[best] = list->dirty[--list->dirtyCount];
+	DisplayList_AddDirty( list, rect );
+}
+
+/**
+ * @brief Add an item on top of the list.
+ */
+static displayItem_t DisplayList_Add( displayListPrivateHandle_t *list, uint8_t kind,
+		int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color )
+{
+	displayListItem_t *item;
+
+	if ( list->itemCount >= DISPLAY_LIST_MAX_ITEMS )
+	{
+		return DISPLAY_LIST_NO_ITEM;
+	}
+
+	item = &list->items[list->itemCount];
+	item->bounds.x0 = x;
+	item->bounds.y0 = y;
+	item->bounds.x1 = x + w;
+	item->bounds.y1 = y + h;
+	item->bitmap = NULL;
+	item->color = color;
+	item->background = color;
+	item->kind = kind;
+	item->visible = true;
+	item->transparent = false;
+
+	DisplayList_AddDirty( list, item->bounds );
+
+	return list->itemCount++;
+}
+
+/**
+ * @brief Fill a rectangle of the band.
+ */
+static void DisplayList_FillBand( const displayListRect_t *band, displayListRect_t rect, uint16_t color )
+{
+	const int16_t width = band->x1 - band->x0;
+
+	if ( !DisplayList_Clip( &rect, band ) )
+	{
+		return;
+	}
+
+	for ( int16_t y = rect.y0; y < rect.y1; ++y )
+	{
+		uint16_t *pixel = &g_displayListBand[( y - band->y0 ) * width + ( rect.x0 - band->x0 )];
+
+		for ( int16_t x = rect.x0; x < rect.x1; ++x )
+		{
+			*pixel++ = color;
+		}
+	}
+}
+
+/**
+ * @brief Rasterize an item in the band.
+ */
+static void DisplayList_DrawItem( const displayListRect_t *band, const displayListItem_t *item )
+{
+	const displayListRect_t *bounds = &item->bounds;
+	displayListRect_t rect = *bounds;
+
+	switch ( item->kind )
+	{
+	case DISPLAY_LIST_FILL_RECT:
+		DisplayList_FillBand( band, rect, item->color );
+		break;
+
+	case DISPLAY_LIST_FRAME_RECT:
+	{
+		const displayListRect_t top = { bounds->x0, bounds->y0, bounds->x1, bounds->y0 + 1 };
+		const displayListRect_t bottom = { bounds->x0, bounds->y1 - 1, bounds->x1, bounds->y1 };
+		const displayListRect_t left = { bounds->x0, bounds->y0, bounds->x0 + 1, bounds->y1 };
+		const displayListRect_t right = { bounds->x1 - 1, bounds->y0, bounds->x1, bounds->y1 };
+
+		DisplayList_FillBand( band, top, item->color );
+		DisplayList_FillBand( band, bottom, item->color );
+		DisplayList_FillBand( band, left, item->color );
+		DisplayList_FillBand( band, right, item->color );
+		break;
+	}
+
+	case DISPLAY_LIST_BITMAP:
+	{
+		const int16_t width = band->x1 - band->x0;
+		const uint16_t stride = ( bounds->x1 - bounds->x0 + 7 ) / 8;
+
+		if ( !DisplayList_Clip( &rect, band ) )
+		{
+			break;
+		}
+
+		for ( int16_t y = rect.y0; y < rect.y1; ++y )
+		{
+			const uint8_t *bits = &item->bitmap[( y - bounds->y0 ) * stride];
+			uint16_t *pixel = &g_displayListBand[( y - band->y0 ) * width + ( rect.x0 - band->x0 )];
+
+			for ( int16_t x = rect.x0; x < rect.x1; ++x, ++pixel )
+			{
+				uint16_t bit = x - bounds->x0;
+
+				if ( bits[bit >> 3] & ( 0x80 >> ( bit & 7 ) ) )
+				{
+					*pixel = item->color;
+				}
+				else if ( !item->transparent )
+				{
+					*pixel = item->background;
+				}
+			}
+		}
+		break;
+	}
+	}
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+displayListHandle_t DisplayList_Init( displayHandle_t display, uint16_t background )
+{
+	displayListPrivateHandle_t *list;
+	displayListRect_t screen;
+
+	SYSTEM_ASSERT( display );
+	SYSTEM_ASSERT( Display_GetWidth( display ) <= DISPLAY_LIST_MAX_WIDTH );
+
+	if ( g_displayListsCreated >= DISPLAY_LIST_MAX_OBJECTS )
+	{
+		return NULL;
+	}
+	list = &g_displayListList[g_displayListsCreated++];
+
+	list->display = display;
+	list->itemCount = 0;
+	list->dirtyCount = 0;
+	list->background = background;
+
+	screen.x0 = 0;
+	screen.y0 = 0;
+	screen.x1 = Display_GetWidth( display );
+	screen.y1 = Display_GetHeight( display );
+	DisplayList_AddDirty( list, screen );
+
+	return list;
+}
+
+/**********************************************************************************/
+displayItem_t DisplayList_AddFillRect( displayListHandle_t list, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color )
+{
+	return DisplayList_Add( list, DISPLAY_LIST_FILL_RECT, x, y, w, h, color );
+}
+
+/**********************************************************************************/
+displayItem_t DisplayList_AddFrameRect( displayListHandle_t list, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color )
+{
+	return DisplayList_Add( list, DISPLAY_LIST_FRAME_RECT, x, y, w, h, color );
+}
+
+/**********************************************************************************/
+displayItem_t DisplayList_AddBitmap( displayListHandle_t list, int16_t x, int16_t y, uint16_t w, uint16_t h,
+		const uint8_t *bitmap, uint16_t color, uint16_t background, bool transparent )
+{
+	displayListPrivateHandle_t *displayList = list;
+	displayItem_t item = DisplayList_Add( displayList, DISPLAY_LIST_BITMAP, x, y, w, h, color );
+
+	if ( item != DISPLAY_LIST_NO_ITEM )
+	{
+		displayList->items[item].bitmap = bitmap;
+		displayList->items[item].background = background;
+		displayList->items[item].transparent = transparent;
+	}
+	return item;
+}
+
+/**********************************************************************************/
+void DisplayList_Move( displayListHandle_t list, displayItem_t item, int16_t x, int16_t y )
+{
+	displayListPrivateHandle_t *displayList = list;
+	displayListRect_t *bounds = &displayList->items[item].bounds;
+
+	SYSTEM_ASSERT( item < displayList->itemCount );
+
+	/* The old and the new places */
+	DisplayList_AddDirty( displayList, *bounds );
+	bounds->x1 += x - bounds->x0;
+	bounds->y1 += y - bounds->y0;
+	bounds->x0 = x;
+	bounds->y0 = y;
+	DisplayList_AddDirty( displayList, *bounds );
+}
+
+/**********************************************************************************/
+void DisplayList_SetColor( displayListHandle_t list, displayItem_t item, uint16_t color )
+{
+	displayListPrivateHandle_t *displayList = list;
+
+	SYSTEM_ASSERT( item < displayList->itemCount );
+
+	if ( displayList->items[item].color != color )
+	{
+		displayList->items[item].color = color;
+		DisplayList_AddDirty( displayList, displayList->items[item].bounds );
+	}
+}
+
+/**********************************************************************************/
+void DisplayList_SetBitmap( displayListHandle_t list, displayItem_t item, const uint8_t *bitmap )
+{
+	displayListPrivateHandle_t *displayList = list;
+
+	SYSTEM_ASSERT( item < displayList->itemCount );
+
+	if ( displayList->items[item].bitmap != bitmap )
+	{
+		displayList->items[item].bitmap = bitmap;
+		DisplayList_AddDirty( displayList, displayList->items[item].bounds );
+	}
+}
+
+/**********************************************************************************/
+void DisplayList_SetVisible( displayListHandle_t list, displayItem_t item, bool visible )
+{
+	displayListPrivateHandle_t *displayList = list;
+
+	SYSTEM_ASSERT( item < displayList->itemCount );
+
+	if ( displayList->items[item].visible != visible )
+	{
+		displayList->items[item].visible = visible;
+		DisplayList_AddDirty( displayList, displayList->items[item].bounds );
+	}
+}
+
+/**********************************************************************************/
+void DisplayList_Invalidate( displayListHandle_t list, int16_t x, int16_t y, uint16_t w, uint16_t h )
+{
+	const displayListRect_t rect = { x, y, x + w, y + h };
+
+	DisplayList_AddDirty( list, rect );
+}
+
+/**********************************************************************************/
+void DisplayList_Render( displayListHandle_t list )
+{
+	displayListPrivateHandle_t *displayList = list;
+
+	for ( uint8_t d = 0; d < displayList->dirtyCount; ++d )
+	{
+		const displayListRect_t *dirty = &displayList->dirty[d];
+		const int16_t width = dirty->x1 - dirty->x0;
+		/* Narrower rectangles fit more lines in the band */
+		const int16_t lines = ( DISPLAY_LIST_MAX_WIDTH * DISPLAY_LIST_BAND_LINES ) / width;
+		displayListRect_t band = *dirty;
+
+		for ( band.y0 = dirty->y0; band.y0 < dirty->y1; band.y0 = band.y1 )
+		{
+			band.y1 = ( band.y0 + lines < dirty->y1 ) ? band.y0 + lines : dirty->y1;
+
+			DisplayList_FillBand( &band, band, displayList->background );
+			for ( uint8_t i = 0; i < displayList->itemCount; ++i )
+			{
+				if ( displayList->items[i].visible )
+				{
+					DisplayList_DrawItem( &band, &displayList->items[i] );
+				}
+			}
+
+			/* Bands of the same rectangle continue the same memory write */
+			Display_Blit( displayList->display, band.x0, band.y0, width, band.y1 - band.y0, g_displayListBand );
+		}
+	}
+
+	displayList->dirtyCount = 0;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file	display_list.h
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * A display list rendered in RAM bands, redrawing only dirty rectangles.
+ */
+
+#ifndef LIBRARIES_DISPLAY_LIST_H_
+#define LIBRARIES_DISPLAY_LIST_H_
+
+#include "display.h"
+
+/*!
+ * @addtogroup display
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< The number of display lists that can be created.*/
+#define DISPLAY_LIST_MAX_OBJECTS 1
+/*!< The maximum number of items of a display list.*/
+#define DISPLAY_LIST_MAX_ITEMS 16
+/*!< The maximum number of dirty rectangles. When there are more, the ones
+ *   that grow less are merged.*/
+#define DISPLAY_LIST_MAX_DIRTY 4
+/*!< The widest display the lists are used with, in pixels: 320 for the ILI9320,
+ *   240 for the ILI9341 in portrait.*/
+#define DISPLAY_LIST_MAX_WIDTH 320
+/*!< The height of the RAM band in lines of DISPLAY_LIST_MAX_WIDTH. The band takes
+ *   2 * DISPLAY_LIST_MAX_WIDTH * DISPLAY_LIST_BAND_LINES bytes of RAM: 640 bytes
+ *   per line at 320 pixels, 1/6 of the 4 KB of the KL05Z32. Each band is one more
+ *   pass over the items, but the bus traffic does not change: the bands of a
+ *   rectangle continue its memory write.*/
+#define DISPLAY_LIST_BAND_LINES 1
+
+/*!< The item identifier returned when the list is full.*/
+#define DISPLAY_LIST_NO_ITEM 0xFF
+
+/*!< The identifier of an item of a display list.*/
+typedef uint8_t displayItem_t;
+
+/*!< The handle that must be passed to the API to communicate with specific display list.*/
+typedef void* displayListHandle_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Create an empty display list.
+ *
+ * The whole display is marked dirty, so the first render draws the background.
+ *
+ * @param display - the display handle.
+ * @param background - the RGB565 color where there are no items.
+ *
+ * @return - The display list handle or;
+ *         - NULL if it was not possible to create the handle.
+ */
+displayListHandle_t DisplayList_Init( displayHandle_t display, uint16_t background );
+
+/**
+ * @brief Add a filled rectangle on top of the list.
+ *
+ * @param list - the display list handle.
+ * @param x, y - the rectangle top left corner.
+ * @param w, h - the rectangle dimensions.
+ * @param color - the RGB565 color.
+ *
+ * @return The item, or DISPLAY_LIST_NO_ITEM if the list is full.
+ */
+displayItem_t DisplayList_AddFillRect( displayListHandle_t list, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color );
+
+/**
+ * @brief Add a one pixel rectangle outline on top of the list.
+ *
+ * @param list - the display list handle.
+ * @param x, y - the rectangle top left corner.
+ * @param w, h - the rectangle dimensions.
+ * @param color - the RGB565 color.
+ *
+ * @return The item, or DISPLAY_LIST_NO_ITEM if the list is full.
+ */
+displayItem_t DisplayList_AddFrameRect( displayListHandle_t list, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color );
+
+/**
+ * @brief Add a monochrome bitmap (e.g. a text glyph or an icon) on top of the list.
+ *
+ * @param list - the display list handle.
+ * @param x, y - the bitmap top left corner.
+ * @param w, h - the bitmap dimensions.
+ * @param bitmap - the bits, row by row, each row starting in a new byte, MSB first.
+ *                 It is kept by the caller.
+ * @param color - the RGB565 color of the bits set.
+ * @param background - the RGB565 color of the bits cleared.
+ * @param transparent - if true, the bits cleared are not drawn.
+ *
+ * @return The item, or DISPLAY_LIST_NO_ITEM if the list is full.
+ */
+displayItem_t DisplayList_AddBitmap( displayListHandle_t list, int16_t x, int16_t y, uint16_t w, uint16_t h,
+		const uint8_t *bitmap, uint16_t color, uint16_t background, bool transparent );
+
+/**
+ * @brief Move an item.
+ *
+ * @param list - the display list handle.
+ * @param item - the item.
+ * @param x, y - the new top left corner.
+ */
+void DisplayList_Move( displayListHandle_t list, displayItem_t item, int16_t x, int16_t y );
+
+/**
+ * @brief Change the color of an item.
+ *
+ * @param list - the display list handle.
+ * @param item - the item.
+ * @param color - the new RGB565 color.
+ */
+void DisplayList_SetColor( displayListHandle_t list, displayItem_t item, uint16_t color );
+
+/**
+ * @brief Change the bits of a bitmap item, with the same dimensions.
+ *
+ * @param list - the display list handle.
+ * @param item - the bitmap item.
+ * @param bitmap - the new bits.
+ */
+void DisplayList_SetBitmap( displayListHandle_t list, displayItem_t item, const uint8_t *bitmap );
+
+/**
+ * @brief Show or hide an item.
+ *
+ * @param list - the display list handle.
+ * @param item - the item.
+ * @param visible - true to show it.
+ */
+void DisplayList_SetVisible( displayListHandle_t list, displayItem_t item, bool visible );
+
+/**
+ * @brief Mark an area to be redrawn by the next render.
+ *
+ * @param list - the display list handle.
+ * @param x, y - the area top left corner.
+ * @param w, h - the area dimensions.
+ */
+void DisplayList_Invalidate( displayListHandle_t list, int16_t x, int16_t y, uint16_t w, uint16_t h );
+
+/**
+ * @brief Redraw the dirty rectangles.
+ *
+ * Each dirty rectangle is rasterized in bands of DISPLAY_LIST_BAND_LINES
+ * display lines and each band is written in one burst.
+ *
+ * @param list - the display list handle.
+ */
+void DisplayList_Render( displayListHandle_t list );
+
+/*! @}*/
+
+#endif /* LIBRARIES_DISPLAY_LIST_H_ */
@@ -0,0 +1,70 @@
+/**
+ * @file	display_ili9320.c
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * ILI9320 driver of the display HAL.
+ */
+
+#include "display_ili9320.h"
+
+#ifdef DISPLAY_USE_ILI9320
+
+#include "libraries/ili9320/ili9320.h"
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Set the GRAM window and start writing in its top left corner.
+ */
+static void Display_Ili9320SetWindow( uint16_t x, uint16_t y, uint16_t w, uint16_t h )
+{
+	ili9320_SetDisplayWindow( x, y, w, h );
+	ili9320_SetCursor( x, y );
+	LCD_IO_WriteReg( LCD_REG_34 );
+}
+
+/**
+ * @brief Write pixels in the GRAM.
+ */
+static void Display_Ili9320WritePixels( const uint16_t *pixels, uint32_t count )
+{
+	LCD_IO_WriteMultipleData( (uint8_t*)pixels, count * 2 );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* The hardware scroll of the ILI9320 moves whole gate lines, which are the
+ * display columns in this orientation, so it is not used. */
+const displayDriver_t g_displayIli9320Driver =
+{
+	.width = ILI9320_LCD_PIXEL_WIDTH,
+	.height = ILI9320_LCD_PIXEL_HEIGHT,
+	.SetWindow = Display_Ili9320SetWindow,
+	.WritePixels = Display_Ili9320WritePixels,
+	.Flood = LCD_IO_Flood,
+	.Blit = NULL,
+	.ScrollArea = NULL,
+};
+
+#endif /* DISPLAY_USE_ILI9320 */
@@ -0,0 +1,128 @@
+/**
+ * @file	display_ili9341.c
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * ILI9341 driver of the display HAL.
+ */
+
+#include "display_ili9341.h"
+
+#ifdef DISPLAY_USE_ILI9341
+
+#include "libraries/ili9341/tftlcd_ili9341.h"
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Set the address window and start writing in its top left corner.
+ */
+static void Display_Ili9341SetWindow( uint16_t x, uint16_t y, uint16_t w, uint16_t h )
+{
+	tftLcd_SetAddrWindow( x, y, x + w - 1, y + h - 1 );
+	tftLcd_WriteCommand( tftMEMORYWRITE_REG, NULL, 0 );
+}
+
+/**
+ * @brief Write pixels in the memory, most significant byte first.
+ */
+static void Display_Ili9341WritePixels( const uint16_t *pixels, uint32_t count )
+{
+	while ( count-- )
+	{
+		uint8_t high = (uint8_t)( *pixels >> 8 );
+		uint8_t low = (uint8_t)*pixels;
+
+		tftLcd_Write8( high );
+		tftLcd_Write8( low );
+		++pixels;
+	}
+}
+
+/**
+ * @brief Write pixels of the same color, without the memory write command
+ *        of tftLcd_Flood, so the write position is kept.
+ */
+static void Display_Ili9341Flood( uint16_t color, uint32_t count )
+{
+	uint8_t high = (uint8_t)( color >> 8 );
+	uint8_t low = (uint8_t)color;
+
+	if ( high == low )
+	{
+		/* The data lines keep the byte, only the strobe is toggled */
+		tftLcd_Write8( high );
+		tftLcd_WriteStrobe();
+		while ( --count )
+		{
+			tftLcd_WriteStrobe();
+			tftLcd_WriteStrobe();
+		}
+		return;
+	}
+
+	while ( count-- )
+	{
+		tftLcd_Write8( high );
+		tftLcd_Write8( low );
+	}
+}
+
+/**
+ * @brief Scroll rows with the vertical scrolling definition.
+ */
+static void Display_Ili9341ScrollArea( uint16_t top, uint16_t height, uint16_t offset )
+{
+	uint16_t bottom = tftHEIGHT - top - height;
+	uint16_t start = top + offset;
+	uint8_t param[6];
+
+	/* Top fixed area, scroll area and bottom fixed area, MSB first */
+	param[0] = (uint8_t)( top >> 8 );
+	param[1] = (uint8_t)top;
+	param[2] = (uint8_t)( height >> 8 );
+	param[3] = (uint8_t)height;
+	param[4] = (uint8_t)( bottom >> 8 );
+	param[5] = (uint8_t)bottom;
+	tftLcd_WriteCommand( tftVSCROLLDEF_REG, param, 6 );
+
+	param[0] = (uint8_t)( start >> 8 );
+	param[1] = (uint8_t)start;
+	tftLcd_WriteCommand( tftVSCROLLSTART_REG, param, 2 );
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* The dimensions are the ones of the default rotation (tftLcd_SetRotation(0)) */
+const displayDriver_t g_displayIli9341Driver =
+{
+	.width = tftWIDTH,
+	.height = tftHEIGHT,
+	.SetWindow = Display_Ili9341SetWindow,
+	.WritePixels = Display_Ili9341WritePixels,
+	.Flood = Display_Ili9341Flood,
+	.Blit = NULL,
+	.ScrollArea = Display_Ili9341ScrollArea,
+};
+
+#endif /* DISPLAY_USE_ILI9341 */
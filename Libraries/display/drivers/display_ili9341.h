@@ -0,0 +1,44 @@
+/**
+ * @file	display_ili9341.h
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * ILI9341 driver of the display HAL.
+ */
+
+#ifndef LIBRARIES_DISPLAY_ILI9341_H_
+#define LIBRARIES_DISPLAY_ILI9341_H_
+
+#include "../display.h"
+
+/*!
+ * @addtogroup display
+ * @{
+ */
+
+#ifdef DISPLAY_USE_ILI9341
+
+/*!< The ILI9341 driver, to be passed to Display_Init after the controller initialization.*/
+extern const displayDriver_t g_displayIli9341Driver;
+
+#endif /* DISPLAY_USE_ILI9341 */
+
+/*! @}*/
+
+#endif /* LIBRARIES_DISPLAY_ILI9341_H_ */
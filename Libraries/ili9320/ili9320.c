@@ -76,43 +76,11 @@
   * @}
   */  
 
-
-#define tftLcdRDX_ClrVal() GPIOB->PCOR = 1 << 8
-#define tftLcdRDX_SetVal() GPIOB->PSOR = 1 << 8
-#define tftLcdWRX_ClrVal() GPIOB->PCOR = 1 << 9
-#define tftLcdWRX_SetVal() GPIOB->PSOR = 1 << 9
-#define tftLcdDCX_ClrVal() GPIOA->PCOR = 1 << 8
-#define tftLcdDCX_SetVal() GPIOA->PSOR = 1 << 8
-#define tftLcdCSX_ClrVal() GPIOA->PCOR = 1 << 0
-#define tftLcdCSX_SetVal() GPIOA->PSOR = 1 << 0
-
-#define tftLcdData0_PutVal(x) {if ( x ) GPIOB->PSOR = 1 << 10; else GPIOB->PCOR = 1 << 10;}
-#define tftLcdData1_PutVal(x)  {if ( x ) GPIOB->PSOR = 1 << 11; else GPIOB->PCOR = 1 << 11;}
-#define tftLcdData2_PutVal(x)  {if ( x ) GPIOA->PSOR = 1 << 11; else GPIOA->PCOR = 1 << 11;}
-#define tftLcdData3_PutVal(x)  {if ( x ) GPIOB->PSOR = 1 << 5; else GPIOB->PCOR = 1 << 5;}
-#define tftLcdData4_PutVal(x)  {if ( x ) GPIOA->PSOR = 1 << 10; else GPIOA->PCOR = 1 << 10;}
-#define tftLcdData5_PutVal(x)  {if ( x ) GPIOA->PSOR = 1 << 12; else GPIOA->PCOR = 1 << 12;}
-#define tftLcdData6_PutVal(x)  {if ( x ) GPIOB->PSOR = 1 << 6; else GPIOB->PCOR = 1 << 6;}
-#define tftLcdData7_PutVal(x)  {if ( x ) GPIOB->PSOR = 1 << 7; else GPIOB->PCOR = 1 << 7;}
-
-
-#define tftLcd_ReadIdle(void)			tftLcdRDX_SetVal();
-#define tftLcd_WriteActive(void)		tftLcdWRX_ClrVal();
-#define tftLcd_WriteIdle(void)			tftLcdWRX_SetVal();
-#define tftLcd_SetCommandMode(void)		tftLcdDCX_ClrVal();
-#define tftLcd_SetDataMode(void)		tftLcdDCX_SetVal();
-#define tftLcd_ChipSelectActive(void)	tftLcdCSX_ClrVal();
-#define tftLcd_ChipSelectIdle(void)		tftLcdCSX_SetVal();
-
-// Data write strobe, ~2 instructions and always inline
-#define tftLcd_WriteStrobe(void) { tftLcd_WriteActive(); tftLcd_WriteIdle(); }
-
 /** @defgroup ILI9320_Private_Variables
   * @{
   */ 
 
 static uint8_t Is_ili9320_Initialized = 0;
-static uint16_t ArrayRGB[320] = {0};
 
 /**
   * @}
@@ -405,7 +373,7 @@ void ili9320_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint
 }
 
 /**
-  * @brief  Draw vertical line.
+  * @brief  Draw horizontal line.
   * @param  RGBCode: Specifies the RGB color   
   * @param  Xpos:     specifies the X position.
   * @param  Ypos:     specifies the Y position.
@@ -414,21 +382,7 @@ void ili9320_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint
   */
 void ili9320_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint16_t counter = 0;
-  
-  /* Set Cursor */
-  ili9320_SetCursor(Xpos, Ypos); 
-  
-  /* Prepare to write GRAM */
-  LCD_IO_WriteReg(LCD_REG_34);
-
-  /* Sent a complete line */
-  for(counter = 0; counter < Length; counter++)
-  {
-    ArrayRGB[counter] = RGBCode;
-  }  
-
-  LCD_IO_WriteMultipleData((uint8_t*)&ArrayRGB[0], Length * 2);
+  ili9320_FillRect(RGBCode, Xpos, Ypos, Length, 1);
 }
 
 /**
@@ -441,31 +395,40 @@ void ili9320_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t
   */
 void ili9320_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint16_t counter = 0;
+  ili9320_FillRect(RGBCode, Xpos, Ypos, 1, Length);
+}
+
+/**
+  * @brief  Fill a rectangle with a solid color.
+  * @note   The pixels are streamed inside a display window, so no RAM
+  *         buffer is used.
+  * @param  RGBCode: Specifies the RGB color
+  * @param  Xpos:    specifies the X position.
+  * @param  Ypos:    specifies the Y position.
+  * @param  Width:   rectangle width.
+  * @param  Height:  rectangle height.
+  * @retval None
+  */
+void ili9320_FillRect(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  if((Width == 0) || (Height == 0))
+  {
+    return;
+  }
+
+  /* The address counter wraps inside the window */
+  ili9320_SetDisplayWindow(Xpos, Ypos, Width, Height);
 
-  /* set GRAM write direction and BGR = 1 */
-  /* I/D=00 (Horizontal : increment, Vertical : decrement) */
-  /* AM=1 (address is updated in vertical writing direction) */
-  ili9320_WriteReg(LCD_REG_3, 0x1010);
-  
   /* Set Cursor */
   ili9320_SetCursor(Xpos, Ypos);
-  
+
   /* Prepare to write GRAM */
   LCD_IO_WriteReg(LCD_REG_34);
 
-  /* Fill a complete vertical line */
-  for(counter = 0; counter < Length; counter++)
-  {
-    ArrayRGB[counter] = RGBCode;
-  }
-  
-  LCD_IO_WriteMultipleData((uint8_t*)&ArrayRGB[0], Length * 2);
-  
-  /* set GRAM write direction and BGR = 1 */
-  /* I/D=00 (Horizontal : increment, Vertical : decrement) */
-  /* AM=1 (address is updated in vertical writing direction) */
-  ili9320_WriteReg(LCD_REG_3, 0x1018);  
+  LCD_IO_Flood(RGBCode, (uint32_t)Width * Height);
+
+  /* Back to the whole GRAM */
+  ili9320_SetDisplayWindow(0, 0, ILI9320_LCD_PIXEL_WIDTH, ILI9320_LCD_PIXEL_HEIGHT);
 }
 
 /**
@@ -529,50 +492,6 @@ void ili9320_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t
   LCD_IO_WriteMultipleData((uint8_t*)pdata, size*2);
 }
 
-
-
-/* LCD IO functions */
-void     LCD_IO_Init(void)
-{
-
-}
-
-void     LCD_IO_WriteMultipleData(uint8_t *pData, uint32_t Size)
-{
-	for ( int i = 0; i < Size; ++i )
-	{
-		tftLcdData0_PutVal((pData[i] & 0x01));\
-		tftLcdData1_PutVal((pData[i] & 0x02));\
-		tftLcdData2_PutVal((pData[i] & 0x04));\
-		tftLcdData3_PutVal((pData[i] & 0x08));\
-		tftLcdData4_PutVal((pData[i] & 0x10));\
-		tftLcdData5_PutVal((pData[i] & 0x20));\
-		tftLcdData6_PutVal((pData[i] & 0x40));\
-		tftLcdData7_PutVal((pData[i] & 0x80));\
-		Delay_Waitus(10);\
-		tftLcd_WriteStrobe(); /*Generates the falling edge for LCD latches the write data*/\
-	}
-}
-
-void     LCD_IO_WriteReg(uint8_t Reg)
-{
-	tftLcdData0_PutVal((Reg & 0x01));\
-	tftLcdData1_PutVal((Reg & 0x02));\
-	tftLcdData2_PutVal((Reg & 0x04));\
-	tftLcdData3_PutVal((Reg & 0x08));\
-	tftLcdData4_PutVal((Reg & 0x10));\
-	tftLcdData5_PutVal((Reg & 0x20));\
-	tftLcdData6_PutVal((Reg & 0x40));\
-	tftLcdData7_PutVal((Reg & 0x80));\
-	Delay_Waitus(10);\
-	tftLcd_WriteStrobe(); /*Generates the falling edge for LCD latches the write data*/\
-}
-
-uint16_t LCD_IO_ReadData(uint16_t Reg)
-{
-
-}
-
 /**
   * @}
   */ 
@@ -218,6 +218,7 @@ void     ili9320_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint1
 void     ili9320_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
 void     ili9320_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp);
 void     ili9320_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint8_t *pdata);
+void     ili9320_FillRect(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 
 void     ili9320_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 
@@ -228,6 +229,7 @@ uint16_t ili9320_GetLcdPixelHeight(void);
 /* LCD IO functions */
 void     LCD_IO_Init(void);
 void     LCD_IO_WriteMultipleData(uint8_t *pData, uint32_t Size);
+void     LCD_IO_Flood(uint16_t Data, uint32_t Count);
 void     LCD_IO_WriteReg(uint8_t Reg);
 uint16_t LCD_IO_ReadData(uint16_t Reg);
 
@@ -0,0 +1,243 @@
+/**
+  ******************************************************************************
+  * @file    ili9320_io.c
+  * @author  agent
+  * @version V1.0
+  * @date    15-October-2026
+  * @brief   8-bit parallel bus layer (LCD_IO_* functions) of the ILI9320
+  *          driver for the KL05 GPIOs.
+  ******************************************************************************
+  * @attention
+  *
+  * The data lines are split across two ports:
+  *
+  *   D0 = PTB10, D1 = PTB11, D2 = PTA11, D3 = PTB5,
+  *   D4 = PTA10, D5 = PTA12, D6 = PTB6,  D7 = PTB7.
+  *
+  * Control lines (active low): WR = PTB9, RD = PTB8, DC = PTA8, CS = PTA0.
+  *
+  * A byte is put on the bus with the pins to set of each port, looked up in
+  * a 256-entry table in flash, and the pins to clear, which are the other
+  * data pins of the port: 4 register writes, plus 2 for the write strobe.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ili9320.h"
+
+/** @addtogroup ili9320
+  * @{
+  */
+
+/** @defgroup ILI9320_IO_Private_Defines
+  * @{
+  */
+
+/* Data pins of each port */
+#define ILI9320_IO_PTA_DATA_MASK   ((1U << 10) | (1U << 11) | (1U << 12))
+#define ILI9320_IO_PTB_DATA_MASK   ((1U << 5) | (1U << 6) | (1U << 7) | (1U << 10) | (1U << 11))
+
+/* Pins of each port to set for a byte */
+#define ILI9320_IO_PTA_SET(b)      (((((b) >> 2) & 1U) << 11) | ((((b) >> 4) & 1U) << 10) | \
+                                    ((((b) >> 5) & 1U) << 12))
+#define ILI9320_IO_PTB_SET(b)      (((((b) >> 0) & 1U) << 10) | ((((b) >> 1) & 1U) << 11) | \
+                                    ((((b) >> 3) & 1U) << 5) | ((((b) >> 6) & 1U) << 6) | \
+                                    ((((b) >> 7) & 1U) << 7))
+
+/* Table generators */
+#define ILI9320_IO_ENTRY(b)        { ILI9320_IO_PTA_SET(b), ILI9320_IO_PTB_SET(b) }
+#define ILI9320_IO_ENTRIES4(b)     ILI9320_IO_ENTRY(b), ILI9320_IO_ENTRY((b) + 1), \
+                                   ILI9320_IO_ENTRY((b) + 2), ILI9320_IO_ENTRY((b) + 3)
+#define ILI9320_IO_ENTRIES16(b)    ILI9320_IO_ENTRIES4(b), ILI9320_IO_ENTRIES4((b) + 4), \
+                                   ILI9320_IO_ENTRIES4((b) + 8), ILI9320_IO_ENTRIES4((b) + 12)
+#define ILI9320_IO_ENTRIES64(b)    ILI9320_IO_ENTRIES16(b), ILI9320_IO_ENTRIES16((b) + 16), \
+                                   ILI9320_IO_ENTRIES16((b) + 32), ILI9320_IO_ENTRIES16((b) + 48)
+
+/* Delay that stretches the WR low pulse. With the GPIOs behind the
+ * peripheral bridge, each register write already takes more than the
+ * 50 ns of the datasheet minimum tWRL/tWRH at 48 MHz. */
+#ifndef ILI9320_IO_STROBE_DELAY
+#define ILI9320_IO_STROBE_DELAY()  __NOP()
+#endif
+
+/**
+  * @}
+  */
+
+/** @defgroup ILI9320_IO_Private_Macros
+  * @{
+  */
+
+#define tftLcdRDX_ClrVal() GPIOB->PCOR = 1 << 8
+#define tftLcdRDX_SetVal() GPIOB->PSOR = 1 << 8
+#define tftLcdWRX_ClrVal() GPIOB->PCOR = 1 << 9
+#define tftLcdWRX_SetVal() GPIOB->PSOR = 1 << 9
+#define tftLcdDCX_ClrVal() GPIOA->PCOR = 1 << 8
+#define tftLcdDCX_SetVal() GPIOA->PSOR = 1 << 8
+#define tftLcdCSX_ClrVal() GPIOA->PCOR = 1 << 0
+#define tftLcdCSX_SetVal() GPIOA->PSOR = 1 << 0
+
+#define tftLcd_ReadIdle(void)			tftLcdRDX_SetVal();
+#define tftLcd_WriteActive(void)		tftLcdWRX_ClrVal();
+#define tftLcd_WriteIdle(void)			tftLcdWRX_SetVal();
+#define tftLcd_SetCommandMode(void)		tftLcdDCX_ClrVal();
+#define tftLcd_SetDataMode(void)		tftLcdDCX_SetVal();
+#define tftLcd_ChipSelectActive(void)	tftLcdCSX_ClrVal();
+#define tftLcd_ChipSelectIdle(void)		tftLcdCSX_SetVal();
+
+// Data write strobe, the controller latches the data in the rising edge
+#define tftLcd_WriteStrobe(void) { tftLcd_WriteActive(); ILI9320_IO_STROBE_DELAY(); tftLcd_WriteIdle(); }
+
+// Put a byte in the data lines
+#define tftLcd_PutByte(x) \
+{\
+	const ili9320IoPins_t *pins = &_ioBytePins[(uint8_t)(x)];\
+	GPIOA->PSOR = pins->pta;\
+	GPIOA->PCOR = ILI9320_IO_PTA_DATA_MASK ^ pins->pta;\
+	GPIOB->PSOR = pins->ptb;\
+	GPIOB->PCOR = ILI9320_IO_PTB_DATA_MASK ^ pins->ptb;\
+}
+
+#define tftLcd_Write8(x) { tftLcd_PutByte(x); tftLcd_WriteStrobe(); }
+
+/**
+  * @}
+  */
+
+/** @defgroup ILI9320_IO_Private_Variables
+  * @{
+  */
+
+/* Pins to set in each port for a byte */
+typedef struct
+{
+  uint16_t pta;
+  uint16_t ptb;
+} ili9320IoPins_t;
+
+static const ili9320IoPins_t _ioBytePins[256] =
+{
+  ILI9320_IO_ENTRIES64(0), ILI9320_IO_ENTRIES64(64),
+  ILI9320_IO_ENTRIES64(128), ILI9320_IO_ENTRIES64(192)
+};
+
+/**
+  * @}
+  */
+
+/** @defgroup ILI9320_IO_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Set the control lines idle and select the controller.
+  * @note   The pins must be configured as GPIO outputs before.
+  * @param  None
+  * @retval None
+  */
+void LCD_IO_Init(void)
+{
+  tftLcd_ReadIdle();
+  tftLcd_WriteIdle();
+  tftLcd_SetDataMode();
+
+  /* The controller is the only device on the bus */
+  tftLcd_ChipSelectActive();
+}
+
+/**
+  * @brief  Write 16-bit words to the controller, high byte first.
+  * @param  pData: the words, in the MCU byte order.
+  * @param  Size: the number of bytes.
+  * @retval None
+  */
+void LCD_IO_WriteMultipleData(uint8_t *pData, uint32_t Size)
+{
+  uint32_t i;
+
+  for (i = 0; i + 1 < Size; i += 2)
+  {
+    tftLcd_Write8(pData[i + 1]);
+    tftLcd_Write8(pData[i]);
+  }
+
+  if (i < Size)
+  {
+    tftLcd_Write8(pData[i]);
+  }
+}
+
+/**
+  * @brief  Write the same 16-bit word many times, e.g. a solid fill color.
+  * @note   When both bytes are equal the data lines are set once and only
+  *         the write strobe is toggled.
+  * @param  Data: the word.
+  * @param  Count: the number of words.
+  * @retval None
+  */
+void LCD_IO_Flood(uint16_t Data, uint32_t Count)
+{
+  const uint8_t high = (uint8_t)(Data >> 8);
+  const uint8_t low = (uint8_t)Data;
+
+  if (Count == 0)
+  {
+    return;
+  }
+
+  if (high == low)
+  {
+    tftLcd_PutByte(high);
+    do
+    {
+      tftLcd_WriteStrobe();
+      tftLcd_WriteStrobe();
+    } while (--Count);
+  }
+  else
+  {
+    do
+    {
+      tftLcd_Write8(high);
+      tftLcd_Write8(low);
+    } while (--Count);
+  }
+}
+
+/**
+  * @brief  Write a register index to the controller.
+  * @param  Reg: the register index.
+  * @retval None
+  */
+void LCD_IO_WriteReg(uint8_t Reg)
+{
+  tftLcd_SetCommandMode();
+
+  /* The index is 16-bit, its high byte is always 0 */
+  tftLcd_Write8(0x00);
+  tftLcd_Write8(Reg);
+
+  tftLcd_SetDataMode();
+}
+
+/**
+  * @brief  Read data from the controller.
+  * @note   Not supported: the data lines are never turned into inputs.
+  * @param  Reg: not used.
+  * @retval 0
+  */
+uint16_t LCD_IO_ReadData(uint16_t Reg)
+{
+  (void)Reg;
+
+  return 0;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -33,8 +33,6 @@ static tftHandler_t tft_handler =
 /*PROTOTYPES - PRIVATE FUNCTIONS*/
 /*=======================================================================================*/
 
-void tftLcd_SetAddrWindow(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
-void tftLcd_WriteCommand(uint8_t command, uint8_t *parameter, uint8_t paraNumber);
 void tftLcd_Flood(uint16_t color, uint32_t len);
 
 /*END: PROTOTYPES - PRIVATE FUNCTIONS*/
@@ -395,11 +393,11 @@ void tftLcd_Flood(uint16_t color, uint32_t len)
 /*END: PRIVATE FUNCTIONS*/
 /*=======================================================================================*/
 
-/* PROTOTYPES - ISRs
+/* PROTOTYPES - ISRs */
 /*=======================================================================================*/
 
 
-/* END: PROTOTYPES - ISRs
+/* END: PROTOTYPES - ISRs */
 /*=======================================================================================*/
 
 /***************************************************************************************
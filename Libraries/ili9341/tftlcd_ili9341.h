@@ -30,6 +30,8 @@
 #define tftCOLADDRSET_REG         	0x2A
 #define tftPAGEADDRSET_REG        	0x2B
 #define tftMEMORYWRITE_REG        	0x2C
+#define tftVSCROLLDEF_REG         	0x33
+#define tftVSCROLLSTART_REG       	0x37
 #define tftMEM_ACCESS_CONTROL_REG   0x36
 #define tftMADCTL_REG  		   	  	0x36
 #define tftPIXELFORMAT_SET_REG      0x3A
@@ -313,14 +315,45 @@ void tftLcd_FillScreen(uint16_t color);
 
 void tftLcd_SetRotation(uint8_t x);
 
+/**********************************************************************
+ * Function		:	tftLcd_SetAddrWindow
+ *
+ * Description	:   Sets the LCD address window.
+ *
+ * Inputs		:   x1 : the x1 position from the address window.
+ * 					y1 : the y1 position from the address window.
+ * 					x2 : the x2 position from the address window.
+ * 					y2 : the y2 position from the address window.
+ *
+ * Outputs 		:   None.
+ *
+ * Comments 	: 	Input coordinates are assumed pre-sorted (e.g. x2 >= x1).
+ * ********************************************************************/
+void tftLcd_SetAddrWindow(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+/**********************************************************************
+ * Function		:	tftLcd_WriteCommand
+ *
+ * Description	:   Write a set of parameters in a command register.
+ *
+ * Inputs		:   command    : the register address from command.
+ * 					parameter  : the sequence of parameters from command.
+ * 					paraNumber : the number of parameters.
+ *
+ * Outputs 		:   None.
+ *
+ * Comments 	: 	None.
+ * ********************************************************************/
+void tftLcd_WriteCommand(uint8_t command, uint8_t *parameter, uint8_t paraNumber);
+
 /*END: PROTOTYPES - PUBLIC FUNCTIONS*/
 /*=======================================================================================*/
 
-/* PROTOTYPES - ISRs
+/* PROTOTYPES - ISRs */
 /*=======================================================================================*/
 
 
-/* END: PROTOTYPES - ISRs
+/* END: PROTOTYPES - ISRs */
 /*=======================================================================================*/
 
 #endif /* TFTLCD_ILI9341_H_ */
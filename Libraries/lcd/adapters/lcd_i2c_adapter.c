@@ -11,9 +11,6 @@
 /* Self Header */
 #include "lcd_i2c_adapter.h"
 
-/** Utils */
-#include "Libraries/delay/delay.h"
-
 #ifndef LCD_DISABLE_I2C_ADAPTER
 
 /*******************************************************************************
@@ -29,6 +26,12 @@
 /* Register select bit */
 #define RS_BYTE 0b00000001
 
+/*!< Size of the burst buffer in bytes. Longer strings are sent in several bursts. */
+#define LCD_I2C_BURST_SIZE 64
+
+/*!< Execution time of a HD44780 write in [us], with margin for slow oscillators. */
+#define LCD_I2C_EXECUTION_TIME_US 50
+
 /*******************************************************************************
  * Structures
  ******************************************************************************/
@@ -44,6 +47,15 @@ typedef struct
 
 	/*!< Slave address for display module */
 	uint8_t slave_addr;
+
+	/*!< Backlight bit, kept in every expander write */
+	uint8_t backlight;
+
+	/*!< Extra expander writes after each byte, so the bus time covers the execution time */
+	uint8_t gap;
+
+	/*!< Expander writes of the burst being built */
+	uint8_t burst[LCD_I2C_BURST_SIZE];
 } lcdI2CHardwareAdapter_t;
 
 /*******************************************************************************
@@ -75,11 +87,30 @@ void LCD_I2CWriteBits(
 );
 
 /**
- * @brief Generates a enable pulse to latch the LCD
- * 
- * @param handle LCD handler object instance
+ * @brief Dispatches a block of bytes to display in a single I2C transfer
+ *
+ * @param adapter - LCD adapter object instance
+ * @param data - Bytes to be sent to LCD display
+ * @param length - Number of bytes
+ * @param mode - LCD_COMMAND_MODE or LCD_DATA_MODE
  */
-void EnablePulseI2C(lcdAdapter_t adapter, uint8_t value);
+void LCD_I2CWriteBlock(
+		lcdAdapter_t adapter, const uint8_t *data, size_t length, uint8_t mode
+);
+
+/**
+ * @brief Encodes a byte as the expander writes that latch its two nibbles
+ *
+ * @param adapter - LCD adapter object instance
+ * @param buffer - Destination of the expander writes
+ * @param value - Byte to be sent to LCD display
+ * @param mode - LCD_COMMAND_MODE or LCD_DATA_MODE
+ *
+ * @return Number of expander writes added to buffer
+ */
+static uint8_t EncodeByteI2C(
+		lcdI2CHardwareAdapter_t *adapter, uint8_t *buffer, uint8_t value, uint8_t mode
+);
 
 /**
  * @brief Internal function to allocate a given adapter
@@ -132,9 +163,20 @@ lcdAdapter_t LCD_CreateI2CAdapter(
 	adapter->interface.clrRs = callback_incinerator;
 	adapter->interface.clrEn = callback_incinerator;
 	adapter->interface.write = LCD_I2CWriteBits;
+	adapter->interface.writeBlock = LCD_I2CWriteBlock;
+	adapter->interface.waitReady = NULL;
 
 	adapter->base = base;
 	adapter->slave_addr = slave_addr;
+	adapter->backlight = LCD_BACKLIGHT;
+
+	/**
+	 * Each expander write takes 9 SCL cycles. A byte is latched by its second
+	 * EN falling edge and the first nibble of the next byte two writes later,
+	 * so writes are repeated when these two are not enough for the execution time.
+	 */
+	const uint32_t needed = (LCD_I2C_EXECUTION_TIME_US * I2C_GetBaudRate(base) + 8999999U) / 9000000U;
+	adapter->gap = (needed > 2) ? (uint8_t)(needed - 2) : 0;
 
 	return adapter;
 }
@@ -159,34 +201,80 @@ void LCD_I2CWriteBits(
 	}
 	else
 	{
-		uint8_t h_nibble = (value & 0xf0) | mode;
-		uint8_t l_nibble = ((value << 4) & 0xf0) | mode;
-
-		I2C_WriteSlave(lcdAdapter->base, lcdAdapter->slave_addr, h_nibble);
-		EnablePulseI2C(adapter, h_nibble);
-
-		I2C_WriteSlave(lcdAdapter->base, lcdAdapter->slave_addr, l_nibble);
-		EnablePulseI2C(adapter, l_nibble);
+		LCD_I2CWriteBlock(adapter, &value, 1, mode);
 	}
 }
 
 /**
- * @brief Generates a enable pulse to latch the LCD
- * 
- * @param handle LCD handler object instance
+ * @brief Dispatches a block of bytes to display in a single I2C transfer
+ *
+ * @param adapter - LCD adapter object instance
+ * @param data - Bytes to be sent to LCD display
+ * @param length - Number of bytes
+ * @param mode - LCD_COMMAND_MODE or LCD_DATA_MODE
  */
-void EnablePulseI2C(lcdAdapter_t adapter, uint8_t value)
+void LCD_I2CWriteBlock(
+		lcdAdapter_t adapter, const uint8_t *data, size_t length, uint8_t mode
+)
 {
 	/** Reinterprets the adapter */
 	lcdI2CHardwareAdapter_t* lcdAdapter = (adapter);
+	const uint8_t byte_size = 4 + lcdAdapter->gap;
+	uint8_t n = 0;
+
+	while (length)
+	{
+		if (n == 0)
+		{
+			/** Sets RS before the first EN rising edge */
+			lcdAdapter->burst[n++] = mode | lcdAdapter->backlight;
+		}
+
+		n += EncodeByteI2C(lcdAdapter, &lcdAdapter->burst[n], *data++, mode);
+		--length;
+
+		if ((length == 0) || ((n + byte_size) > LCD_I2C_BURST_SIZE))
+		{
+			I2C_WriteSlaveChunk(lcdAdapter->base, lcdAdapter->slave_addr, lcdAdapter->burst, n);
+			n = 0;
+		}
+	}
+}
 
-	// En high
-	I2C_WriteSlave(lcdAdapter->base, lcdAdapter->slave_addr, value | EN_BYTE);
-	Waitus(2);
+/**
+ * @brief Encodes a byte as the expander writes that latch its two nibbles
+ *
+ * Each nibble is written with EN high and then with EN low, whose falling
+ * edge latches it. The bus time of each write (9 SCL cycles) is longer than
+ * the EN pulse width, so no delay is needed between them.
+ *
+ * @param adapter - LCD adapter object instance
+ * @param buffer - Destination of the expander writes
+ * @param value - Byte to be sent to LCD display
+ * @param mode - LCD_COMMAND_MODE or LCD_DATA_MODE
+ *
+ * @return Number of expander writes added to buffer
+ */
+static uint8_t EncodeByteI2C(
+		lcdI2CHardwareAdapter_t *adapter, uint8_t *buffer, uint8_t value, uint8_t mode
+)
+{
+	const uint8_t h_nibble = (value & 0xf0) | mode | adapter->backlight;
+	const uint8_t l_nibble = ((value << 4) & 0xf0) | mode | adapter->backlight;
+	uint8_t n = 0;
+
+	buffer[n++] = h_nibble | EN_BYTE;
+	buffer[n++] = h_nibble;
+	buffer[n++] = l_nibble | EN_BYTE;
+	buffer[n++] = l_nibble;
+
+	/** Holds the bus until the execution time of this byte */
+	for (uint8_t i = 0; i < adapter->gap; ++i)
+	{
+		buffer[n++] = l_nibble;
+	}
 
-	// En low
-	I2C_WriteSlave(lcdAdapter->base, lcdAdapter->slave_addr, value | ~EN_BYTE);
-	Waitus(100);
+	return n;
 }
 
 /**
@@ -203,7 +291,7 @@ lcdI2CHardwareAdapter_t* AllocAdapter()
 		objectCreated = (void*)&g_lcdI2CAdapterList[g_staticI2CAdaptersCreated++];
 	}
 #else
-	objectCreated = embUtil_Malloc(sizeof(lcdParallelHardwareAdapter_t));
+	objectCreated = embUtil_Malloc(sizeof(lcdI2CHardwareAdapter_t));
 #endif
 	return objectCreated;
 }
@@ -219,7 +307,7 @@ void LCD_FreeAdapterI2C(lcdAdapter_t adapter)
 	if(g_staticI2CAdaptersCreated)
 		--g_staticI2CAdaptersCreated;
 #else
-	embUtil_Free(obj);
+	embUtil_Free(adapter);
 #endif
 	adapter = NULL;
 }
@@ -33,6 +33,19 @@
 
 #ifndef LCD_DISABLE_PARALLEL_ADAPTER
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifdef LCD_8_BIT_MODE
+#define LCD_PARALLEL_DATA_PINS 8
+#else
+#define LCD_PARALLEL_DATA_PINS 4
+#endif
+
+/*!< Number of nibbles written at once, each one with its own mask table.*/
+#define LCD_PARALLEL_NIBBLES (LCD_PARALLEL_DATA_PINS / 4)
+
 /*******************************************************************************
  * Structures
  ******************************************************************************/
@@ -55,6 +68,24 @@ typedef struct
 
 	/*!< Enable pin.*/
 	lcdPin_t en;
+
+	/*!< Read/Write pin, portRegister is NULL if it is not wired.*/
+	lcdPin_t rw;
+
+#ifdef LCD_PARALLEL_MASK_TABLES
+	/*!< Number of ports used by the data pins, 0 if the tables are not used.*/
+	uint8_t portCount;
+
+	/*!< The ports used by the data pins.*/
+	GPIO_Type* ports[LCD_PARALLEL_MAX_PORTS];
+
+	/*!< The data pins of each nibble in each port.*/
+	uint32_t nibblePins[LCD_PARALLEL_NIBBLES][LCD_PARALLEL_MAX_PORTS];
+
+	/*!< The pins to set in each port for every nibble value. The pins to
+	 *   clear are the remaining pins of the nibble.*/
+	uint32_t nibbleSet[LCD_PARALLEL_NIBBLES][16][LCD_PARALLEL_MAX_PORTS];
+#endif
 } lcdParallelHardwareAdapter_t;
 
 /*******************************************************************************
@@ -99,6 +130,33 @@ static lcdParallelHardwareAdapter_t* AllocAdapter();
  */
 void EnablePulseParallel(lcdAdapter_t adapter);
 
+/**
+ * @brief Puts a value in the data pins, data[0] receiving the bit 0
+ *
+ * @param lcdAdapter - LCD adapter object instance
+ * @param value - 4 bits in 4-bit mode, 8 bits in 8-bit mode
+ */
+static void WriteDataPins(lcdParallelHardwareAdapter_t *lcdAdapter, uint8_t value);
+
+#ifdef LCD_PARALLEL_MASK_TABLES
+/**
+ * @brief Computes the per-port masks of every nibble value
+ *
+ * @param lcdAdapter - LCD adapter object instance with the data pins set
+ */
+static void BuildMaskTables(lcdParallelHardwareAdapter_t *lcdAdapter);
+#endif
+
+/**
+ * @brief Polls the busy flag until it is cleared or the timeout expires
+ *
+ * @param adapter - LCD adapter object instance
+ *
+ * @return true if the controller is ready, false if the R/W pin is not
+ *         wired or the timeout expired.
+ */
+bool LCD_ParallelWaitReady(lcdAdapter_t adapter);
+
 /**
  * @brief Sets reset bit on LCD display using parallel adapter
  *
@@ -155,27 +213,48 @@ lcdAdapter_t LCD_CreateParallelAdapter(
 	adapter->interface.clrRs = LCD_ParallelClrRs;
 	adapter->interface.clrEn = LCD_ParallelClrEn;
 	adapter->interface.write = LCD_ParallelWriteBits;
+	adapter->interface.writeBlock = NULL;
+	adapter->interface.waitReady = LCD_ParallelWaitReady;
 
-#ifdef LCD_8_BIT_MODE
-	uint8_t limit = 8;
-#else
-	uint8_t limit = 4;
-#endif
-
-	for (int i = 0; i < limit; ++i)
+	for (int i = 0; i < LCD_PARALLEL_DATA_PINS; ++i)
 	{
 		adapter->data[i].portRegister = data[i].portRegister;
 		adapter->data[i].pinMask = data[i].pinMask;
 	}
 
+#ifdef LCD_PARALLEL_MASK_TABLES
+	BuildMaskTables(adapter);
+#endif
+
 	adapter->en.pinMask = enPin->pinMask;
 	adapter->en.portRegister = enPin->portRegister;
 	adapter->rs.pinMask = rsPin->pinMask;
 	adapter->rs.portRegister = rsPin->portRegister;
 
+	/** R/W tied to ground until LCD_ParallelSetRwPin */
+	adapter->rw.pinMask = 0;
+	adapter->rw.portRegister = NULL;
+
 	return adapter;
 }
 
+/**
+ * @brief Sets the R/W pin of a parallel adapter, enabling the busy flag polling.
+ *
+ * @param adapter - The parallel adapter.
+ * @param rwPin - The R/W pin, already configured as a GPIO output.
+ */
+void LCD_ParallelSetRwPin(lcdAdapter_t adapter, lcdPin_t *rwPin)
+{
+	lcdParallelHardwareAdapter_t* lcdAdapter = (adapter);
+
+	lcdAdapter->rw.pinMask = rwPin->pinMask;
+	lcdAdapter->rw.portRegister = rwPin->portRegister;
+
+	/** Write mode, except while reading the busy flag */
+	MCU_PortClear(lcdAdapter->rw.portRegister, lcdAdapter->rw.pinMask)
+}
+
 /**
  * @brief Dispatches a given byte of data to display
  *
@@ -194,6 +273,12 @@ void LCD_ParallelWriteBits(
 	/** Reinterprets the adapter */
 	lcdParallelHardwareAdapter_t* lcdAdapter = (adapter);
 
+	/** Waits the previous command, if the busy flag can be read */
+	if (lcdAdapter->rw.portRegister)
+	{
+		LCD_ParallelWaitReady(adapter);
+	}
+
 	/** Set or Clear RS based on mode */
 	if (mode)
 	{
@@ -207,9 +292,51 @@ void LCD_ParallelWriteBits(
 	/** Dispatches the data */
 #ifdef LCD_4_BIT_MODE
 	/** Dispatches most significant nibble */
-	for (int i = 0; i < 4; ++i)
+	WriteDataPins(lcdAdapter, value >> 4);
+	EnablePulseParallel(lcdAdapter);
+
+	/** Dispatches least significant nibble */
+	WriteDataPins(lcdAdapter, value & 0x0F);
+	EnablePulseParallel(lcdAdapter);
+#else
+	WriteDataPins(lcdAdapter, value);
+	EnablePulseParallel(lcdAdapter);
+#endif
+}
+
+/**
+ * @brief Puts a value in the data pins, data[0] receiving the bit 0
+ *
+ * @param lcdAdapter - LCD adapter object instance
+ * @param value - 4 bits in 4-bit mode, 8 bits in 8-bit mode
+ */
+static void WriteDataPins(lcdParallelHardwareAdapter_t *lcdAdapter, uint8_t value)
+{
+#ifdef LCD_PARALLEL_MASK_TABLES
+	if (lcdAdapter->portCount)
+	{
+		/** One set and one clear per port */
+		for (int p = 0; p < lcdAdapter->portCount; ++p)
+		{
+			uint32_t pins = 0;
+			uint32_t set = 0;
+
+			for (int n = 0; n < LCD_PARALLEL_NIBBLES; ++n)
+			{
+				pins |= lcdAdapter->nibblePins[n][p];
+				set |= lcdAdapter->nibbleSet[n][(value >> (4 * n)) & 0x0F][p];
+			}
+
+			MCU_PortSet(lcdAdapter->ports[p], set)
+			MCU_PortClear(lcdAdapter->ports[p], pins & ~set)
+		}
+		return;
+	}
+#endif
+
+	for (int i = 0; i < LCD_PARALLEL_DATA_PINS; ++i)
 	{
-		if((value >> 4 >> i) & 0x01)
+		if((value >> i) & 0x01)
 		{
 			MCU_PortSet(lcdAdapter->data[i].portRegister, lcdAdapter->data[i].pinMask);
 		}
@@ -218,37 +345,75 @@ void LCD_ParallelWriteBits(
 			MCU_PortClear(lcdAdapter->data[i].portRegister, lcdAdapter->data[i].pinMask);
 		}
 	}
-	EnablePulseParallel(adapter);
+}
 
-	/** Dispatches least significant nibble */
-	for (int i = 0; i < 4; ++i)
+#ifdef LCD_PARALLEL_MASK_TABLES
+/**
+ * @brief Computes the per-port masks of every nibble value
+ *
+ * @param lcdAdapter - LCD adapter object instance with the data pins set
+ */
+static void BuildMaskTables(lcdParallelHardwareAdapter_t *lcdAdapter)
+{
+	uint8_t port[LCD_PARALLEL_DATA_PINS];
+
+	/** Finds the port index of each data pin */
+	lcdAdapter->portCount = 0;
+	for (int i = 0; i < LCD_PARALLEL_DATA_PINS; ++i)
 	{
-		if((value >> i) & 0x01)
+		int p = 0;
+
+		while (p < lcdAdapter->portCount && lcdAdapter->ports[p] != lcdAdapter->data[i].portRegister)
 		{
-			MCU_PortSet(lcdAdapter->data[i].portRegister, lcdAdapter->data[i].pinMask);
+			++p;
 		}
-		else
+
+		if (p == lcdAdapter->portCount)
 		{
-			MCU_PortClear(lcdAdapter->data[i].portRegister, lcdAdapter->data[i].pinMask);
+			if (p == LCD_PARALLEL_MAX_PORTS)
+			{
+				/** Too many ports, writes pin by pin */
+				lcdAdapter->portCount = 0;
+				return;
+			}
+			lcdAdapter->ports[lcdAdapter->portCount++] = lcdAdapter->data[i].portRegister;
 		}
+
+		port[i] = p;
 	}
-	EnablePulseParallel(lcdAdapter);
 
-#else
-	for (int i = 0; i < 8; ++i)
+	for (int n = 0; n < LCD_PARALLEL_NIBBLES; ++n)
 	{
-		if((value >> i) & 0x01)
+		for (int p = 0; p < LCD_PARALLEL_MAX_PORTS; ++p)
 		{
-			MCU_PortSet(lcdAdapter->data[i].portRegister, lcdAdapter->data[i].pinMask);
+			lcdAdapter->nibblePins[n][p] = 0;
 		}
-		else
+
+		for (int bit = 0; bit < 4; ++bit)
 		{
-			MCU_PortClear(lcdAdapter->data[i].portRegister, lcdAdapter->data[i].pinMask);
+			const lcdPin_t *pin = &lcdAdapter->data[4 * n + bit];
+
+			lcdAdapter->nibblePins[n][port[4 * n + bit]] |= pin->pinMask;
+		}
+
+		for (int value = 0; value < 16; ++value)
+		{
+			for (int p = 0; p < LCD_PARALLEL_MAX_PORTS; ++p)
+			{
+				lcdAdapter->nibbleSet[n][value][p] = 0;
+			}
+
+			for (int bit = 0; bit < 4; ++bit)
+			{
+				if ((value >> bit) & 0x01)
+				{
+					lcdAdapter->nibbleSet[n][value][port[4 * n + bit]] |= lcdAdapter->data[4 * n + bit].pinMask;
+				}
+			}
 		}
 	}
-	EnablePulseParallel(lcdAdapter);
-#endif
 }
+#endif
 
 /**
  * @brief Generates a enable pulse to latch the LCD
@@ -264,7 +429,64 @@ void EnablePulseParallel(lcdAdapter_t adapter)
 	MCU_PortSet(lcdAdapter->en.portRegister, lcdAdapter->en.pinMask);
 	Waitus(1);
 	MCU_PortClear(lcdAdapter->en.portRegister, lcdAdapter->en.pinMask);
-	Waitus(100);
+
+	/** Worst case execution time, when the busy flag can not be read */
+	if (!lcdAdapter->rw.portRegister)
+	{
+		Waitus(100);
+	}
+}
+
+/**
+ * @brief Polls the busy flag until it is cleared or the timeout expires
+ *
+ * @param adapter - LCD adapter object instance
+ *
+ * @return true if the controller is ready, false if the R/W pin is not
+ *         wired or the timeout expired.
+ */
+bool LCD_ParallelWaitReady(lcdAdapter_t adapter)
+{
+	lcdParallelHardwareAdapter_t* lcdAdapter = (adapter);
+	const uint8_t limit = LCD_PARALLEL_DATA_PINS;
+	/** The busy flag is DB7 */
+	const lcdPin_t *db7 = &lcdAdapter->data[limit - 1];
+	bool busy = true;
+
+	if (!lcdAdapter->rw.portRegister) return false;
+
+	/** Data pins as inputs and reads the instruction register */
+	for (int i = 0; i < limit; ++i)
+	{
+		lcdAdapter->data[i].portRegister->PDDR &= ~lcdAdapter->data[i].pinMask;
+	}
+	LCD_ParallelClrRs(adapter);
+	MCU_PortSet(lcdAdapter->rw.portRegister, lcdAdapter->rw.pinMask)
+
+	for (uint16_t i = 0; busy && (i < LCD_PARALLEL_BUSY_POLLS); ++i)
+	{
+		LCD_ParallelSetEn(adapter);
+		Waitus(1); // Data delay time
+		busy = (db7->portRegister->PDIR & db7->pinMask) != 0;
+		LCD_ParallelClrEn(adapter);
+#ifdef LCD_4_BIT_MODE
+		/** The low nibble of the address counter must be read too */
+		Waitus(1);
+		LCD_ParallelSetEn(adapter);
+		Waitus(1);
+		LCD_ParallelClrEn(adapter);
+#endif
+		Waitus(1);
+	}
+
+	/** Back to write mode */
+	MCU_PortClear(lcdAdapter->rw.portRegister, lcdAdapter->rw.pinMask)
+	for (int i = 0; i < limit; ++i)
+	{
+		lcdAdapter->data[i].portRegister->PDDR |= lcdAdapter->data[i].pinMask;
+	}
+
+	return !busy;
 }
 
 /**
@@ -345,7 +567,7 @@ void LCD_FreeAdapterParallel(lcdAdapter_t adapter)
 	if(g_staticParallelAdaptersCreated)
 		--g_staticParallelAdaptersCreated;
 #else
-	embUtil_Free(obj);
+	embUtil_Free(adapter);
 #endif
 	adapter = NULL;
 }
@@ -42,6 +42,27 @@ extern "C" {
 
 #ifndef LCD_DISABLE_PARALLEL_ADAPTER
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Maximum number of busy flag reads. Each read waits at least 2 us (4 us in
+ *   4-bit mode, where the address counter nibble is read too), so the default
+ *   outlasts a 3.3 ms LCD_Clear. After it the write goes on, as with the fixed
+ *   delays used when the R/W pin is not wired.*/
+#define LCD_PARALLEL_BUSY_POLLS 2000
+
+/*!< Uncomment this macro or set in the compiler parameters to precompute, at the
+ *   adapter creation, the set mask of each GPIO port for every nibble value, so a
+ *   nibble is written with one PSOR and one PCOR per port instead of one write per
+ *   pin. It is off for the tables RAM: about 144 bytes per adapter in 4-bit mode
+ *   and 280 bytes in 8-bit mode, with LCD_PARALLEL_MAX_PORTS at 2.*/
+//#define LCD_PARALLEL_MASK_TABLES
+
+/*!< Maximum number of GPIO ports the data pins can be spread over to use the
+ *   mask tables. With more ports the adapter writes pin by pin.*/
+#define LCD_PARALLEL_MAX_PORTS 2
+
 /*******************************************************************************
  * Structures
  ******************************************************************************/
@@ -82,6 +103,19 @@ lcdAdapter_t LCD_CreateParallelAdapter(
 	lcdPin_t *rsPin, lcdPin_t *enPin
 );
 
+/**
+ * @brief Sets the R/W pin of a parallel adapter, enabling the busy flag polling.
+ *
+ * Without the R/W pin (tied to ground), the adapter waits the worst case
+ * execution time after each write. With it, the adapter reads the busy flag
+ * (DB7) before each write and LCD_Clear/LCD_Home return as soon as the
+ * controller is ready. The data pins must be GPIOs that can be read.
+ *
+ * @param adapter - The parallel adapter.
+ * @param rwPin - The R/W pin, already configured as a GPIO output.
+ */
+void LCD_ParallelSetRwPin(lcdAdapter_t adapter, lcdPin_t *rwPin);
+
 /**
  * @brief Destroys a given LCD parallel adapter
  * 
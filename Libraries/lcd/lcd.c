@@ -22,6 +22,9 @@
  * A library for LCD with HD44780 controller.
  */
 
+/** std */
+#include <string.h>
+
 /** Self header */
 #include "lcd.h"
 
@@ -80,6 +83,44 @@ typedef struct
 	/*!< The row offset.Get(12);s list determined by the number of LCD rows and columns.*/
 	uint8_t row_offsets[4];
 
+#ifdef LCD_SHADOW_BUFFER
+	/*!< The characters to be shown, in display order (row * cols + col).*/
+	uint8_t shadow[LCD_SHADOW_MAX_CELLS];
+
+	/*!< The characters held by the controller DDRAM, in display order.*/
+	uint8_t shown[LCD_SHADOW_MAX_CELLS];
+
+	/*!< The shadow cursor, as an index of the shadow.*/
+	uint8_t cursor;
+
+	/*!< The controller DDRAM address counter, valid if address_known is true.*/
+	uint8_t address;
+	bool address_known;
+#endif /* LCD_SHADOW_BUFFER */
+
+#ifdef LCD_GLYPH_CACHE
+	/*!< The glyph table, glyph n is glyphs[n - 1].*/
+	const uint8_t (*glyphs)[8];
+	uint8_t glyph_count;
+
+	/*!< The glyph number in each CGRAM slot, 0 if the slot is not cached.*/
+	uint8_t slot_glyph[8];
+
+	/*!< The CGRAM slots from the most to the least recently used.*/
+	uint8_t slot_order[8];
+
+#ifndef LCD_SHADOW_BUFFER
+	/*!< The controller DDRAM address counter, restored after a glyph upload.
+	 *   It follows every LCD_Command and LCD_Write, and is valid if
+	 *   ddram_known is true.*/
+	uint8_t ddram_address;
+	bool ddram_known;
+
+	/*!< The entry mode I/D: a write increments the address counter.*/
+	bool ddram_increment;
+#endif
+#endif /* LCD_GLYPH_CACHE */
+
 #ifdef __FREERTOS_H
 #ifdef LCD_REENTRANT_ACCESS
 	/*!< The mutex used for mutual exclusion in API calls.*/
@@ -203,6 +244,97 @@ static const uint8_t _bigNumCommands[10][4] =
  */
 static void SetRowOffsets(lcdPrivateHandle_t *handle);
 
+#ifdef LCD_SHADOW_BUFFER
+/**
+ * @brief Get the row where the address counter goes past the end of a row.
+ *
+ * @param handle - the specific LCD handle.
+ * @param row    - the row.
+ *
+ * @return The next row in DDRAM order.
+ */
+static uint8_t GetNextRow(lcdPrivateHandle_t *handle, uint8_t row);
+#endif
+
+/**
+ * @brief Write a character in the current cursor position, in the shadow
+ *        if it is used, otherwise in the display.
+ *
+ * @param handle - the specific LCD handle.
+ * @param value  - the character.
+ */
+static void PutChar(lcdPrivateHandle_t *handle, uint8_t value);
+
+/**
+ * @brief Write characters from the current cursor position, in the shadow
+ *        if it is used, otherwise in the display.
+ *
+ * @param handle - the specific LCD handle.
+ * @param data   - the characters.
+ * @param length - the number of characters.
+ */
+static void WriteRun(lcdPrivateHandle_t *handle, const uint8_t *data, size_t length);
+
+/**
+ * @brief Wait the controller to execute a long command, polling the busy
+ *        flag if the adapter can read it, otherwise with a fixed delay.
+ *
+ * @param handle - the specific LCD handle.
+ * @param ms     - the fixed delay, used as fallback.
+ */
+static void WaitExecution(lcdPrivateHandle_t *handle, uint16_t ms);
+
+/**
+ * @brief Point the address counter to a CGRAM slot, before its bit map
+ *        is written.
+ *
+ * @param handle - the specific LCD handle.
+ * @param slot   - the CGRAM slot, from 0 to 7.
+ */
+static void SetCgramAddress(lcdPrivateHandle_t *handle, uint8_t slot);
+
+#ifdef LCD_GLYPH_CACHE
+/**
+ * @brief Get the CGRAM slot of a glyph, uploading it over the least
+ *        recently used slot if it is missing.
+ *
+ * @param handle - the specific LCD handle.
+ * @param glyph  - the glyph number.
+ *
+ * @return The CGRAM slot.
+ */
+static uint8_t GetGlyphSlot(lcdPrivateHandle_t *handle, uint8_t glyph);
+
+/**
+ * @brief Remove a CGRAM slot from the glyph cache, when it is written by
+ *        LCD_CreateChar.
+ *
+ * @param handle - the specific LCD handle.
+ * @param slot   - the CGRAM slot.
+ */
+static void InvalidateGlyphSlot(lcdPrivateHandle_t *handle, uint8_t slot);
+
+#ifndef LCD_SHADOW_BUFFER
+/**
+ * @brief Move the tracked DDRAM address counter, with the wrap of the
+ *        controller.
+ *
+ * @param handle  - the specific LCD handle.
+ * @param forward - if the counter is incremented, otherwise decremented.
+ * @param count   - the number of positions.
+ */
+static void MoveDdramAddress(lcdPrivateHandle_t *handle, bool forward, size_t count);
+
+/**
+ * @brief Follow the effect of a command on the DDRAM address counter.
+ *
+ * @param handle - the specific LCD handle.
+ * @param value  - the command value.
+ */
+static void TrackCommand(lcdPrivateHandle_t *handle, uint8_t value);
+#endif
+#endif /* LCD_GLYPH_CACHE */
+
 /**
  * @brief Create an specific object used by an LCD instance.
  *
@@ -320,6 +452,14 @@ lcdHandle_t LCD_Init(
 	/** TODO add free */
 	if(!handle || !config) return NULL;
 
+#ifdef __FREERTOS_H
+#ifdef LCD_REENTRANT_ACCESS
+	/** Used by the API calls from here on */
+	handle->lcdAccessMutex = xSemaphoreCreateMutex();
+	if(!handle->lcdAccessMutex) return NULL;
+#endif /* LCD_REENTRANT_ACCESS */
+#endif /* __FREERTOS_H */
+
 	/** Config setup */
 	config->adapter = adapter;
 	config->cols = cols;
@@ -354,7 +494,7 @@ lcdHandle_t LCD_Init(
 	if (adapter_interface->type == LCD_I2C_HARD_ADAPTER)
 	{
 		// Reset expander and turn backlight off (Bit 8 = 1)
-		adapter_interface->write(handle, LCD_BACKLIGHT, true, LCD_COMMAND_MODE);
+		adapter_interface->write(adapter_interface, LCD_BACKLIGHT, true, LCD_COMMAND_MODE);
 		Waitms(1000);
 	}
 	else
@@ -402,7 +542,25 @@ lcdHandle_t LCD_Init(
 	LCD_Display(handle);
 
 	// clear it off
-	LCD_Clear(handle);
+	LCD_Command(handle, LCD_CLEAR_DISPLAY);
+	WaitExecution(handle, 32);
+
+#ifdef LCD_SHADOW_BUFFER
+	SYSTEM_ASSERT(cols * lines <= LCD_SHADOW_MAX_CELLS);
+	memset(handle->shadow, ' ', sizeof(handle->shadow));
+	memset(handle->shown, ' ', sizeof(handle->shown));
+	handle->cursor = 0;
+#endif
+
+#ifdef LCD_GLYPH_CACHE
+	handle->glyphs = NULL;
+	handle->glyph_count = 0;
+	for (uint8_t i = 0; i < 8; ++i)
+	{
+		handle->slot_glyph[i] = 0;
+		handle->slot_order[i] = i;
+	}
+#endif /* LCD_GLYPH_CACHE */
 
 	Waitms(10);
 
@@ -426,11 +584,18 @@ void LCD_Clear(lcdHandle_t handle)
 	SYSTEM_ASSERT(handle);
 	LcdEnterMutex(((lcdPrivateHandle_t*)handle));
 
+#ifdef LCD_SHADOW_BUFFER
+	/** Reinterpret as private handle */
+	lcdPrivateHandle_t* lcdHandle = handle;
+	memset(lcdHandle->shadow, ' ', sizeof(lcdHandle->shadow));
+	lcdHandle->cursor = 0;
+#else
 	// Clear display, set cursor position to zero
 	LCD_Command(handle, LCD_CLEAR_DISPLAY);
 
 	// This command takes a long time!
-	Waitms(32);
+	WaitExecution(handle, 32);
+#endif
 
 	LcdExitMutex(((lcdPrivateHandle_t*)handle));
 }
@@ -445,11 +610,15 @@ void LCD_Home(lcdHandle_t handle)
 	SYSTEM_ASSERT(handle);
 	LcdEnterMutex(((lcdPrivateHandle_t*)handle));
 
+#ifdef LCD_SHADOW_BUFFER
+	((lcdPrivateHandle_t*)handle)->cursor = 0;
+#else
 	// Set cursor position to zero
 	LCD_Command(handle, LCD_RETURN_HOME);
 
 	// This command takes a long time!
-	Waitms(32);
+	WaitExecution(handle, 32);
+#endif
 
 	LcdExitMutex(((lcdPrivateHandle_t*)handle));
 }
@@ -481,7 +650,15 @@ void LCD_SetCursor(lcdHandle_t handle, uint8_t col, uint8_t row)
 		row = lcdHandle->config->lines - 1;
 	}
 
+#ifdef LCD_SHADOW_BUFFER
+	if (col >= lcdHandle->config->cols)
+	{
+		col = lcdHandle->config->cols - 1;
+	}
+	lcdHandle->cursor = row * lcdHandle->config->cols + col;
+#else
 	LCD_Command(handle, LCD_SET_DD_RAM_ADDR | (col + lcdHandle->row_offsets[row]));
+#endif
 
 	LcdExitMutex(((lcdPrivateHandle_t*)handle));
 }
@@ -714,7 +891,10 @@ void LCD_CreateChar(lcdHandle_t handle, uint8_t location, const uint8_t charmap[
 
 	// We only have 8 locations 0-7
 	location &= 0x7;
-	LCD_Command(handle, LCD_SET_CG_RAM_ADDR | (location << 3));
+#ifdef LCD_GLYPH_CACHE
+	InvalidateGlyphSlot(handle, location);
+#endif
+	SetCgramAddress(handle, location);
 	for (int i = 0; i < 8; ++i)
 	{
 		LCD_Write(handle, charmap[i]);
@@ -734,11 +914,32 @@ void LCD_WriteString(lcdHandle_t handle, char *str)
 	SYSTEM_ASSERT(handle);
 	LcdEnterMutex(((lcdPrivateHandle_t*)handle));
 
+#ifdef LCD_GLYPH_CACHE
 	while (*str != '\0')
 	{
-		LCD_Write(handle, *str);
-		++str;
+		if ((*str == LCD_GLYPH_ESCAPE) && (str[1] != '\0'))
+		{
+			/** The glyph may be uploaded before being written */
+			PutChar(handle, GetGlyphSlot(handle, (uint8_t)str[1]));
+			str += 2;
+			continue;
+		}
+
+		/** Writes the run of ordinary characters at once */
+		const char *escape = strchr(str, LCD_GLYPH_ESCAPE);
+		const size_t length = escape ? (size_t)(escape - str) : strlen(str);
+
+		if (!length)
+		{
+			/** Escape without glyph number at the end */
+			break;
+		}
+		WriteRun(handle, (const uint8_t*)str, length);
+		str += length;
 	}
+#else
+	WriteRun(handle, (const uint8_t*)str, strlen(str));
+#endif
 
 	LcdExitMutex(((lcdPrivateHandle_t*)handle));
 }
@@ -775,11 +976,11 @@ void LCD_CreateBigNumsChars(lcdHandle_t handle)
 void LCD_WriteBigNum(lcdHandle_t handle, uint8_t col, uint8_t num)
 {
 	LCD_SetCursor(handle, col, 0);
-	LCD_Write(handle, _bigNumCommands[num][0]);
-	LCD_Write(handle, _bigNumCommands[num][1]);
+	PutChar(handle, _bigNumCommands[num][0]);
+	PutChar(handle, _bigNumCommands[num][1]);
 	LCD_SetCursor(handle, col, 1);
-	LCD_Write(handle, _bigNumCommands[num][2]);
-	LCD_Write(handle, _bigNumCommands[num][3]);
+	PutChar(handle, _bigNumCommands[num][2]);
+	PutChar(handle, _bigNumCommands[num][3]);
 }
 
 /**
@@ -796,6 +997,411 @@ static void SetRowOffsets(lcdPrivateHandle_t *handle)
 	handle->row_offsets[3] = 0x40 + handle->config->cols;
 }
 
+#ifdef LCD_SHADOW_BUFFER
+/**
+ * @brief Get the row where the address counter goes past the end of a row.
+ *
+ * The DDRAM holds the rows in the order of their offsets, the line at 0x40
+ * following the line at 0x00: 0, 2, 1 and 3 on a 4-line module.
+ *
+ * @param handle - the specific LCD handle.
+ * @param row    - the row.
+ *
+ * @return The next row in DDRAM order.
+ */
+static uint8_t GetNextRow(lcdPrivateHandle_t *handle, uint8_t row)
+{
+	const uint8_t offset = handle->row_offsets[row];
+	uint8_t next = 0;
+
+	for (uint8_t i = 1; i < handle->config->lines; ++i)
+	{
+		const uint8_t candidate = handle->row_offsets[i];
+
+		/** The lowest offset above the row, if any, else row 0 */
+		if ((candidate > offset) && ((next == 0) || (candidate < handle->row_offsets[next])))
+		{
+			next = i;
+		}
+	}
+
+	return next;
+}
+#endif
+
+/**
+ * @brief Write a character in the current cursor position, in the shadow
+ *        if it is used, otherwise in the display.
+ *
+ * @param handle - the specific LCD handle.
+ * @param value  - the character.
+ */
+static void PutChar(lcdPrivateHandle_t *handle, uint8_t value)
+{
+#ifdef LCD_SHADOW_BUFFER
+	const uint8_t cols = handle->config->cols;
+
+	handle->shadow[handle->cursor] = value;
+	if ((++handle->cursor % cols) == 0)
+	{
+		/** Past the end of a row, the same row as the controller address counter */
+		handle->cursor = GetNextRow(handle, handle->cursor / cols - 1) * cols;
+	}
+#else
+	LCD_Write(handle, value);
+#endif
+}
+
+/**
+ * @brief Write characters from the current cursor position, in the shadow
+ *        if it is used, otherwise in the display.
+ *
+ * @param handle - the specific LCD handle.
+ * @param data   - the characters.
+ * @param length - the number of characters.
+ */
+static void WriteRun(lcdPrivateHandle_t *handle, const uint8_t *data, size_t length)
+{
+#ifndef LCD_SHADOW_BUFFER
+	/** Reinterpret as hardware adapter interface */
+	lcdAdapterInterface_t *adapter = handle->config->adapter;
+
+	if (adapter->writeBlock)
+	{
+		/** The whole run in one bus transfer */
+		adapter->writeBlock(adapter, data, length, LCD_DATA_MODE);
+
+#ifdef LCD_GLYPH_CACHE
+		if (handle->ddram_known)
+		{
+			MoveDdramAddress(handle, handle->ddram_increment, length);
+		}
+#endif
+		return;
+	}
+#endif
+
+	for (size_t i = 0; i < length; ++i)
+	{
+		PutChar(handle, data[i]);
+	}
+}
+
+/**
+ * @brief Wait the controller to execute a long command, polling the busy
+ *        flag if the adapter can read it, otherwise with a fixed delay.
+ *
+ * @param handle - the specific LCD handle.
+ * @param ms     - the fixed delay, used as fallback.
+ */
+static void WaitExecution(lcdPrivateHandle_t *handle, uint16_t ms)
+{
+	lcdAdapterInterface_t *adapter = handle->config->adapter;
+
+	if (!adapter->waitReady || !adapter->waitReady(adapter))
+	{
+		Waitms(ms);
+	}
+}
+
+/**
+ * @brief Point the address counter to a CGRAM slot, before its bit map
+ *        is written.
+ *
+ * @param handle - the specific LCD handle.
+ * @param slot   - the CGRAM slot, from 0 to 7.
+ */
+static void SetCgramAddress(lcdPrivateHandle_t *handle, uint8_t slot)
+{
+	LCD_Command(handle, LCD_SET_CG_RAM_ADDR | (slot << 3));
+
+#ifdef LCD_SHADOW_BUFFER
+	/** The address counter left the DDRAM: the next flush must set it again */
+	handle->address_known = false;
+#endif
+}
+
+#ifdef LCD_GLYPH_CACHE
+/**
+ * @brief Get the CGRAM slot of a glyph, uploading it over the least
+ *        recently used slot if it is missing.
+ *
+ * @param handle - the specific LCD handle.
+ * @param glyph  - the glyph number.
+ *
+ * @return The CGRAM slot.
+ */
+static uint8_t GetGlyphSlot(lcdPrivateHandle_t *handle, uint8_t glyph)
+{
+	SYSTEM_ASSERT(glyph && (glyph <= handle->glyph_count));
+
+	/** Position in the use order: a hit or, if missing, the LRU slot */
+	uint8_t position = 0;
+	while ((position < 7) && (handle->slot_glyph[handle->slot_order[position]] != glyph))
+	{
+		++position;
+	}
+
+	const uint8_t slot = handle->slot_order[position];
+
+	if (handle->slot_glyph[slot] != glyph)
+	{
+		/** Reinterpret as hardware adapter interface */
+		lcdAdapterInterface_t *adapter = handle->config->adapter;
+		const uint8_t *charmap = handle->glyphs[glyph - 1];
+#ifndef LCD_SHADOW_BUFFER
+		const uint8_t ddram_address = handle->ddram_address;
+		const bool ddram_known = handle->ddram_known;
+#endif
+
+		SetCgramAddress(handle, slot);
+		if (adapter->writeBlock)
+		{
+			adapter->writeBlock(adapter, charmap, 8, LCD_DATA_MODE);
+		}
+		else
+		{
+			for (uint8_t i = 0; i < 8; ++i)
+			{
+				LCD_Write(handle, charmap[i]);
+			}
+		}
+		handle->slot_glyph[slot] = glyph;
+
+#ifndef LCD_SHADOW_BUFFER
+		/**
+		 * Back to the DDRAM, the shadow flush sets it by itself. An unknown
+		 * address was in CGRAM, e.g. after LCD_CreateChar: it stays there.
+		 */
+		if (ddram_known)
+		{
+			LCD_Command(handle, LCD_SET_DD_RAM_ADDR | ddram_address);
+		}
+#endif
+	}
+
+	/** Most recently used */
+	memmove(&handle->slot_order[1], &handle->slot_order[0], position);
+	handle->slot_order[0] = slot;
+
+	return slot;
+}
+
+/**
+ * @brief Remove a CGRAM slot from the glyph cache, when it is written by
+ *        LCD_CreateChar.
+ *
+ * @param handle - the specific LCD handle.
+ * @param slot   - the CGRAM slot.
+ */
+static void InvalidateGlyphSlot(lcdPrivateHandle_t *handle, uint8_t slot)
+{
+	handle->slot_glyph[slot] = 0;
+}
+
+#ifndef LCD_SHADOW_BUFFER
+/**
+ * @brief Move the tracked DDRAM address counter, with the wrap of the
+ *        controller.
+ *
+ * The 80 DDRAM cells are one line, 0x00 to 0x4F, or two lines, 0x00 to
+ * 0x27 and 0x40 to 0x67: the counter goes from 0x27 to 0x40 and from 0x67
+ * back to 0x00.
+ *
+ * @param handle  - the specific LCD handle.
+ * @param forward - if the counter is incremented, otherwise decremented.
+ * @param count   - the number of positions.
+ */
+static void MoveDdramAddress(lcdPrivateHandle_t *handle, bool forward, size_t count)
+{
+	const bool two_lines = handle->display_function & LCD_2_LINE;
+	uint8_t cell = handle->ddram_address;
+
+	/** Cell index from 0 to 79 */
+	if (two_lines && (cell >= 0x40))
+	{
+		cell = cell - 0x40 + 40;
+	}
+
+	count %= 80;
+	cell = forward ? (cell + count) % 80 : (cell + 80 - count) % 80;
+
+	if (two_lines && (cell >= 40))
+	{
+		cell = cell - 40 + 0x40;
+	}
+	handle->ddram_address = cell;
+}
+
+/**
+ * @brief Follow the effect of a command on the DDRAM address counter.
+ *
+ * @param handle - the specific LCD handle.
+ * @param value  - the command value.
+ */
+static void TrackCommand(lcdPrivateHandle_t *handle, uint8_t value)
+{
+	/** The instruction is given by the highest bit set */
+	if (value & LCD_SET_DD_RAM_ADDR)
+	{
+		handle->ddram_address = value & 0x7F;
+		handle->ddram_known = true;
+	}
+	else if (value & LCD_SET_CG_RAM_ADDR)
+	{
+		/** The address counter left the DDRAM */
+		handle->ddram_known = false;
+	}
+	else if (value & LCD_FUNCTION_SET)
+	{
+		/** No effect on the address counter */
+	}
+	else if (value & LCD_CURSOR_SHIFT)
+	{
+		/** A cursor move, a display shift keeps the address counter */
+		if (!(value & LCD_DISPLAY_MOVE) && handle->ddram_known)
+		{
+			MoveDdramAddress(handle, value & LCD_MOVE_RIGHT, 1);
+		}
+	}
+	else if (value & LCD_DISPLAY_CONTROL)
+	{
+		/** No effect on the address counter */
+	}
+	else if (value & LCD_ENTRY_MODE_SET)
+	{
+		handle->ddram_increment = value & LCD_ENTRY_LEFT;
+	}
+	else if (value & (LCD_CLEAR_DISPLAY | LCD_RETURN_HOME))
+	{
+		/** The clear also sets the increment mode */
+		if (value == LCD_CLEAR_DISPLAY)
+		{
+			handle->ddram_increment = true;
+		}
+		handle->ddram_address = 0;
+		handle->ddram_known = true;
+	}
+}
+#endif
+
+/**
+ * @brief Set the custom glyphs used by the glyph cache.
+ *
+ * @param handle - the specific LCD handle.
+ * @param glyphs - the glyphs bit maps, kept by the caller.
+ * @param count  - the number of glyphs.
+ */
+void LCD_SetGlyphTable(lcdHandle_t handle, const uint8_t glyphs[][8], uint8_t count)
+{
+	SYSTEM_ASSERT(handle);
+
+	/** Reinterpret as private handle */
+	lcdPrivateHandle_t* lcdHandle = handle;
+	LcdEnterMutex(lcdHandle);
+
+	lcdHandle->glyphs = glyphs;
+	lcdHandle->glyph_count = count;
+
+	/** The glyph numbers now refer to other bit maps */
+	for (uint8_t i = 0; i < 8; ++i)
+	{
+		lcdHandle->slot_glyph[i] = 0;
+	}
+
+	LcdExitMutex(lcdHandle);
+}
+
+/**
+ * @brief Get the character code of a glyph, uploading it to CGRAM if
+ *        it is not in a slot.
+ *
+ * @param handle - the specific LCD handle.
+ * @param glyph  - the glyph number, from 1 to the table count.
+ *
+ * @return The character code (CGRAM slot) holding the glyph.
+ */
+uint8_t LCD_GetGlyph(lcdHandle_t handle, uint8_t glyph)
+{
+	SYSTEM_ASSERT(handle);
+	LcdEnterMutex(((lcdPrivateHandle_t*)handle));
+
+	const uint8_t slot = GetGlyphSlot(handle, glyph);
+
+	LcdExitMutex(((lcdPrivateHandle_t*)handle));
+
+	return slot;
+}
+#endif /* LCD_GLYPH_CACHE */
+
+#ifdef LCD_SHADOW_BUFFER
+/**
+ * @brief Send the characters changed in the shadow to the display.
+ *
+ * @param handle - the specific LCD handle.
+ */
+void LCD_Flush(lcdHandle_t handle)
+{
+	SYSTEM_ASSERT(handle);
+
+	/** Reinterpret as private handle */
+	lcdPrivateHandle_t* lcdHandle = handle;
+	lcdAdapterInterface_t *adapter = lcdHandle->config->adapter;
+	const uint8_t cols = lcdHandle->config->cols;
+
+	LcdEnterMutex(lcdHandle);
+
+	for (uint8_t row = 0; row < lcdHandle->config->lines; ++row)
+	{
+		uint8_t *shadow = &lcdHandle->shadow[row * cols];
+		uint8_t *shown = &lcdHandle->shown[row * cols];
+		uint8_t col = 0;
+
+		while (col < cols)
+		{
+			if (shadow[col] == shown[col])
+			{
+				++col;
+				continue;
+			}
+
+			/** Finds the run of changed characters */
+			uint8_t end = col + 1;
+			while ((end < cols) && (shadow[end] != shown[end]))
+			{
+				++end;
+			}
+
+			/** Moves the address counter only if it is not there yet */
+			const uint8_t address = lcdHandle->row_offsets[row] + col;
+			if (!lcdHandle->address_known || (lcdHandle->address != address))
+			{
+				LCD_Command(handle, LCD_SET_DD_RAM_ADDR | address);
+				lcdHandle->address_known = true;
+			}
+
+			if (adapter->writeBlock)
+			{
+				adapter->writeBlock(adapter, &shadow[col], end - col, LCD_DATA_MODE);
+			}
+			else
+			{
+				for (uint8_t i = col; i < end; ++i)
+				{
+					adapter->write(adapter, shadow[i], false, LCD_DATA_MODE);
+				}
+			}
+			memcpy(&shown[col], &shadow[col], end - col);
+			lcdHandle->address = address + (end - col);
+
+			col = end;
+		}
+	}
+
+	LcdExitMutex(lcdHandle);
+}
+#endif /* LCD_SHADOW_BUFFER */
+
 /** MID level commands */
 
 void LCD_Command(lcdHandle_t handle, uint8_t value)
@@ -803,6 +1409,13 @@ void LCD_Command(lcdHandle_t handle, uint8_t value)
 	/** Reinterpret as hardware adapter interface */
 	lcdAdapterInterface_t *adapter = ((lcdPrivateHandle_t*)handle)->config->adapter;
 
+#ifdef LCD_SHADOW_BUFFER
+	/** The command may move the address counter, or point it to CGRAM */
+	((lcdPrivateHandle_t*)handle)->address_known = false;
+#elif defined(LCD_GLYPH_CACHE)
+	TrackCommand(handle, value);
+#endif
+
 	/** Call command for current adapter */
 	adapter->write(adapter, value, false, LCD_COMMAND_MODE);
 }
@@ -812,6 +1425,17 @@ void LCD_Write(lcdHandle_t handle, uint8_t value)
 	/** Reinterpret as hardware adapter interface */
 	lcdAdapterInterface_t *adapter = ((lcdPrivateHandle_t*)handle)->config->adapter;
 
+#ifdef LCD_SHADOW_BUFFER
+	/** The address counter may be in CGRAM */
+	((lcdPrivateHandle_t*)handle)->address_known = false;
+#elif defined(LCD_GLYPH_CACHE)
+	/** In CGRAM the DDRAM address stays unknown */
+	if (((lcdPrivateHandle_t*)handle)->ddram_known)
+	{
+		MoveDdramAddress(handle, ((lcdPrivateHandle_t*)handle)->ddram_increment, 1);
+	}
+#endif
+
 	/** Call command for current adapter */
 	adapter->write(adapter, value, false, LCD_DATA_MODE);
 }
@@ -99,6 +99,27 @@ extern "C" {
 /*!< Uncomment this macro if want to use reentrant access of API.*/
 #define LCD_REENTRANT_ACCESS
 
+/*!< Uncomment this macro if want to keep a RAM shadow of the display DDRAM.
+ *   LCD_Clear, LCD_Home, LCD_SetCursor, LCD_WriteString and LCD_WriteBigNum
+ *   then only update the shadow, and LCD_Flush sends the changed characters.
+ *   Text past the end of a row goes on in DDRAM order (rows 0, 2, 1 and 3 on
+ *   a 4-line module), as without the shadow. Only the DDRAM cells beyond the
+ *   visible columns (e.g. 0x10 to 0x27 on a 16x2) are skipped.*/
+//#define LCD_SHADOW_BUFFER
+#ifdef LCD_SHADOW_BUFFER
+	#define LCD_SHADOW_MAX_CELLS 80 /*!< The maximum cols x lines of a display (e.g. 20x4 or 40x2).*/
+#endif
+
+/*!< Uncomment this macro if want to map a table of custom glyphs onto the 8
+ *   CGRAM slots. A glyph is uploaded only when it is not in a slot, replacing
+ *   the least recently used one. The cache owns all CGRAM slots: at most 8
+ *   different glyphs can be visible at once. The cursor is restored after an
+ *   upload from the address counter followed through LCD_Command and LCD_Write.*/
+//#define LCD_GLYPH_CACHE
+#ifdef LCD_GLYPH_CACHE
+	#define LCD_GLYPH_ESCAPE '\x1B' /*!< In LCD_WriteString, the next byte is a glyph number (e.g. "\x1B\x01").*/
+#endif
+
 /*!< If is not used RTOS or mutex, then mutex control functions will be bypassed.*/
 #ifndef _LCD_USE_RTOS
 #define LcdEnterMutex(x) (void)0
@@ -150,6 +171,16 @@ typedef struct
 	/*!< Mid level command callback */
 	void (*write)(lcdAdapter_t adapter, uint8_t value, uint8_t is_expanded, uint8_t mode);
 
+	/*!< Optional block write callback, NULL if the adapter has none. Sends
+	 *   length bytes in the same mode, each one after the execution time of
+	 *   the previous one. */
+	void (*writeBlock)(lcdAdapter_t adapter, const uint8_t *data, size_t length, uint8_t mode);
+
+	/*!< Optional callback that waits the controller to finish the last
+	 *   command, NULL if the adapter can not read the busy flag. Returns false
+	 *   if the busy flag was not cleared within the adapter timeout. */
+	bool (*waitReady)(lcdAdapter_t adapter);
+
 	/*!< Bus set rs callback */
 	void (*setRs)(lcdAdapter_t adapter);
 
@@ -332,6 +363,47 @@ void LCD_CreateBigNumsChars(lcdHandle_t handle);
  */
 void LCD_WriteBigNum(lcdHandle_t handle, uint8_t col, uint8_t num);
 
+#ifdef LCD_GLYPH_CACHE
+/**
+ * @brief Set the custom glyphs used by the glyph cache.
+ *
+ * The glyph number 1 is glyphs[0], and so on, since 0 ends a string.
+ *
+ * @param handle - the specific LCD handle.
+ * @param glyphs - the glyphs bit maps, kept by the caller.
+ * @param count  - the number of glyphs.
+ */
+void LCD_SetGlyphTable(lcdHandle_t handle, const uint8_t glyphs[][8], uint8_t count);
+
+/**
+ * @brief Get the character code of a glyph, uploading it to CGRAM if
+ *        it is not in a slot.
+ *
+ * The code can be written with LCD_Write. In LCD_WriteString, the
+ * LCD_GLYPH_ESCAPE byte followed by the glyph number does the same.
+ *
+ * @param handle - the specific LCD handle.
+ * @param glyph  - the glyph number, from 1 to the table count.
+ *
+ * @return The character code (CGRAM slot) holding the glyph.
+ */
+uint8_t LCD_GetGlyph(lcdHandle_t handle, uint8_t glyph);
+#endif /* LCD_GLYPH_CACHE */
+
+#ifdef LCD_SHADOW_BUFFER
+/**
+ * @brief Send the characters changed in the shadow to the display.
+ *
+ * Only the runs of changed characters are written, with a DDRAM address
+ * command only when a run does not start where the controller address
+ * counter already is. The shadow assumes left to right entry mode
+ * without autoscroll.
+ *
+ * @param handle - the specific LCD handle.
+ */
+void LCD_Flush(lcdHandle_t handle);
+#endif /* LCD_SHADOW_BUFFER */
+
 /**
  * @brief Send a command to the HD44780 controller.
  *
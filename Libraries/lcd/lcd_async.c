@@ -0,0 +1,437 @@
+/**
+ * @file	lcd_async.c
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * Non-blocking API for the HD44780 LCD library.
+ */
+
+/** std */
+#include <string.h>
+
+/** Self header */
+#include "lcd_async.h"
+
+#ifdef _LCD_USE_RTOS
+
+#include "task.h"
+
+/*******************************************************************************
+ * Enums
+ ******************************************************************************/
+
+/*!< Enumeration of the queued operations.*/
+enum
+{
+	LCD_ASYNC_CLEAR,
+	LCD_ASYNC_HOME,
+	LCD_ASYNC_SET_CURSOR,
+	LCD_ASYNC_WRITE
+};
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+
+/*!
+ * @brief A queued LCD operation
+ */
+typedef struct
+{
+	/*!< The operation, one of LCD_ASYNC_*.*/
+	uint8_t opcode;
+
+	/*!< The cursor column and row of LCD_ASYNC_SET_CURSOR.*/
+	uint8_t col;
+	uint8_t row;
+
+	/*!< The text length and characters of LCD_ASYNC_WRITE.*/
+	uint8_t length;
+	char text[LCD_ASYNC_TEXT_SIZE + 1];
+} lcdAsyncOperation_t;
+
+/*!
+ * @brief Asynchronous LCD handle structure used internally
+ *
+ * The queue is a ring of operations. Only the operations still in the ring
+ * are coalesced: the task copies an operation out before executing it.
+ */
+typedef struct
+{
+	/*!< The LCD handle driven by the task.*/
+	lcdHandle_t lcd;
+
+	/*!< The render task.*/
+	TaskHandle_t task;
+
+	/*!< The mutex that protects the queue.*/
+	SemaphoreHandle_t mutex;
+
+	/*!< The pending operations.*/
+	lcdAsyncOperation_t queue[LCD_ASYNC_QUEUE_LENGTH];
+
+	/*!< The index of the oldest pending operation.*/
+	uint8_t head;
+
+	/*!< The number of pending operations.*/
+	uint8_t count;
+} lcdAsyncPrivateHandle_t;
+
+/*******************************************************************************
+ * Locals
+ ******************************************************************************/
+
+#ifdef LCD_STATIC_OBJECTS_CREATION
+
+/*!< The static list of asynchronous handle structures that is returned to the API.*/
+static lcdAsyncPrivateHandle_t g_lcdAsyncHandleList[LCD_MAX_STATIC_OBJECTS];
+
+/*!< The number of asynchronous handle structures created.*/
+static uint8_t g_staticAsyncHandlesCreated;
+
+#endif
+
+/*******************************************************************************
+ * Forward declarations
+ ******************************************************************************/
+
+/**
+ * @brief The render task: executes the queued operations when notified.
+ *
+ * @param arg - the asynchronous handle.
+ */
+static void LCD_AsyncTask(void *arg);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/**
+ * @brief Get the newest pending operation.
+ *
+ * @param handle - the asynchronous handle, with the queue mutex taken.
+ *
+ * @return The operation, or NULL if the queue is empty.
+ */
+static lcdAsyncOperation_t* GetLast(lcdAsyncPrivateHandle_t *handle)
+{
+	if (!handle->count) return NULL;
+
+	return &handle->queue[(handle->head + handle->count - 1) % LCD_ASYNC_QUEUE_LENGTH];
+}
+
+/**
+ * @brief Append an operation to the queue.
+ *
+ * @param handle - the asynchronous handle, with the queue mutex taken.
+ * @param opcode - the operation.
+ *
+ * @return The operation to be filled, or NULL if the queue is full.
+ */
+static lcdAsyncOperation_t* Push(lcdAsyncPrivateHandle_t *handle, uint8_t opcode)
+{
+	lcdAsyncOperation_t *operation;
+
+	if (handle->count >= LCD_ASYNC_QUEUE_LENGTH) return NULL;
+
+	operation = &handle->queue[(handle->head + handle->count++) % LCD_ASYNC_QUEUE_LENGTH];
+	operation->opcode = opcode;
+	operation->length = 0;
+
+	return operation;
+}
+
+/**
+ * @brief Remove the oldest operation from the queue.
+ *
+ * @param handle    - the asynchronous handle.
+ * @param operation - the destination of the operation.
+ *
+ * @return true if an operation was removed.
+ */
+static bool Pop(lcdAsyncPrivateHandle_t *handle, lcdAsyncOperation_t *operation)
+{
+	bool popped = false;
+
+	xSemaphoreTake(handle->mutex, portMAX_DELAY);
+	if (handle->count)
+	{
+		*operation = handle->queue[handle->head];
+		handle->head = (handle->head + 1) % LCD_ASYNC_QUEUE_LENGTH;
+		--handle->count;
+		popped = true;
+	}
+	xSemaphoreGive(handle->mutex);
+
+	return popped;
+}
+
+/**
+ * @brief Queue a cursor operation, replacing the newest one if it is also a
+ *        cursor operation.
+ */
+static uint8_t PushCursor(lcdAsyncPrivateHandle_t *handle, uint8_t opcode, uint8_t col, uint8_t row)
+{
+	lcdAsyncOperation_t *operation;
+
+	xSemaphoreTake(handle->mutex, portMAX_DELAY);
+
+	operation = GetLast(handle);
+	if (operation && (operation->opcode == LCD_ASYNC_SET_CURSOR || operation->opcode == LCD_ASYNC_HOME))
+	{
+		/** The previous move would never be seen */
+		operation->opcode = opcode;
+	}
+	else
+	{
+		operation = Push(handle, opcode);
+	}
+
+	if (operation)
+	{
+		operation->col = col;
+		operation->row = row;
+	}
+
+	xSemaphoreGive(handle->mutex);
+
+	if (!operation) return SYSTEM_STATUS_FAIL;
+
+	xTaskNotifyGive(handle->task);
+	return SYSTEM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Give back the handle of a failed LCD_AsyncInit.
+ *
+ * A static slot keeps its mutex for the next LCD_AsyncInit, since heap_1
+ * can not free it. A dynamic handle is freed with its mutex, which needs a
+ * heap that supports vPortFree.
+ *
+ * @param handle - the asynchronous handle, without a task.
+ */
+static void ReleaseHandle(lcdAsyncPrivateHandle_t *handle)
+{
+#ifdef LCD_STATIC_OBJECTS_CREATION
+	/** The slot is the last one taken */
+	(void)handle;
+	--g_staticAsyncHandlesCreated;
+#else
+	if (handle->mutex) vSemaphoreDelete(handle->mutex);
+	vPortFree(handle);
+#endif
+}
+
+/**
+ * @brief Create the render queue and task of an LCD.
+ *
+ * @param handle - the LCD handle returned by LCD_Init.
+ *
+ * @return - The asynchronous handle or;
+ *         - NULL, if was not possible to create the queue or the task.
+ */
+lcdAsyncHandle_t LCD_AsyncInit(lcdHandle_t handle)
+{
+	SYSTEM_ASSERT(handle);
+
+	lcdAsyncPrivateHandle_t *async = NULL;
+
+#ifdef LCD_STATIC_OBJECTS_CREATION
+	if(g_staticAsyncHandlesCreated < LCD_MAX_STATIC_OBJECTS)
+	{
+		async = &g_lcdAsyncHandleList[g_staticAsyncHandlesCreated++];
+	}
+#else
+	async = pvPortMalloc(sizeof(lcdAsyncPrivateHandle_t));
+	if (async) async->mutex = NULL;
+#endif
+
+	if (!async) return NULL;
+
+	async->lcd = handle;
+	async->head = 0;
+	async->count = 0;
+
+	/** A slot given back by a failed call still has its mutex */
+	if (!async->mutex)
+	{
+		async->mutex = xSemaphoreCreateMutex();
+	}
+
+	if (!async->mutex || (xTaskCreate(LCD_AsyncTask, "LCD", LCD_ASYNC_TASK_STACK_SIZE, async,
+			LCD_ASYNC_TASK_PRIORITY, &async->task) != pdPASS))
+	{
+		ReleaseHandle(async);
+		return NULL;
+	}
+
+	return async;
+}
+
+/**
+ * @brief Queue a screen clear.
+ *
+ * @param async - the asynchronous LCD handle.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if queued, \a SYSTEM_STATUS_FAIL if the queue is full.
+ */
+uint8_t LCD_AsyncClear(lcdAsyncHandle_t async)
+{
+	SYSTEM_ASSERT(async);
+
+	/** Reinterpret as private handle */
+	lcdAsyncPrivateHandle_t *handle = async;
+
+	xSemaphoreTake(handle->mutex, portMAX_DELAY);
+
+	/** The pending operations would be erased by the clear */
+	handle->count = 0;
+	Push(handle, LCD_ASYNC_CLEAR);
+
+	xSemaphoreGive(handle->mutex);
+
+	xTaskNotifyGive(handle->task);
+	return SYSTEM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Queue a cursor move to the LCD home.
+ *
+ * @param async - the asynchronous LCD handle.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if queued, \a SYSTEM_STATUS_FAIL if the queue is full.
+ */
+uint8_t LCD_AsyncHome(lcdAsyncHandle_t async)
+{
+	SYSTEM_ASSERT(async);
+
+	return PushCursor(async, LCD_ASYNC_HOME, 0, 0);
+}
+
+/**
+ * @brief Queue a cursor move to a specific position.
+ *
+ * @param async - the asynchronous LCD handle.
+ * @param col   - the cursor column number.
+ * @param row   - the cursor row number.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if queued, \a SYSTEM_STATUS_FAIL if the queue is full.
+ */
+uint8_t LCD_AsyncSetCursor(lcdAsyncHandle_t async, uint8_t col, uint8_t row)
+{
+	SYSTEM_ASSERT(async);
+
+	return PushCursor(async, LCD_ASYNC_SET_CURSOR, col, row);
+}
+
+/**
+ * @brief Queue a string to be written in the cursor position.
+ *
+ * @param async - the asynchronous LCD handle.
+ * @param str   - the string.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if queued, \a SYSTEM_STATUS_FAIL if the queue
+ *         has no room for the whole string (nothing is queued).
+ */
+uint8_t LCD_AsyncWriteString(lcdAsyncHandle_t async, const char *str)
+{
+	SYSTEM_ASSERT(async);
+
+	/** Reinterpret as private handle */
+	lcdAsyncPrivateHandle_t *handle = async;
+	size_t length = strlen(str);
+
+	xSemaphoreTake(handle->mutex, portMAX_DELAY);
+
+	/** Room left in the newest operation, if it is also a text */
+	lcdAsyncOperation_t *operation = GetLast(handle);
+	size_t room = (operation && operation->opcode == LCD_ASYNC_WRITE) ?
+			LCD_ASYNC_TEXT_SIZE - operation->length : 0;
+	size_t rest = (length > room) ? length - room : 0;
+
+	if ((rest + LCD_ASYNC_TEXT_SIZE - 1) / LCD_ASYNC_TEXT_SIZE > LCD_ASYNC_QUEUE_LENGTH - handle->count)
+	{
+		xSemaphoreGive(handle->mutex);
+		return SYSTEM_STATUS_FAIL;
+	}
+
+	while (length)
+	{
+		if (!room)
+		{
+			operation = Push(handle, LCD_ASYNC_WRITE);
+			room = LCD_ASYNC_TEXT_SIZE;
+		}
+
+		size_t n = (length < room) ? length : room;
+		memcpy(&operation->text[operation->length], str, n);
+		operation->length += n;
+		str += n;
+		length -= n;
+		room -= n;
+	}
+
+	xSemaphoreGive(handle->mutex);
+
+	xTaskNotifyGive(handle->task);
+	return SYSTEM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief The render task: executes the queued operations when notified.
+ *
+ * @param arg - the asynchronous handle.
+ */
+static void LCD_AsyncTask(void *arg)
+{
+	lcdAsyncPrivateHandle_t *handle = arg;
+	lcdAsyncOperation_t operation;
+
+	for ( ; ; )
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		while (Pop(handle, &operation))
+		{
+			switch (operation.opcode)
+			{
+			case LCD_ASYNC_CLEAR:
+				LCD_Clear(handle->lcd);
+				break;
+			case LCD_ASYNC_HOME:
+				LCD_Home(handle->lcd);
+				break;
+			case LCD_ASYNC_SET_CURSOR:
+				LCD_SetCursor(handle->lcd, operation.col, operation.row);
+				break;
+			case LCD_ASYNC_WRITE:
+				operation.text[operation.length] = '\0';
+				LCD_WriteString(handle->lcd, operation.text);
+				break;
+			}
+		}
+
+#ifdef LCD_SHADOW_BUFFER
+		/** Sends only what the drained operations changed */
+		LCD_Flush(handle->lcd);
+#endif
+	}
+}
+
+#endif /* _LCD_USE_RTOS */
@@ -0,0 +1,142 @@
+/**
+ * @file	lcd_async.h
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * Non-blocking API for the HD44780 LCD library. The operations are queued
+ * and executed by a dedicated low priority task, so the callers never wait
+ * for the controller timing. Only available with FreeRTOS.
+ */
+
+#ifndef LCD_HD44780_ASYNC_H_
+#define LCD_HD44780_ASYNC_H_
+
+/** LCD API */
+#include "lcd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @addtogroup lcd
+ * @{
+ */
+
+#ifdef _LCD_USE_RTOS
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< The maximum number of pending operations of each LCD.*/
+#define LCD_ASYNC_QUEUE_LENGTH 8
+
+/*!< The maximum number of characters of each queued text operation. Longer
+ *   strings take several operations.*/
+#define LCD_ASYNC_TEXT_SIZE 16
+
+/*!< The priority of the render task.*/
+#define LCD_ASYNC_TASK_PRIORITY (tskIDLE_PRIORITY + 1)
+
+/*!< The stack size of the render task, in words.*/
+#define LCD_ASYNC_TASK_STACK_SIZE (configMINIMAL_STACK_SIZE + 32)
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/*!< Asynchronous LCD handle for API use */
+typedef void* lcdAsyncHandle_t;
+
+/*******************************************************************************
+ * Forward declarations
+ ******************************************************************************/
+
+/**
+ * @brief Create the render queue and task of an LCD.
+ *
+ * After this call, the LCD must only be accessed through the LCD_Async*
+ * functions. On a failure the handle slot is given back, so the call can be
+ * retried.
+ *
+ * @param handle - the LCD handle returned by LCD_Init.
+ *
+ * @return - The asynchronous handle or;
+ *         - NULL, if was not possible to create the queue or the task.
+ */
+lcdAsyncHandle_t LCD_AsyncInit(lcdHandle_t handle);
+
+/**
+ * @brief Queue a screen clear.
+ *
+ * All the operations still pending are discarded, since the clear would
+ * erase their result.
+ *
+ * @param async - the asynchronous LCD handle.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if queued, \a SYSTEM_STATUS_FAIL if the queue is full.
+ */
+uint8_t LCD_AsyncClear(lcdAsyncHandle_t async);
+
+/**
+ * @brief Queue a cursor move to the LCD home.
+ *
+ * @param async - the asynchronous LCD handle.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if queued, \a SYSTEM_STATUS_FAIL if the queue is full.
+ */
+uint8_t LCD_AsyncHome(lcdAsyncHandle_t async);
+
+/**
+ * @brief Queue a cursor move to a specific position.
+ *
+ * Consecutive cursor moves are coalesced into the last one.
+ *
+ * @param async - the asynchronous LCD handle.
+ * @param col   - the cursor column number.
+ * @param row   - the cursor row number.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if queued, \a SYSTEM_STATUS_FAIL if the queue is full.
+ */
+uint8_t LCD_AsyncSetCursor(lcdAsyncHandle_t async, uint8_t col, uint8_t row);
+
+/**
+ * @brief Queue a string to be written in the cursor position.
+ *
+ * The string is copied. Consecutive strings are appended in the same
+ * operation while it has room.
+ *
+ * @param async - the asynchronous LCD handle.
+ * @param str   - the string.
+ *
+ * @return \a SYSTEM_STATUS_SUCCESS if queued, \a SYSTEM_STATUS_FAIL if the queue
+ *         has no room for the whole string (nothing is queued).
+ */
+uint8_t LCD_AsyncWriteString(lcdAsyncHandle_t async, const char *str);
+
+#endif /* _LCD_USE_RTOS */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+/*! @}*/
+
+#endif /* LCD_HD44780_ASYNC_H_ */
@@ -68,28 +68,6 @@ static void* CreateObject(uint8_t objectType)
 	return objectCreated;
 }
 
-static void DestroyObject(void* obj, uint8_t objectType)
-{
-#ifdef PID_CTRL_STATIC_OBJECTS_CREATION
-	switch (objectType)
-	{
-	case PID_CTRL_OBJECT_IS_HANDLE:
-		if(g_staticHandlesCreated)
-			--g_staticHandlesCreated;
-		break;
-	case PID_CTRL_OBJECT_IS_CONFIG:
-		if(g_staticConfigsCreated)
-			--g_staticConfigsCreated;
-		break;
-	}
-
-#else
-	embUtil_Free(obj);
-#endif
-	obj = NULL;
-}
-
-
 /**
  * @brief Creates the structure to configure the PID controller instance.
  *
@@ -32,9 +32,18 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <limits.h>
 
 #include "printf.h"
 
+// the base 10 conversion is shared with Libraries/util/string.h when it is there with
+// DEC_REV_FUNC, otherwise printf uses its own copy (see _ntoa_dec_rev)
+#if defined(__has_include)
+#if __has_include(<Libraries/util/string.h>)
+#include <Libraries/util/string.h>
+#endif
+#endif
+
 
 // define this globally (e.g. gcc -DPRINTF_INCLUDE_CONFIG_H ...) to include the
 // printf_config.h header file
@@ -82,6 +91,13 @@
 #define PRINTF_MAX_FLOAT  1e9
 #endif
 
+// support for the fixed point Q formats (%k for Q16.16, %hk for Q8.24)
+// formatted with integer arithmetic only, no floating point library is needed
+// default: activated
+#ifndef PRINTF_DISABLE_SUPPORT_FIXED
+#define PRINTF_SUPPORT_FIXED
+#endif
+
 // support for the long long types (%llu or %p)
 // default: activated
 #ifndef PRINTF_DISABLE_SUPPORT_LONG_LONG
@@ -277,6 +293,74 @@ static size_t _ntoa_format(out_fct_type out, char* buffer, size_t idx, size_t ma
 }
 
 
+// internal base 10 conversion of a 32-bit value, two digits per step (see Util_DecToStrReversed)
+// the digits are appended to 'buf' in reverse order, zero-padded up to 'min_digits'
+// \return The new length of 'buf'
+#ifdef DEC_REV_FUNC
+static inline size_t _ntoa_dec_rev(char* buf, size_t len, uint32_t value, size_t min_digits)
+{
+  return len + Util_DecToStrReversed((uint8_t*)&buf[len], value, min_digits);
+}
+#else
+// two ASCII digits for each value from 0 to 99
+static const char _digit_pairs[200] = {
+  '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+  '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+  '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+  '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+  '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+  '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+  '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+  '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+  '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+  '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+
+// the division by 100 is a multiply by its reciprocal, exact for all 32-bit values
+static size_t _ntoa_dec_rev(char* buf, size_t len, uint32_t value, size_t min_digits)
+{
+  const size_t start_len = len;
+
+  while (value >= 100U) {
+    const uint32_t quot = (uint32_t)(((uint64_t)value * 0x51EB851FU) >> 37U);
+    const uint32_t pair = 2U * (value - quot * 100U);
+    buf[len++] = _digit_pairs[pair + 1U];
+    buf[len++] = _digit_pairs[pair];
+    value = quot;
+  }
+  if (value >= 10U) {
+    buf[len++] = _digit_pairs[2U * value + 1U];
+    buf[len++] = _digit_pairs[2U * value];
+  }
+  else {
+    buf[len++] = (char)('0' + value);
+  }
+  while (len - start_len < min_digits) {
+    buf[len++] = '0';
+  }
+  return len;
+}
+#endif
+
+
+#if defined(PRINTF_SUPPORT_LONG_LONG) || (ULONG_MAX > 0xFFFFFFFFUL)
+// internal base 10 conversion of a 64-bit value, in chunks of 9 digits
+// only one 64-bit division is needed per chunk above 32 bits (at most two)
+static size_t _ntoa_dec_rev_long_long(char* buf, unsigned long long value)
+{
+  size_t len = 0U;
+
+  while (value > 0xFFFFFFFFULL) {
+    const unsigned long long quot = value / 1000000000ULL;
+    len = _ntoa_dec_rev(buf, len, (uint32_t)(value - quot * 1000000000ULL), 9U);
+    value = quot;
+  }
+  return _ntoa_dec_rev(buf, len, (uint32_t)value, 1U);
+}
+#endif
+
+
 // internal itoa for 'long' type
 static size_t _ntoa_long(out_fct_type out, char* buffer, size_t idx, size_t maxlen, unsigned long value, bool negative, unsigned long base, unsigned int prec, unsigned int width, unsigned int flags)
 {
@@ -289,7 +373,14 @@ static size_t _ntoa_long(out_fct_type out, char* buffer, size_t idx, size_t maxl
   }
 
   // write if precision != 0 and value is != 0
-  if (!(flags & FLAGS_PRECISION) || value) {
+  if ((!(flags & FLAGS_PRECISION) || value) && (base == 10U)) {
+#if ULONG_MAX > 0xFFFFFFFFUL
+    len = _ntoa_dec_rev_long_long(buf, value);
+#else
+    len = _ntoa_dec_rev(buf, 0U, value, 1U);
+#endif
+  }
+  else if (!(flags & FLAGS_PRECISION) || value) {
     do {
       const char digit = (char)(value % base);
       buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
@@ -314,7 +405,10 @@ static size_t _ntoa_long_long(out_fct_type out, char* buffer, size_t idx, size_t
   }
 
   // write if precision != 0 and value is != 0
-  if (!(flags & FLAGS_PRECISION) || value) {
+  if ((!(flags & FLAGS_PRECISION) || value) && (base == 10U)) {
+    len = _ntoa_dec_rev_long_long(buf, value);
+  }
+  else if (!(flags & FLAGS_PRECISION) || value) {
     do {
       const char digit = (char)(value % base);
       buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
@@ -573,6 +667,76 @@ static size_t _etoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, d
 #endif  // PRINTF_SUPPORT_FLOAT
 
 
+#if defined(PRINTF_SUPPORT_FIXED)
+// internal fixed point (Q format) conversion, the value has 'frac_bits' fractional bits
+// the last digit is rounded half away from zero
+static size_t _qtoa(out_fct_type out, char* buffer, size_t idx, size_t maxlen, int32_t value, unsigned int frac_bits, unsigned int prec, unsigned int width, unsigned int flags)
+{
+  char buf[PRINTF_FTOA_BUFFER_SIZE];
+  size_t len = 0U;
+
+  // powers of 10
+  static const uint32_t pow10[] = { 1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U };
+
+  const bool negative = (value < 0);
+  const uint32_t mag = negative ? 0U - (uint32_t)value : (uint32_t)value;
+  uint32_t whole = mag >> frac_bits;
+  const uint32_t frac = mag & ((1UL << frac_bits) - 1U);
+
+  // set default precision, if not set explicitly
+  if (!(flags & FLAGS_PRECISION)) {
+    prec = PRINTF_DEFAULT_FLOAT_PRECISION;
+  }
+  // limit precision to 9, keeping room for 9 decimals, the point, 10 whole digits and the sign
+  while ((len + 21U < PRINTF_FTOA_BUFFER_SIZE) && (prec > 9U)) {
+    buf[len++] = '0';
+    prec--;
+  }
+  if (prec > 9U) {
+    prec = 9U;
+  }
+
+  // frac < 2^frac_bits, so frac * 10^prec fits in 64 bits
+  uint32_t frac_dec = (uint32_t)(((uint64_t)frac * pow10[prec] + (1ULL << (frac_bits - 1U))) >> frac_bits);
+  if (frac_dec >= pow10[prec]) {
+    // handle rollover, e.g. case 0.99 with prec 1 is 1.0
+    frac_dec = 0U;
+    ++whole;
+  }
+
+  if (prec > 0U) {
+    len = _ntoa_dec_rev(buf, len, frac_dec, prec);
+    buf[len++] = '.';
+  }
+  len = _ntoa_dec_rev(buf, len, whole, 1U);
+
+  // pad leading zeros
+  if (!(flags & FLAGS_LEFT) && (flags & FLAGS_ZEROPAD)) {
+    if (width && (negative || (flags & (FLAGS_PLUS | FLAGS_SPACE)))) {
+      width--;
+    }
+    while ((len < width) && (len < PRINTF_FTOA_BUFFER_SIZE)) {
+      buf[len++] = '0';
+    }
+  }
+
+  if (len < PRINTF_FTOA_BUFFER_SIZE) {
+    if (negative) {
+      buf[len++] = '-';
+    }
+    else if (flags & FLAGS_PLUS) {
+      buf[len++] = '+';  // ignore the space if the '+' exists
+    }
+    else if (flags & FLAGS_SPACE) {
+      buf[len++] = ' ';
+    }
+  }
+
+  return _out_rev(out, buffer, idx, maxlen, buf, len, width, flags);
+}
+#endif  // PRINTF_SUPPORT_FIXED
+
+
 // internal vsnprintf
 static int _vsnprintf(out_fct_type out, char* buffer, const size_t maxlen, const char* format, va_list va)
 {
@@ -773,6 +937,12 @@ static int _vsnprintf(out_fct_type out, char* buffer, const size_t maxlen, const
         break;
 #endif  // PRINTF_SUPPORT_EXPONENTIAL
 #endif  // PRINTF_SUPPORT_FLOAT
+#if defined(PRINTF_SUPPORT_FIXED)
+      case 'k' :
+        idx = _qtoa(out, buffer, idx, maxlen, va_arg(va, int32_t), (flags & FLAGS_SHORT) ? 24U : 16U, precision, width, flags);
+        format++;
+        break;
+#endif  // PRINTF_SUPPORT_FIXED
       case 'c' : {
         unsigned int l = 1U;
         // pre padding
@@ -912,3 +1082,10 @@ int fctprintf(void (*out)(char character, void* arg), void* arg, const char* for
   va_end(va);
   return ret;
 }
+
+
+int vfctprintf(void (*out)(char character, void* arg), void* arg, const char* format, va_list va)
+{
+  const out_fct_wrap_type out_fct_wrap = { out, arg };
+  return _vsnprintf(_out_fct, (char*)(uintptr_t)&out_fct_wrap, (size_t)-1, format, va);
+}
@@ -23,6 +23,10 @@
  */
 
 #include <common.h>
+#ifdef __OS_PROJECT
+#include <System/os/scheduler.h>
+#include <System/os/task.h>
+#endif /* __OS_PROJECT */
 #include "stream.h"
 
 
@@ -58,6 +62,11 @@ streamConfig_t* Stream_CreateConfig( void )
 #else
 	ret = SYSTEM_MALLOC( sizeof ( streamConfig_t ) );
 #endif
+	if ( ret != NULL )
+	{
+		ret->WriteBlock = NULL;
+		ret->ReadBlock = NULL;
+	}
 	return ret;
 }
 
@@ -73,6 +82,17 @@ void Stream_WriteBlocking( streamHandle_t handle, const uint8_t *data, size_t le
 {
 	streamConfig_t *config = handle;
 
+	if ( config->WriteBlock != NULL )
+	{
+		while ( length )
+		{
+			size_t written = config->WriteBlock( data, length );
+			data += written;
+			length -= written;
+		}
+		return;
+	}
+
 	for(int i = 0; i < length; ++i)
 	{
 		while(!config->GetAvailToWrite());
@@ -85,6 +105,17 @@ void Stream_ReadBlocking( streamHandle_t handle, uint8_t *data, size_t length )
 {
 	streamConfig_t *config = handle;
 
+	if ( config->ReadBlock != NULL )
+	{
+		while ( length )
+		{
+			size_t received = config->ReadBlock( data, length );
+			data += received;
+			length -= received;
+		}
+		return;
+	}
+
 	for(int i = 0; i < length; ++i)
 	{
 		while(!config->GetBytesToRead());
@@ -100,9 +131,16 @@ uint8_t Stream_Read( streamHandle_t handle, uint8_t *data, size_t length )
 
 	if ( config->GetBytesToRead() == length )
 	{
-		for(int i = 0; i < length; ++i)
+		if ( config->ReadBlock != NULL )
 		{
-			data[i] = config->Read();
+			config->ReadBlock( data, length );
+		}
+		else
+		{
+			for(int i = 0; i < length; ++i)
+			{
+				data[i] = config->Read();
+			}
 		}
 		status = SYSTEM_STATUS_SUCCESS;
 	}
@@ -117,9 +155,16 @@ uint8_t Stream_Write( streamHandle_t handle, const uint8_t *data, size_t length
 
 	if ( config->GetAvailToWrite() == length )
 	{
-		for(int i = 0; i < length; ++i)
+		if ( config->WriteBlock != NULL )
+		{
+			config->WriteBlock( data, length );
+		}
+		else
 		{
-			config->Write( data[i] );
+			for(int i = 0; i < length; ++i)
+			{
+				config->Write( data[i] );
+			}
 		}
 		status = SYSTEM_STATUS_SUCCESS;
 	}
@@ -127,6 +172,81 @@ uint8_t Stream_Write( streamHandle_t handle, const uint8_t *data, size_t length
 
 }
 
+/**********************************************************************************/
+size_t Stream_WriteSome( streamHandle_t handle, const uint8_t *data, size_t length )
+{
+	streamConfig_t *config = handle;
+	size_t avail = config->GetAvailToWrite();
+
+	if ( length > avail )
+	{
+		length = avail;
+	}
+
+	if ( config->WriteBlock != NULL )
+	{
+		return config->WriteBlock( data, length );
+	}
+
+	for(size_t i = 0; i < length; ++i)
+	{
+		config->Write( data[i] );
+	}
+	return length;
+}
+
+/**********************************************************************************/
+size_t Stream_ReadSome( streamHandle_t handle, uint8_t *data, size_t length )
+{
+	streamConfig_t *config = handle;
+	size_t avail = config->GetBytesToRead();
+
+	if ( length > avail )
+	{
+		length = avail;
+	}
+
+	if ( config->ReadBlock != NULL )
+	{
+		return config->ReadBlock( data, length );
+	}
+
+	for(size_t i = 0; i < length; ++i)
+	{
+		data[i] = config->Read();
+	}
+	return length;
+}
+
+#ifdef __OS_PROJECT
+/**********************************************************************************/
+uint8_t Stream_WriteAll( streamHandle_t handle, const uint8_t *data, size_t length, osTick_t timeout )
+{
+	osTick_t start = OS_Scheduler_GetTickCount();
+
+	for ( ; ; )
+	{
+		size_t written = Stream_WriteSome( handle, data, length );
+		data += written;
+		length -= written;
+
+		if ( length == 0 )
+		{
+			return SYSTEM_STATUS_SUCCESS;
+		}
+		if ( ( timeout != OS_TIME_INFINITY ) &&
+			 ( (osTick_t)( OS_Scheduler_GetTickCount() - start ) >= timeout ) )
+		{
+			return SYSTEM_STATUS_TIMEOUT;
+		}
+		if ( written == 0 )
+		{
+			OS_Task_Delay( 1 ); /* Output buffer is full, let other tasks run */
+		}
+	}
+}
+#endif /* __OS_PROJECT */
+
 /**********************************************************************************/
 size_t Stream_GetAvailToWrite( streamHandle_t handle )
 {
@@ -29,6 +29,9 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <common.h>
+#ifdef __OS_PROJECT
+#include <System/os/os.h>
+#endif /* __OS_PROJECT */
 
 /*!
  * @addtogroup stream
@@ -59,6 +62,14 @@ typedef struct
 	void ( *Write )( const uint8_t );
 	/*!< Function pointer to read a byte in the stream input.*/
 	uint8_t ( *Read )( void );
+	/*!< Optional function pointer to write a block of bytes in the stream output.
+	 *   It must not block and returns the number of bytes actually written.
+	 *   If NULL, the "GetAvailToWrite" and "Write" callbacks are used.*/
+	size_t ( *WriteBlock )( const uint8_t *data, size_t length );
+	/*!< Optional function pointer to read a block of bytes from the stream input.
+	 *   It must not block and returns the number of bytes actually read.
+	 *   If NULL, the "GetBytesToRead" and "Read" callbacks are used.*/
+	size_t ( *ReadBlock )( uint8_t *data, size_t length );
 	/*!< The new line feed command string (ex.: "\n", "\r\n", etc).*/
 	const unsigned char *newLine;
 }streamConfig_t;
@@ -75,6 +86,9 @@ typedef void* streamHandle_t;
 /**
  * @brief Creates the structure to configure the stream instance.
  *
+ * @note The optional "WriteBlock" and "ReadBlock" callbacks are
+ *       initialized as NULL.
+ *
  * @return - The configuration structure or;
  *         - NULL, if was not possible to create the structure.
  *
@@ -155,6 +169,58 @@ uint8_t Stream_Write( streamHandle_t handle, const uint8_t *data, size_t length
  */
 uint8_t Stream_Read( streamHandle_t handle, uint8_t *data, size_t length );
 
+/**
+ * @brief Write as many bytes as the output buffer can take.
+ *
+ *        The function never waits. It sends min(available, length)
+ *        bytes and returns.
+ *
+ * @param handle - the specific stream handle.
+ * @param data - a pointer to the message buffer.
+ * @param length - the message length.
+ *
+ * @return - The number of bytes actually written (may be 0).
+ *
+ */
+size_t Stream_WriteSome( streamHandle_t handle, const uint8_t *data, size_t length );
+
+/**
+ * @brief Read as many bytes as there are in the input buffer.
+ *
+ *        The function never waits. It reads min(available, length)
+ *        bytes and returns.
+ *
+ * @param handle - the specific stream handle.
+ * @param data - a pointer to the message buffer.
+ * @param length - the maximum number of bytes to read.
+ *
+ * @return - The number of bytes actually read (may be 0).
+ *
+ */
+size_t Stream_ReadSome( streamHandle_t handle, uint8_t *data, size_t length );
+
+#ifdef __OS_PROJECT
+/**
+ * @brief Write all the message, waiting for space in the output
+ *        buffer up to a timeout.
+ *
+ *        While the output buffer is full, the calling task sleeps
+ *        for one tick instead of polling the stream.
+ *
+ * @param handle - the specific stream handle.
+ * @param data - a pointer to the message buffer.
+ * @param length - the message length.
+ * @param timeout - the maximum time to wait in OS ticks, or
+ *                  OS_TIME_INFINITY to wait forever.
+ *
+ * @return - SYSTEM_STATUS_SUCCESS, if the message was complete written to the stream, or;
+ *           SYSTEM_STATUS_TIMEOUT, if the timeout expired. In this case, part of
+ *           the message may already have been written.
+ *
+ */
+uint8_t Stream_WriteAll( streamHandle_t handle, const uint8_t *data, size_t length, osTick_t timeout );
+#endif /* __OS_PROJECT */
+
 /**
  * @brief Get the available number of bytes in the output buffer that
  *        available to write.
@@ -139,9 +139,6 @@ synthHandle_t* SYNTH_Init(synthAdapter_t *adapter)
 	synthHandle_t *handle = (synthHandle_t*)SynthCreateObject(SYNTH_OBJECT_IS_HANDLE);
 	synthConfig_t *config = (synthConfig_t*)SynthCreateObject(SYNTH_OBJECT_IS_CONFIG);
 
-	/** Reinterpret as hardware config interface */
-	synthAdapter_t *adapter_interface = (synthAdapter_t*)adapter;
-
 	/** TODO add free */
 	if(!handle || !config) return NULL;
 
@@ -30,6 +30,8 @@
 /* -------------------------------------------------------------------------------- */
 #include "ugui.h"
 
+#ifdef USE_UGUI
+
 /* Static functions */
  UG_RESULT _UG_WindowDrawTitle( UG_WINDOW* wnd );
  void _UG_WindowUpdate( UG_WINDOW* wnd );
@@ -4593,19 +4595,6 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
 {
    UG_S16 n, dx, dy, sgndx, sgndy, dxabs, dyabs, x, y, drawx, drawy;
 
-   if ( x2 < x1 )
-   {
-      n = x2;
-      x2 = x1;
-      x1 = n;
-   }
-   if ( y2 < y1 )
-   {
-      n = y2;
-      y2 = y1;
-      y1 = n;
-   }
-
    /* Is hardware acceleration available? */
    if ( gui->driver[DRIVER_DRAW_LINE].state & DRIVER_ENABLED )
    {
@@ -5268,7 +5257,7 @@ void UG_Update( void )
          gui->active_window = gui->next_window;
 
          /* Do we need to draw an inactive title? */
-         if ( (gui->last_window->style & WND_STYLE_SHOW_TITLE) && (gui->last_window->state & WND_STATE_VISIBLE) )
+         if ( (gui->last_window != NULL) && (gui->last_window->style & WND_STYLE_SHOW_TITLE) && (gui->last_window->state & WND_STATE_VISIBLE) )
          {
             /* Do both windows differ in size */
             if ( (gui->last_window->xs != gui->active_window->xs) || (gui->last_window->xe != gui->active_window->xe) || (gui->last_window->ys != gui->active_window->ys) || (gui->last_window->ye != gui->active_window->ye) )
@@ -7013,4 +7002,4 @@ void _UG_ImageUpdate(UG_WINDOW* wnd, UG_OBJECT* obj)
    }
 }
 
-
+#endif /* USE_UGUI */
@@ -38,6 +38,9 @@
 /* -- CONFIG SECTION                                                             -- */
 /* -------------------------------------------------------------------------------- */
 
+/* Enable uGUI here: when commented, ugui.c and ugui_display.c are not compiled */
+//#define  USE_UGUI
+
 /* Enable needed fonts here */
 //#define  USE_FONT_4X6
 //#define  USE_FONT_5X8
@@ -0,0 +1,156 @@
+/**
+ * @file	ugui_display.c
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * uGUI drivers on the display HAL.
+ */
+
+#include "ugui_display.h"
+
+#ifdef USE_UGUI
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!< Convert an uGUI RGB888 color to RGB565. */
+#define UGUI_TO_RGB565( c ) ( (uint16_t)( ( ( (c) >> 8 ) & 0xF800 ) | ( ( (c) >> 5 ) & 0x07E0 ) | ( ( (c) >> 3 ) & 0x001F ) ) )
+
+/*!< The display where uGUI draws. */
+static displayHandle_t g_uguiDisplay;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief uGUI pixel callback.
+ */
+static void UGUI_DisplayPset( UG_S16 x, UG_S16 y, UG_COLOR c )
+{
+	Display_FillRect( g_uguiDisplay, x, y, 1, 1, UGUI_TO_RGB565( c ) );
+}
+
+/**
+ * @brief DRIVER_FILL_FRAME: the frame corners are already sorted by uGUI.
+ */
+static UG_RESULT UGUI_DisplayFillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
+{
+	Display_FillRect( g_uguiDisplay, x1, y1, x2 - x1 + 1, y2 - y1 + 1, UGUI_TO_RGB565( c ) );
+
+	return UG_RESULT_OK;
+}
+
+/**
+ * @brief DRIVER_DRAW_LINE: Bresenham drawing a run of pixels at a time.
+ *
+ * Lines closer to the horizontal are drawn as horizontal runs and the other
+ * ones as vertical runs, so straight lines are a single block.
+ */
+static UG_RESULT UGUI_DisplayDrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
+{
+	const uint16_t color = UGUI_TO_RGB565( c );
+	UG_S16 dx = x2 - x1;
+	UG_S16 dy = y2 - y1;
+	UG_S16 sx = 1;
+	UG_S16 sy = 1;
+	UG_S16 start, err;
+
+	if ( dx < 0 )
+	{
+		dx = -dx;
+		sx = -1;
+	}
+	if ( dy < 0 )
+	{
+		dy = -dy;
+		sy = -1;
+	}
+
+	if ( dx >= dy )
+	{
+		/* One horizontal run per row */
+		err = dx / 2;
+		start = x1;
+		for ( ; ; )
+		{
+			err -= dy;
+			if ( x1 == x2 || err < 0 )
+			{
+				UG_S16 left = ( sx > 0 ) ? start : x1;
+
+				Display_FillRect( g_uguiDisplay, left, y1, sx * ( x1 - start ) + 1, 1, color );
+				if ( x1 == x2 )
+				{
+					break;
+				}
+				y1 += sy;
+				err += dx;
+				start = x1 + sx;
+			}
+			x1 += sx;
+		}
+	}
+	else
+	{
+		/* One vertical run per column */
+		err = dy / 2;
+		start = y1;
+		for ( ; ; )
+		{
+			err -= dx;
+			if ( y1 == y2 || err < 0 )
+			{
+				UG_S16 top = ( sy > 0 ) ? start : y1;
+
+				Display_FillRect( g_uguiDisplay, x1, top, 1, sy * ( y1 - start ) + 1, color );
+				if ( y1 == y2 )
+				{
+					break;
+				}
+				x1 += sx;
+				err += dy;
+				start = y1 + sy;
+			}
+			y1 += sy;
+		}
+	}
+
+	return UG_RESULT_OK;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/**********************************************************************************/
+void UGUI_DisplayInit( UG_GUI *gui, displayHandle_t display )
+{
+	SYSTEM_ASSERT( gui );
+	SYSTEM_ASSERT( display );
+
+	g_uguiDisplay = display;
+
+	UG_Init( gui, UGUI_DisplayPset, Display_GetWidth( display ), Display_GetHeight( display ) );
+	UG_DriverRegister( DRIVER_FILL_FRAME, (void*)UGUI_DisplayFillFrame );
+	UG_DriverRegister( DRIVER_DRAW_LINE, (void*)UGUI_DisplayDrawLine );
+}
+
+#endif /* USE_UGUI */
@@ -0,0 +1,57 @@
+/**
+ * @file	ugui_display.h
+ * @author  agent
+ * @version 1.0
+ * @date    2026
+ *
+ * @section LICENSE
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details at
+ * http://www.gnu.org/copyleft/gpl.html
+ *
+ * @section DESCRIPTION
+ *
+ * uGUI drivers on the display HAL.
+ */
+
+#ifndef LIBRARIES_UGUI_DISPLAY_H_
+#define LIBRARIES_UGUI_DISPLAY_H_
+
+#include "ugui.h"
+#include "libraries/display/display.h"
+
+/*!
+ * @addtogroup ugui
+ * @{
+ */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Initialize a uGUI instance drawing on a display.
+ *
+ * The pixel callback and the DRIVER_FILL_FRAME and DRIVER_DRAW_LINE
+ * acceleration drivers are registered, so frames, window backgrounds and
+ * lines are written as blocks instead of pixel by pixel. The uGUI RGB888
+ * colors are converted to RGB565.
+ *
+ * @param gui - the uGUI structure.
+ * @param display - the display handle.
+ *
+ * @note Only one display is supported.
+ */
+void UGUI_DisplayInit( UG_GUI *gui, displayHandle_t display );
+
+/*! @}*/
+
+#endif /* LIBRARIES_UGUI_DISPLAY_H_ */
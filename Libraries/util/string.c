@@ -30,10 +30,55 @@
 
 #define ASSERT(x) SYSTEM_ASSERT(x)
 
+#ifdef DEC_REV_FUNC
+/*!< Two ASCII digits for each value from 0 to 99, used by the base 10 conversions. */
+static const char _digitPairs[200] = {
+	'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+	'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+	'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+	'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+	'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+	'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+	'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+	'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+	'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+	'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+#endif
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
 
+#ifdef DEC_REV_FUNC
+/**********************************************************************************/
+size_t Util_DecToStrReversed( uint8_t *str, uint32_t value, size_t minDigits )
+{
+	size_t i = 0;
+
+	// The division by 100 is a multiply by its reciprocal, exact for all 32-bit values
+	while (value >= 100U) {
+		uint32_t quot = (uint32_t)(((uint64_t)value * 0x51EB851FU) >> 37U);
+		uint32_t pair = 2U * (value - quot * 100U);
+		str[i++] = _digitPairs[pair + 1U];
+		str[i++] = _digitPairs[pair];
+		value = quot;
+	}
+	if (value >= 10U) {
+		str[i++] = _digitPairs[2U * value + 1U];
+		str[i++] = _digitPairs[2U * value];
+	}
+	else {
+		str[i++] = (uint8_t)('0' + value);
+	}
+	while (i < minDigits) {
+		str[i++] = '0';
+	}
+
+	return i;
+}
+#endif /* DEC_REV_FUNC */
+
 #ifdef STR_COPY_FUNC
 // Credits: Erich Styger component from Processor Expert https://mcuoneclipse.com/author/mcuoneclipse/
 void Util_StrCopy(uint8_t *dst, size_t dstSize, const char *src)
@@ -136,7 +181,12 @@ int Util_IntToStr( int32_t num, uint8_t *str, uint8_t base )
 	// base 10. Otherwise numbers are considered unsigned.
 	if (num < 0 && base == 10) {
 		isNegative = true;
-		num = -num;
+		num = (int32_t)(0U - (uint32_t)num);
+	}
+
+	if (base == 10) {
+		i = (int)Util_DecToStrReversed(str, (uint32_t)num, 1U);
+		num = 0;
 	}
 
 	// Process individual digits
@@ -278,6 +328,54 @@ int Util_FloatToStr( float n, uint8_t *res, int afterpoint )
 }
 #endif /* defined(ITOA) && defined(FTOA) */
 
+#if defined(FIXTOA_FUNC) && defined(REVERSE_FUNC)
+int Util_FixedToStr( int32_t num, uint8_t fracBits, uint8_t *res, int afterPoint )
+{
+	static const uint32_t pow10[] = { 1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U };
+	bool isNegative = (num < 0);
+	uint32_t mag = isNegative ? 0U - (uint32_t)num : (uint32_t)num;
+	uint32_t whole, frac = 0U;
+	int i = 0;
+
+	ASSERT(res);
+	ASSERT(fracBits < 32U);
+
+	if (afterPoint < 0) {
+		afterPoint = 0;
+	}
+	else if (afterPoint > 9) {
+		afterPoint = 9;
+	}
+
+	whole = mag >> fracBits;
+	if (fracBits > 0U) {
+		// The fractional bits times 10^afterPoint always fit in 64 bits
+		frac = mag & ((1UL << fracBits) - 1U);
+		frac = (uint32_t)(((uint64_t)frac * pow10[afterPoint] + (1ULL << (fracBits - 1U))) >> fracBits);
+		if (frac >= pow10[afterPoint]) {
+			// Rounding carry, ex.: 0.99 with one digit is 1.0
+			frac = 0U;
+			++whole;
+		}
+	}
+
+	// The string is built backwards and reversed at the end
+	if (afterPoint > 0) {
+		i = (int)Util_DecToStrReversed(res, frac, (size_t)afterPoint);
+		res[i++] = '.';
+	}
+	i += (int)Util_DecToStrReversed(res + i, whole, 1U);
+	if (isNegative) {
+		res[i++] = '-';
+	}
+	res[i] = '\0';
+
+	Util_ReverseStr(res, i);
+
+	return i;
+}
+#endif /* defined(FIXTOA_FUNC) && defined(REVERSE_FUNC) */
+
 #ifdef ATOF_FUNC
 bool Util_StrToFloat( const unsigned char **str, float *res )
 {
@@ -55,6 +55,19 @@
 #define ATOF_FUNC 		  //AtoF
 #define ETOA_FUNC 		  //EtoA
 #define ATOE_FUNC 		  //AtoE
+#define FIXTOA_FUNC 	  //FixedToA
+#define DEC_REV_FUNC 	  //DecToStrReversed, needed by ItoA, FixedToA and Libraries/printf
+
+#if ( defined(ITOA_FUNC) || defined(FIXTOA_FUNC) ) && !defined(DEC_REV_FUNC)
+#error "Util_IntToStr and Util_FixedToStr need DEC_REV_FUNC"
+#endif
+
+/*!< Number of fractional bits of the Q16.16 and Q8.24 fixed-point formats. */
+#define UTIL_Q16_16_FRAC_BITS (16U)
+#define UTIL_Q8_24_FRAC_BITS  (24U)
+/*!< Maximum length of the string converted by "Util_FixedToStr", including the
+ * null terminator: sign, 10 integer digits, point and 9 decimals. */
+#define UTIL_FIXED_STR_MAX_LEN (22U)
 
 
 /*******************************************************************************
@@ -186,6 +199,24 @@ int16_t Util_StrFind(uint8_t *str, uint8_t *subStr);
 #endif /* STR_FIND_FUNC */
 
 
+#ifdef DEC_REV_FUNC
+/**
+ * @brief Writes the base 10 digits of a value in reverse order, two digits per step.
+ *
+ * 		  The digits come from a table of digit pairs and the division by 100 is
+ * 		  a multiply by its reciprocal, so no software division is called on cores
+ * 		  without a hardware divider. The string is not null-terminated.
+ *
+ * @param str - where the digits are written, with room for max(10, minDigits) bytes.
+ * @param value - the value.
+ * @param minDigits - the value is zero-padded up to this number of digits.
+ *
+ * @return The number of digits written.
+ *
+ */
+size_t Util_DecToStrReversed( uint8_t *str, uint32_t value, size_t minDigits );
+#endif
+
 #ifdef ITOA_FUNC
  /**
   * @brief Converts integer into null-terminated string.
@@ -235,6 +266,24 @@ bool Util_StrToInt( const unsigned char **str, int32_t *res );
 int Util_FloatToStr( float n, uint8_t *res, int afterPoint );
 #endif
 
+#ifdef FIXTOA_FUNC
+/**
+ * @brief Converts a fixed-point (Q format) number into null-terminated string.
+ *
+ * 		  Only integer arithmetic is used, so no floating-point library is needed.
+ * 		  The last digit is rounded half away from zero.
+ *
+ * @param num - input number, with fracBits fractional bits (ex.: UTIL_Q16_16_FRAC_BITS).
+ * @param fracBits - number of fractional bits (0 to 31).
+ * @param res - array where output string to be stored, with at least UTIL_FIXED_STR_MAX_LEN bytes.
+ * @param afterPoint - number of digits to be considered after the point (0 to 9).
+ *
+ * @return The string length.
+ *
+ */
+int Util_FixedToStr( int32_t num, uint8_t fracBits, uint8_t *res, int afterPoint );
+#endif
+
 #ifdef ATOF_FUNC
 /**
  * @brief Converts a null-terminated string representing a number
@@ -9,10 +9,6 @@
 #include "semaphore.h"
 #include "scheduler.h"
 
-static uint16_t g_tasksNumber;
-static osSemaphore_t g_initSignalSemaphore;
-static osTick_t g_tasksInitialTime;
-
 typedef struct
 {
 	size_t period;
@@ -53,6 +49,10 @@ void OS_Task_Create( osTaskFunction_t code,
 }
 
 /*
+static uint16_t g_tasksNumber;
+static osSemaphore_t g_initSignalSemaphore;
+static osTick_t g_tasksInitialTime;
+
 void OS_Task_SignalInit(uint16_t tasksNumber)
 {
 	g_tasksNumber = tasksNumber;